@@ -17,6 +17,7 @@
 #include "XmlParseHelperTable.h"
 #include "XmlParseHelperData.h"
 #include "SharedDataTable.h"
+#include "JobSystem.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace DOGEngine;
@@ -40,6 +41,9 @@ namespace LibraryDesktopTest
 
 		TEST_METHOD_INITIALIZE(Initialize)
 		{
+			// the shared job system starts its worker threads on first use, so that happens before the memory snapshot
+			JobSystem::instance();
+
 #ifdef _DEBUG
 			// grab snapshot of memory state at start of test
 			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
@@ -54,8 +58,6 @@ namespace LibraryDesktopTest
 
 		TEST_METHOD_CLEANUP(Cleanup)
 		{
-			XmlParseHelperData::clearHandlerCache();
-			XmlParseHelperTable::clearHandlerCache();
 			Attributed::clearAttributeCache();
 
 			delete sEntityFactory;
@@ -188,8 +190,11 @@ namespace LibraryDesktopTest
 
 				actionList->update(worldState);
 
-				// action create action's update enqueues itself for deletion
+				// action create action's update queues the new action, and enqueues itself for deletion
+				Assert::IsTrue((*actionList)["actions"].size() == 1);
+				Assert::IsTrue(world.getPendingCreate().size() == 1);
 				Assert::IsTrue(world.getPendingDelete().isPendingDelete(*createAction));
+				world.getPendingCreate().empty();
 				world.getPendingDelete().empty();
 
 				Assert::IsTrue((*actionList)["actions"].size() == 1);
@@ -1,4 +1,4 @@
-
+﻿
 #include "pch.h"
 #include "CppUnitTest.h"
 
@@ -13,6 +13,7 @@
 #include "EventQueue.h"
 #include "EventArgs.h"
 #include "Event.h"
+#include "JobSystem.h"
 
 #include "ActionEvent.h"
 #include "ActionUnsubscribe.h"
@@ -36,9 +37,12 @@ namespace LibraryDesktopTest
 			// because we create so many subscribers to stress-test the system, the static list of subscribers grows in capacity during the test
 			//		this causes the unit test to thing that there is a memory leak when there really isn't
 			//		so we create a bunch of subscribers here to grow the static subscriber list
-			PrepStaticSubscriberList<EventSubscriberFoo>(sNumSubs * 2);
+			PrepStaticSubscriberList<EventSubscriberFoo>(max(sNumSubs * 2, sNumBenchmarkSubs));
 			PrepStaticSubscriberList<ReactionAttributed>(sNumSubs);
 
+			// the shared job system starts its worker threads on first use, so that has to happen before the snapshot too
+			JobSystem::instance();
+
 			Attributed::clearAttributeCache();
 
 #ifdef _DEBUG
@@ -174,6 +178,24 @@ namespace LibraryDesktopTest
 			}
 		}
 
+		TEST_METHOD(AsyncDeliverBenchmark)
+		{
+			// compares job system delivery against one std::async per subscriber (the previous delivery path)
+			AsyncDeliverBenchmarkHelper();
+		}
+
+		TEST_METHOD(AsyncQueueBenchmark)
+		{
+			// compares the heap-ordered queue against a full scan of every pending event per frame (the previous update path)
+			AsyncQueueBenchmarkHelper();
+		}
+
+		TEST_METHOD(AsyncEnqueueStress)
+		{
+			// producer threads enqueue while the main thread keeps updating, against a mutex-guarded queue (the previous enqueue path)
+			AsyncEnqueueStressHelper();
+		}
+
 	private:
 
 		template <typename DerivedT, typename BaseT>
@@ -855,6 +877,287 @@ namespace LibraryDesktopTest
 		}
 
 
+		void AsyncDeliverBenchmarkHelper()
+		{
+			EventSubscriberFoo* foosubs = reinterpret_cast<EventSubscriberFoo*>(malloc(sizeof(EventSubscriberFoo) * sNumBenchmarkSubs));
+			for(uint32_t i = 0; i < sNumBenchmarkSubs; ++i)
+			{
+				new(foosubs + i)EventSubscriberFoo();
+			}
+
+			Event<Foo> event(Foo(1));
+			vector<double> asyncLatencies;
+			vector<double> jobLatencies;
+
+			// previous path -- one std::async per subscriber, then wait on every future
+			high_resolution_clock::time_point asyncStart = high_resolution_clock::now();
+			for(uint32_t i = 0; i < sNumBenchmarkEvents; ++i)
+			{
+				high_resolution_clock::time_point start = high_resolution_clock::now();
+
+				vector<future<void>> futures;
+				for(uint32_t j = 0; j < sNumBenchmarkSubs; ++j)
+				{
+					futures.emplace_back(async(&IEventSubscriber::notify, static_cast<IEventSubscriber*>(foosubs + j), cref(event)));
+				}
+				for(future<void>& future : futures)
+				{
+					future.wait();
+				}
+
+				asyncLatencies.push_back(duration<double, micro>(high_resolution_clock::now() - start).count());
+			}
+			double asyncSeconds = duration<double>(high_resolution_clock::now() - asyncStart).count();
+
+			// job system path
+			high_resolution_clock::time_point jobStart = high_resolution_clock::now();
+			for(uint32_t i = 0; i < sNumBenchmarkEvents; ++i)
+			{
+				high_resolution_clock::time_point start = high_resolution_clock::now();
+				event.deliver();
+				jobLatencies.push_back(duration<double, micro>(high_resolution_clock::now() - start).count());
+			}
+			double jobSeconds = duration<double>(high_resolution_clock::now() - jobStart).count();
+
+			for(uint32_t i = 0; i < sNumBenchmarkSubs; ++i)
+			{
+				Assert::IsTrue(foosubs[i].getNumNotifies() == sNumBenchmarkEvents * 2);
+			}
+
+			stringstream results;
+			results << "Deliver benchmark (" << sNumBenchmarkSubs << " subscribers, " << sNumBenchmarkEvents << " events)\n";
+			results << "  std::async: " << sNumBenchmarkEvents / asyncSeconds << " events/sec, p99 " << LatencyPercentile(asyncLatencies, 0.99) << " us\n";
+			results << "  JobSystem:  " << sNumBenchmarkEvents / jobSeconds << " events/sec, p99 " << LatencyPercentile(jobLatencies, 0.99) << " us\n";
+			Logger::WriteMessage(results.str().c_str());
+
+			for(uint32_t i = 0; i < sNumBenchmarkSubs; ++i)
+			{
+				foosubs[i].~EventSubscriberFoo();
+			}
+			free(foosubs);
+		}
+
+		void AsyncQueueBenchmarkHelper()
+		{
+			EventSubscriberFoo subscriber;
+
+			// a handful of events come due each millisecond, spread out over the whole run
+			GameTime time;
+			high_resolution_clock::time_point startTime = high_resolution_clock::now();
+			time.SetCurrentTime(startTime);
+
+			vector<shared_ptr<EventPublisher>> events;
+			events.reserve(sNumBenchmarkPending);
+			for(uint32_t i = 0; i < sNumBenchmarkPending; ++i)
+			{
+				events.push_back(make_shared<Event<Foo>>(Foo(static_cast<int32_t>(i))));
+			}
+
+			// previous path -- every frame checks every pending event
+			Vector<shared_ptr<EventPublisher>> scanEvents(sNumBenchmarkPending);
+			for(uint32_t i = 0; i < sNumBenchmarkPending; ++i)
+			{
+				events[i]->setTime(startTime, milliseconds(i / sNumBenchmarkDuePerFrame + 1));
+				scanEvents.pushBack(events[i]);
+			}
+
+			high_resolution_clock::time_point scanStart = high_resolution_clock::now();
+			for(uint32_t frame = 1; frame <= sNumBenchmarkFrames; ++frame)
+			{
+				time.SetCurrentTime(startTime + milliseconds(frame));
+
+				Vector<shared_ptr<EventPublisher>> dueEvents;
+				uint32_t last = scanEvents.size();
+				for(uint32_t start = 0; start < last; ++start)
+				{
+					while(start != last && scanEvents[start]->isExpired(time))
+					{
+						scanEvents[start].swap(scanEvents[--last]);
+						dueEvents.pushBack(scanEvents[last]);
+						scanEvents.popBack();
+					}
+				}
+
+				for(auto& publisher : dueEvents)
+				{
+					publisher->deliver();
+				}
+			}
+			double scanSeconds = duration<double>(high_resolution_clock::now() - scanStart).count();
+			uint32_t numScanned = subscriber.getNumNotifies();
+			scanEvents.clear();
+
+			// heap path
+			EventQueue eventQueue;
+			time.SetCurrentTime(startTime);
+			for(uint32_t i = 0; i < sNumBenchmarkPending; ++i)
+			{
+				eventQueue.enqueue(events[i], time, milliseconds(i / sNumBenchmarkDuePerFrame + 1));
+			}
+			events.clear();
+
+			high_resolution_clock::time_point heapStart = high_resolution_clock::now();
+			for(uint32_t frame = 1; frame <= sNumBenchmarkFrames; ++frame)
+			{
+				time.SetCurrentTime(startTime + milliseconds(frame));
+				eventQueue.update(time);
+			}
+			double heapSeconds = duration<double>(high_resolution_clock::now() - heapStart).count();
+
+			// both paths deliver the same events
+			uint32_t numHeaped = subscriber.getNumNotifies() - numScanned;
+			Assert::IsTrue(numScanned == numHeaped);
+			Assert::IsTrue(numHeaped == (sNumBenchmarkFrames - 1) * sNumBenchmarkDuePerFrame);
+			Assert::IsTrue(eventQueue.size() == sNumBenchmarkPending - numHeaped);
+
+			stringstream results;
+			results << "Queue benchmark (" << sNumBenchmarkPending << " pending events, " << sNumBenchmarkDuePerFrame << " due per frame, " << sNumBenchmarkFrames << " frames)\n";
+			results << "  Full scan: " << scanSeconds * 1000000.0 / sNumBenchmarkFrames << " us/frame\n";
+			results << "  Min-heap:  " << heapSeconds * 1000000.0 / sNumBenchmarkFrames << " us/frame\n";
+			Logger::WriteMessage(results.str().c_str());
+
+			eventQueue.clear();
+		}
+
+		void AsyncEnqueueStressHelper()
+		{
+			EventSubscriberFoo subscriber;
+			uint32_t numEvents = sNumStressProducers * sNumStressEvents;
+
+			// producers only read the enqueue time, while updates run a millisecond later so everything is due
+			GameTime enqueueTime;
+			enqueueTime.SetCurrentTime(high_resolution_clock::now());
+			GameTime updateTime;
+			updateTime.SetCurrentTime(enqueueTime.CurrentTime() + milliseconds(1));
+
+			// previous path -- every enqueue and every update takes the same mutex
+			mutex lockedMutex;
+			Vector<shared_ptr<EventPublisher>> lockedEvents(numEvents);
+
+			auto lockedEnqueue = [&](const shared_ptr<EventPublisher>& publisher)
+			{
+				lock_guard<mutex> lock(lockedMutex);
+				publisher->setTime(enqueueTime.CurrentTime());
+				lockedEvents.pushBack(publisher);
+			};
+			auto lockedUpdate = [&]()
+			{
+				Vector<shared_ptr<EventPublisher>> dueEvents(0);
+				{
+					lock_guard<mutex> lock(lockedMutex);
+					dueEvents = std::move(lockedEvents);
+				}
+
+				for(auto& publisher : dueEvents)
+				{
+					publisher->deliver();
+				}
+			};
+
+			vector<double> lockedLatencies;
+			double lockedSeconds = EnqueueStressRun(lockedEnqueue, lockedUpdate, lockedLatencies);
+			Assert::IsTrue(subscriber.getNumNotifies() == numEvents);
+
+			// staged path
+			EventQueue eventQueue;
+
+			auto stagedEnqueue = [&](const shared_ptr<EventPublisher>& publisher)
+			{
+				eventQueue.enqueue(publisher, enqueueTime);
+			};
+			auto stagedUpdate = [&]()
+			{
+				eventQueue.update(updateTime);
+			};
+
+			vector<double> stagedLatencies;
+			double stagedSeconds = EnqueueStressRun(stagedEnqueue, stagedUpdate, stagedLatencies);
+			Assert::IsTrue(subscriber.getNumNotifies() == numEvents * 2);
+			Assert::IsTrue(eventQueue.isEmpty());
+
+			stringstream results;
+			results << "Enqueue stress (" << sNumStressProducers << " producers, " << sNumStressEvents << " events each)\n";
+			results << "  Mutex:  " << numEvents / lockedSeconds << " enqueues/sec, p99 " << LatencyPercentile(lockedLatencies, 0.99) << " us, p99.9 " << LatencyPercentile(lockedLatencies, 0.999) << " us\n";
+			results << "  Staged: " << numEvents / stagedSeconds << " enqueues/sec, p99 " << LatencyPercentile(stagedLatencies, 0.99) << " us, p99.9 " << LatencyPercentile(stagedLatencies, 0.999) << " us\n";
+			Logger::WriteMessage(results.str().c_str());
+		}
+
+		template <typename EnqueueT, typename UpdateT>
+		double EnqueueStressRun(EnqueueT enqueue, UpdateT update, vector<double>& outLatencies)
+		{
+			atomic<uint32_t> numReady(0);
+			atomic<uint32_t> numFinished(0);
+			atomic<bool> isStarted(false);
+
+			vector<vector<double>> latencies(sNumStressProducers);
+			vector<thread> producers;
+			for(uint32_t i = 0; i < sNumStressProducers; ++i)
+			{
+				producers.emplace_back([&, i]
+				{
+					// events are made up front so only the enqueue itself is timed
+					vector<shared_ptr<EventPublisher>> events;
+					events.reserve(sNumStressEvents);
+					for(uint32_t j = 0; j < sNumStressEvents; ++j)
+					{
+						events.push_back(make_shared<Event<Foo>>(Foo(static_cast<int32_t>(j))));
+					}
+					latencies[i].reserve(sNumStressEvents);
+
+					++numReady;
+					while(!isStarted)
+					{
+						this_thread::yield();
+					}
+
+					for(auto& publisher : events)
+					{
+						high_resolution_clock::time_point start = high_resolution_clock::now();
+						enqueue(publisher);
+						latencies[i].push_back(duration<double, micro>(high_resolution_clock::now() - start).count());
+					}
+
+					++numFinished;
+				});
+			}
+
+			while(numReady < sNumStressProducers)
+			{
+				this_thread::yield();
+			}
+
+			// the main thread keeps updating for as long as the producers run, like a game loop would
+			high_resolution_clock::time_point start = high_resolution_clock::now();
+			isStarted = true;
+			while(numFinished < sNumStressProducers)
+			{
+				update();
+				this_thread::yield();
+			}
+			double seconds = duration<double>(high_resolution_clock::now() - start).count();
+
+			for(thread& producer : producers)
+			{
+				producer.join();
+			}
+			update();
+
+			for(vector<double>& threadLatencies : latencies)
+			{
+				outLatencies.insert(outLatencies.end(), threadLatencies.begin(), threadLatencies.end());
+			}
+
+			return seconds;
+		}
+
+		double LatencyPercentile(vector<double>& samples, double fraction)
+		{
+			sort(samples.begin(), samples.end());
+			size_t index = min(static_cast<size_t>(samples.size() * fraction), samples.size() - 1);
+
+			return samples[index];
+		}
+
 		template <typename T>
 		void PrepStaticSubscriberList(uint32_t size)
 		{
@@ -884,6 +1187,16 @@ namespace LibraryDesktopTest
 		static uint32_t sNumTests;
 		static uint32_t sNumSubs;
 		static uint32_t sNumEvents;
+
+		static uint32_t sNumBenchmarkSubs;
+		static uint32_t sNumBenchmarkEvents;
+
+		static uint32_t sNumBenchmarkPending;
+		static uint32_t sNumBenchmarkDuePerFrame;
+		static uint32_t sNumBenchmarkFrames;
+
+		static uint32_t sNumStressProducers;
+		static uint32_t sNumStressEvents;
 	};
 
 	_CrtMemState AsyncTest::sStartMemState;
@@ -896,5 +1209,15 @@ namespace LibraryDesktopTest
 	uint32_t AsyncTest::sNumTests = 25;
 	uint32_t AsyncTest::sNumSubs = 50;
 	uint32_t AsyncTest::sNumEvents = 500;
+
+	uint32_t AsyncTest::sNumBenchmarkSubs = 1000;
+	uint32_t AsyncTest::sNumBenchmarkEvents = 100;
+
+	uint32_t AsyncTest::sNumBenchmarkPending = 100000;
+	uint32_t AsyncTest::sNumBenchmarkDuePerFrame = 5;
+	uint32_t AsyncTest::sNumBenchmarkFrames = 200;
+
+	uint32_t AsyncTest::sNumStressProducers = 4;
+	uint32_t AsyncTest::sNumStressEvents = 10000;
 }
 
@@ -12,10 +12,7 @@ RTTI_DEFINITIONS(AttributedFoo)
 AttributedFoo::AttributedFoo() :
 	Attributed()
 {
-	if(!areSignaturesInitialized())
-	{
-		initSignatures();
-	}
+	initSignaturesOnce();
 
 	populate();
 }
@@ -199,19 +196,4 @@ void AttributedFoo::populate()
 void AttributedFoo::updateExternalStorage()
 {
 	Attributed::updateExternalStorage();
-
-	// fixing up the locations to which the external fields point
-	operator[]("int_field").setStorage(&mIntField, 1);
-	operator[]("float_field").setStorage(&mFloatField, 1);
-	operator[]("string_field").setStorage(&mStringField, 1);
-	operator[]("vector_field").setStorage(&mVectorField, 1);
-	operator[]("matrix_field").setStorage(&mMatrixField, 1);
-	operator[]("pointer_field").setStorage(&mRTTIField, 1);
-
-	operator[]("int_array").setStorage(mIntArray, ATTRIBUTED_FOO_ARRAY_SIZE);
-	operator[]("float_array").setStorage(mFloatArray, ATTRIBUTED_FOO_ARRAY_SIZE);
-	operator[]("string_array").setStorage(mStringArray, ATTRIBUTED_FOO_ARRAY_SIZE);
-	operator[]("vector_array").setStorage(mVectorArray, ATTRIBUTED_FOO_ARRAY_SIZE);
-	operator[]("matrix_array").setStorage(mMatrixArray, ATTRIBUTED_FOO_ARRAY_SIZE);
-	operator[]("pointer_array").setStorage(mRTTIArray, ATTRIBUTED_FOO_ARRAY_SIZE);
 }
@@ -112,11 +112,9 @@ namespace UnitTests
 		virtual void populate() override;
 
 		/**
-		 * @brief Updates this object's external storage pointers.
-		 *		  This prevents a copied or moved object from having
-		 *		  its external data pointing to members of another
-		 *		  Attributed object. Overridden implementations should
-		 *		  call their parent class' implementation as well.
+		 * @brief Refreshes anything cached about the table after
+		 *		  a copy or move. External attributes have already
+		 *		  been re-pointed at this object's members.
 		 */
 		virtual void updateExternalStorage() override;
 
@@ -3,11 +3,14 @@
 #include "CppUnitTest.h"
 
 #include "AttributedFoo.h"
+#include "ColumnarFoo.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace std::chrono;
 using namespace DOGEngine;
 using namespace UnitTests;
 using namespace std;
+using namespace glm;
 
 namespace LibraryDesktopTest
 {
@@ -116,6 +119,10 @@ namespace LibraryDesktopTest
 
 				Assert::IsTrue(foo["this"].get<RTTI*>() != otherFoo["this"].get<RTTI*>());
 
+				// external attributes point at the copy's own members
+				Assert::IsTrue(&otherFoo.mIntField == &otherFoo["int_field"].get<int32_t>());
+				Assert::IsTrue(&otherFoo.mStringArray[1] == &otherFoo["string_array"].get<string>(1));
+
 				Assert::IsTrue(otherFoo.isAuxiliaryAttribute("auxiliary"));
 				Assert::IsTrue(foo == otherFoo);
 			}
@@ -131,6 +138,7 @@ namespace LibraryDesktopTest
 				otherFoo = foo;
 
 				Assert::IsTrue(foo["this"].get<RTTI*>() != otherFoo["this"].get<RTTI*>());
+				Assert::IsTrue(&otherFoo.mMatrixField == &otherFoo["matrix_field"].get<glm::mat4x4>());
 
 				Assert::IsTrue(otherFoo.isAuxiliaryAttribute("foo_auxiliary"));
 				Assert::IsFalse(otherFoo.isAuxiliaryAttribute("otherFoo_auxiliary"));
@@ -168,6 +176,8 @@ namespace LibraryDesktopTest
 				Assert::IsTrue(otherFoo["float_field"] == 100.0f);
 				Assert::IsTrue(otherFoo["string_field"] == "hello");
 				Assert::IsTrue(otherFoo["auxiliary"] == "world");
+				Assert::IsTrue(&otherFoo.mFloatField == &otherFoo["float_field"].get<float>());
+				Assert::IsTrue(&foo.mFloatField == &foo["float_field"].get<float>());
 
 				Assert::IsTrue(foo["int_field"] == 0);
 				Assert::IsTrue(foo["float_field"] == 0.0f);
@@ -392,14 +402,206 @@ namespace LibraryDesktopTest
 			Attributed::clearAttributeCache();
 		}
 
+		TEST_METHOD(AttributedColumnarStorage)
+		{
+			{
+				ColumnarFoo first;
+				ColumnarFoo second;
+				ColumnarFoo third;
+				first["health"] = 10;
+				second["health"] = 20;
+				third["health"] = 30;
+				second["tag"] = "second";
+				third["target"] = &first;
+				third["path"].set(vec4(1.0f), COLUMNAR_FOO_PATH_SIZE - 1);
+
+				// verify that every instance's values sit side by side in one chunk
+				Datum* health = Attributed::column(ColumnarFoo::TypeIdClass(), "health");
+				Assert::IsTrue(health != nullptr);
+				Assert::IsTrue(health->size() == 3);
+				Assert::IsTrue(third["health"].isExternal());
+
+				int32_t* values = health->data<int32_t>();
+				Assert::IsTrue(values[0] + values[1] + values[2] == 60);
+				Assert::IsTrue(&first["health"].get<int32_t>() == &values[0]);
+
+				Datum* path = Attributed::column(ColumnarFoo::TypeIdClass(), "path");
+				Assert::IsTrue(path->size() == 3 * COLUMNAR_FOO_PATH_SIZE);
+				Assert::IsTrue(path->get<vec4>(3 * COLUMNAR_FOO_PATH_SIZE - 1) == vec4(1.0f));
+
+				// verify that writing through the column is seen through the Scope
+				values[1] = 25;
+				Assert::IsTrue(second["health"] == 25);
+
+				Assert::IsTrue(Attributed::column(ColumnarFoo::TypeIdClass(), "not_an_attribute") == nullptr);
+				Assert::IsTrue(Attributed::column(AttributedFoo::TypeIdClass(), "health") == nullptr);
+				Assert::IsTrue(Attributed::column(ColumnarFoo::TypeIdClass(), "health", 1) == nullptr);
+
+				// verify that copies get rows of their own
+				ColumnarFoo copied(third);
+				Assert::IsTrue(health->size() == 4);
+				Assert::IsTrue(copied == third);
+				copied["health"] = 40;
+				Assert::IsTrue(third["health"] == 30);
+				Assert::IsTrue(copied["target"] == static_cast<RTTI*>(&first));
+
+				ColumnarFoo assigned;
+				assigned = second;
+				Assert::IsTrue(health->size() == 5);
+				Assert::IsTrue(assigned["tag"] == "second");
+				assigned["tag"] = "assigned";
+				Assert::IsTrue(second["tag"] == "second");
+
+				// verify that moves take the row along, and the moved from object gets a fresh one
+				ColumnarFoo moved(std::move(assigned));
+				Assert::IsTrue(health->size() == 6);
+				Assert::IsTrue(moved["tag"] == "assigned");
+				Assert::IsTrue(assigned["tag"] == "foo");
+				Assert::IsTrue(assigned["health"] == 100);
+
+				// verify that destroying an instance keeps the column dense and the others' values intact
+				{
+					ColumnarFoo temporary;
+					Assert::IsTrue(health->size() == 7);
+				}
+				{
+					ColumnarFoo destroyed(std::move(first));
+					first["health"] = 15;
+				}
+				Assert::IsTrue(health->size() == 6);
+				Assert::IsTrue(first["health"] == 15);
+				Assert::IsTrue(second["health"] == 25);
+				Assert::IsTrue(third["health"] == 30);
+				Assert::IsTrue(copied["health"] == 40);
+				Assert::IsTrue(moved["tag"] == "assigned");
+				Assert::IsTrue(third["path"].get<vec4>(COLUMNAR_FOO_PATH_SIZE - 1) == vec4(1.0f));
+			}
+
+			// verify that rows stay put as the columns grow, and views follow them when others are destroyed
+			{
+				Vector<ColumnarFoo*> foos;
+				foos.pushBack(new ColumnarFoo());
+				(*foos[0])["health"] = 0;
+				(*foos[0])["tag"] = to_string(0);
+				int32_t& firstHealth = (*foos[0])["health"].get<int32_t>();
+				string& firstTag = (*foos[0])["tag"].get<string>();
+
+				for(int32_t i = 1; i < 100; ++i)
+				{
+					ColumnarFoo* foo = new ColumnarFoo();
+					(*foo)["health"] = i;
+					(*foo)["tag"] = to_string(i);
+					foos.pushBack(foo);
+				}
+				Assert::IsTrue(&firstHealth == &(*foos[0])["health"].get<int32_t>());
+				Assert::IsTrue(&firstTag == &(*foos[0])["tag"].get<string>());
+				Assert::IsTrue(firstTag == "0");
+
+				int32_t sum = 0;
+				uint32_t numRows = 0;
+				for(uint32_t chunk = 0; Attributed::column(ColumnarFoo::TypeIdClass(), "health", chunk) != nullptr; ++chunk)
+				{
+					Datum& health = *Attributed::column(ColumnarFoo::TypeIdClass(), "health", chunk);
+					Assert::IsTrue(health.size() <= Attributed::sRowsPerChunk);
+					for(uint32_t i = 0; i < health.size(); ++i)
+					{
+						sum += health.get<int32_t>(i);
+					}
+					numRows += health.size();
+				}
+				Assert::IsTrue(sum == 4950);
+				Assert::IsTrue(numRows == 100);
+
+				for(int32_t i = 0; i < 100; i += 2)
+				{
+					delete foos[i];
+					foos[i] = nullptr;
+				}
+				Assert::IsTrue(Attributed::column(ColumnarFoo::TypeIdClass(), "health")->size() == 50);
+				Assert::IsTrue(Attributed::column(ColumnarFoo::TypeIdClass(), "health", 1) == nullptr);
+
+				for(int32_t i = 1; i < 100; i += 2)
+				{
+					Assert::IsTrue((*foos[i])["health"] == i);
+					Assert::IsTrue((*foos[i])["tag"] == to_string(i));
+					delete foos[i];
+				}
+				Assert::IsTrue(Attributed::column(ColumnarFoo::TypeIdClass(), "health") == nullptr);
+			}
+
+			Attributed::clearAttributeCache();
+		}
+
+		TEST_METHOD(AttributedColumnarBenchmark)
+		{
+			Vector<ColumnarFoo*> foos(sNumBenchmarkInstances);
+			for(uint32_t i = 0; i < sNumBenchmarkInstances; ++i)
+			{
+				foos.pushBack(new ColumnarFoo());
+				(*foos[i])["speed"] = static_cast<float>(i % 7);
+			}
+
+			// every instance's speed, looked up through its own Scope
+			float scopeSum = 0.0f;
+			high_resolution_clock::time_point start = high_resolution_clock::now();
+			for(uint32_t pass = 0; pass < sNumBenchmarkPasses; ++pass)
+			{
+				for(ColumnarFoo* foo : foos)
+				{
+					scopeSum += foo->find("speed")->get<float>();
+				}
+			}
+			duration<double, std::nano> scopeTime = high_resolution_clock::now() - start;
+
+			// the same values, scanned straight out of the column a chunk at a time
+			float columnSum = 0.0f;
+			start = high_resolution_clock::now();
+			for(uint32_t pass = 0; pass < sNumBenchmarkPasses; ++pass)
+			{
+				const Datum* speed = nullptr;
+				for(uint32_t chunk = 0; (speed = Attributed::column(ColumnarFoo::TypeIdClass(), "speed", chunk)) != nullptr; ++chunk)
+				{
+					const float* values = speed->data<float>();
+					for(uint32_t i = 0; i < speed->size(); ++i)
+					{
+						columnSum += values[i];
+					}
+				}
+			}
+			duration<double, std::nano> columnTime = high_resolution_clock::now() - start;
+
+			Assert::AreEqual(scopeSum, columnSum);
+
+			double numReads = static_cast<double>(sNumBenchmarkInstances) * sNumBenchmarkPasses;
+
+			stringstream results;
+			results << "Columnar attributes, ns per instance (" << sNumBenchmarkInstances << " instances)" << endl;
+			results << "  Scope lookup: " << scopeTime.count() / numReads << endl;
+			results << "  Column scan : " << columnTime.count() / numReads << endl;
+			Logger::WriteMessage(results.str().c_str());
+
+			for(ColumnarFoo* foo : foos)
+			{
+				delete foo;
+			}
+
+			Attributed::clearAttributeCache();
+		}
+
 	private:
 
 		//
 
 		static _CrtMemState sStartMemState;
 
+		static uint32_t sNumBenchmarkInstances;
+		static uint32_t sNumBenchmarkPasses;
+
 	};
 
 	_CrtMemState AttributedTest::sStartMemState;
+
+	uint32_t AttributedTest::sNumBenchmarkInstances = 10000;
+	uint32_t AttributedTest::sNumBenchmarkPasses = 20;
 }
 
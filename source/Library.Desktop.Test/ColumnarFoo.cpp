@@ -0,0 +1,99 @@
+
+#include "pch.h"
+#include "ColumnarFoo.h"
+
+using namespace DOGEngine;
+using namespace UnitTests;
+using namespace std;
+using namespace glm;
+
+RTTI_DEFINITIONS(ColumnarFoo)
+
+ColumnarFoo::ColumnarFoo() :
+	Attributed()
+{
+	initSignaturesOnce();
+
+	populate();
+}
+
+//-----------------------------------------------------------------
+
+ColumnarFoo::ColumnarFoo(const ColumnarFoo& other) :
+	Attributed(other)
+{
+}
+
+//-----------------------------------------------------------------
+
+ColumnarFoo& ColumnarFoo::operator=(const ColumnarFoo& other)
+{
+	if(&other != this)
+	{
+		Attributed::operator=(other);
+	}
+
+	return *this;
+}
+
+//-----------------------------------------------------------------
+
+Scope* ColumnarFoo::copy()
+{
+	return new ColumnarFoo(*this);
+}
+
+//-----------------------------------------------------------------
+
+ColumnarFoo::ColumnarFoo(ColumnarFoo&& other) :
+	Attributed(std::move(other))
+{
+}
+
+//-----------------------------------------------------------------
+
+ColumnarFoo& ColumnarFoo::operator=(ColumnarFoo&& other)
+{
+	if(this != &other)
+	{
+		Attributed::operator=(std::move(other));
+	}
+
+	return *this;
+}
+
+//-----------------------------------------------------------------
+
+ColumnarFoo::~ColumnarFoo()
+{
+}
+
+//-----------------------------------------------------------------
+
+void ColumnarFoo::initSignatures()
+{
+	Attributed::initSignatures();
+
+	addSignature("health");
+	addSignature("speed");
+	addSignature("tag");
+	addSignature("position");
+	addSignature("transform");
+	addSignature("target");
+	addSignature("path");
+}
+
+//-----------------------------------------------------------------
+
+void ColumnarFoo::populate()
+{
+	Attributed::populate();
+
+	addColumnAttribute("health", 100);
+	addColumnAttribute("speed", 1.0f);
+	addColumnAttribute("tag", "foo");
+	addColumnAttribute("position", vec4());
+	addColumnAttribute("transform", mat4x4());
+	addColumnAttribute("target", nullptr);
+	addColumnAttribute("path", vec4(), COLUMNAR_FOO_PATH_SIZE);
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Attributed.h"
+#include "RTTI.h"
+
+#define COLUMNAR_FOO_PATH_SIZE 4
+
+namespace UnitTests
+{
+	/**
+	 * Derived Attributed class whose prescribed
+	 * attributes are stored in shared columns.
+	 */
+	class ColumnarFoo : public DOGEngine::Attributed
+	{
+		RTTI_DECLARATIONS(ColumnarFoo, DOGEngine::Attributed)
+
+	public:
+
+		/**
+		 * @brief Constructor. Fills the list of prescribed
+		 *		  attribute names if it is empty, and populates
+		 *		  this object with default-valued prescribed
+		 *		  attributes.
+		 */
+		ColumnarFoo();
+
+		/**
+		 * @brief Copy constructor. The copy gets rows of its
+		 *		  own holding the same values.
+		 *
+		 * @param other The ColumnarFoo being copied.
+		 */
+		ColumnarFoo(const ColumnarFoo& other);
+
+		/**
+		 * @brief Copy assignment operator.
+		 *
+		 * @param other The ColumnarFoo being copied.
+		 *
+		 * @return Returns a reference to this ColumnarFoo.
+		 */
+		ColumnarFoo& operator=(const ColumnarFoo& other);
+
+		/**
+		 * @brief Virtual copy constructor. Deep copies
+		 *		  this object.
+		 *
+		 * @return Returns a deep copy of this object
+		 *		   as a pointer to a Scope
+		 */
+		virtual Scope* copy() override;
+
+		/**
+		 * @brief Move constructor. Takes over other's rows.
+		 *
+		 * @param other The ColumnarFoo being moved. It is
+		 *				reset to a default state.
+		 */
+		ColumnarFoo(ColumnarFoo&& other);
+
+		/**
+		 * @brief Move assignment operator.
+		 *
+		 * @param other The ColumnarFoo being moved. It is
+		 *				reset to a default state.
+		 *
+		 * @return Returns a reference to this ColumnarFoo.
+		 */
+		ColumnarFoo& operator=(ColumnarFoo&& other);
+
+		/**
+		 * @brief Destructor.
+		 */
+		virtual ~ColumnarFoo();
+
+	protected:
+
+		/**
+		 * @brief Builds this object's list of prescribed attributes.
+		 */
+		virtual void initSignatures() override;
+
+		/**
+		 * @brief Adds default-valued columnar attributes to this
+		 *		  object's table.
+		 */
+		virtual void populate() override;
+	};
+}
@@ -4,9 +4,11 @@
 
 #include "Foo.h"
 #include "Datum.h"
+#include "DatumMath.h"
 #include "Scope.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace std::chrono;
 using namespace DOGEngine;
 using namespace UnitTests;
 using namespace std;
@@ -273,6 +275,30 @@ namespace LibraryDesktopTest
 			otherDatum = datum;
 			testDatumEquivalency(datum, otherDatum);					// internal to internal
 
+			// enough values that the array can't be inline, whatever the size of a string
+			const uint32_t heapSize = arraySize * 4;
+
+			// assigning a heap array shares it, and assigning an inline one over our own array reuses ours
+			Datum longStrings, shortStrings, targetStrings;
+			const Datum& constLongStrings = longStrings;
+			const Datum& constTargetStrings = targetStrings;
+			for(uint32_t i = 0; i < heapSize; ++i)
+			{
+				longStrings.pushBack(strs[i % arraySize]);
+			}
+			shortStrings.pushBack(strs[0]);
+
+			targetStrings = longStrings;
+			Assert::IsTrue(targetStrings == longStrings);
+			Assert::IsTrue(constTargetStrings.data<string>() == constLongStrings.data<string>());
+			targetStrings.set(strs[0]);
+			Assert::IsTrue(constTargetStrings.data<string>() != constLongStrings.data<string>());
+
+			const string* targetData = constTargetStrings.data<string>();
+			targetStrings = shortStrings;
+			Assert::IsTrue(targetStrings == shortStrings);
+			Assert::IsTrue(constTargetStrings.data<string>() == targetData);
+
 			// verify that a type mismatch on scalar assignment throws an exception
 			Datum errorDatum(Datum::DatumType::Integer);
 			auto mismatchAssign = [&errorDatum]{ errorDatum = "hello"; };
@@ -288,6 +314,65 @@ namespace LibraryDesktopTest
 			ScalarDatumAssignmentTestHelper<Scope>(scopes, Datum::DatumType::Table);
 		}
 
+		TEST_METHOD(DatumCopyOnWrite)
+		{
+			// enough values that the array can't be inline, whatever the size of a string
+			const uint32_t heapSize = arraySize * 4;
+
+			Datum original;
+			const Datum& constOriginal = original;
+			for(uint32_t i = 0; i < heapSize; ++i)
+			{
+				original.pushBack(strs[i % arraySize]);
+			}
+
+			// copies share the heap array until one of them is written to
+			Datum copy(original);
+			const Datum& constCopy = copy;
+			Assert::IsTrue(constCopy.data<string>() == constOriginal.data<string>());
+			Assert::IsTrue(constCopy.get<string>(1) == constOriginal.get<string>(1));
+
+			copy.set(strs[0], 1);
+			Assert::IsTrue(constCopy.data<string>() != constOriginal.data<string>());
+			Assert::IsTrue(constOriginal.get<string>(1) == strs[1]);
+			Assert::IsTrue(constCopy.get<string>(1) == strs[0]);
+
+			// every write detaches, including growing, shrinking and removing
+			Datum pushed(original), popped(original), removed(original);
+			pushed.pushBack(strs[0]);
+			popped.popBack();
+			removed.remove(strs[0]);
+			Assert::IsTrue(constOriginal.size() == heapSize);
+			Assert::IsTrue(pushed.size() == heapSize + 1);
+			Assert::IsTrue(popped.size() == heapSize - 1);
+			Assert::IsTrue(removed.size() == heapSize - 1);
+			Assert::IsTrue(constOriginal.get<string>(0) == strs[0]);
+
+			// clearing a shared Datum leaves the values to the others
+			Datum cleared(original);
+			cleared.clear();
+			Assert::IsTrue(cleared.isEmpty());
+			Assert::IsTrue(constOriginal.size() == heapSize);
+			Assert::IsTrue(constOriginal.get<string>(heapSize - 1) == strs[arraySize - 1]);
+
+			// a Datum that handed out a mutable reference is deep copied, since the reference may still be written through
+			string& element = original.get<string>(2);
+			Datum aliasedCopy(original);
+			const Datum& constAliasedCopy = aliasedCopy;
+			Assert::IsTrue(constAliasedCopy.data<string>() != constOriginal.data<string>());
+			element = strs[0];
+			Assert::IsTrue(constAliasedCopy.get<string>(2) == strs[2]);
+
+			// Tables are never shared, since a Scope has a single parent
+			Datum tables;
+			for(uint32_t i = 0; i < arraySize; ++i)
+			{
+				tables.pushBack(scopes[i]);
+			}
+			Datum tablesCopy(tables);
+			Assert::IsTrue(tablesCopy == tables);
+		}
+
 		TEST_METHOD(DatumEqualityOperators)
 		{
 			// test Datum to Datum comparison
@@ -353,6 +438,59 @@ namespace LibraryDesktopTest
 			Assert::ExpectException<exception>(externalShrink);
 		}
 
+		TEST_METHOD(DatumInlineStorage)
+		{
+			// verify that values survive growing out of the inline buffer and shrinking back into it
+			Datum intDatum;
+			for(int32_t i = 0; i < 40; ++i)
+			{
+				intDatum.pushBack(i);
+				Assert::IsTrue(intDatum.get<int32_t>(0) == 0);
+				Assert::IsTrue(intDatum.get<int32_t>(i) == i);
+			}
+
+			while(intDatum.size() > 2)
+			{
+				intDatum.popBack();
+			}
+			intDatum.shrinkToFit();
+			Assert::IsTrue(intDatum.capacity() == 2);
+			Assert::IsTrue(intDatum.get<int32_t>(0) == 0);
+			Assert::IsTrue(intDatum.get<int32_t>(1) == 1);
+
+			// a single matrix is stored inline, a second spills to the heap
+			Datum matDatum;
+			matDatum.pushBack(mats[0]);
+			matDatum.pushBack(mats[1]);
+			Assert::IsTrue(matDatum.get<mat4x4>(0) == mats[0]);
+			Assert::IsTrue(matDatum.get<mat4x4>(1) == mats[1]);
+
+			// verify that moving an inline Datum carries its values over and leaves the original empty
+			Datum strDatum;
+			strDatum.pushBack(strs[0]);
+			strDatum.pushBack(strs[1]);
+
+			Datum movedDatum(std::move(strDatum));
+			Assert::IsTrue(strDatum.size() == 0);
+			Assert::IsTrue(strDatum.type() == Datum::DatumType::Unknown);
+			Assert::IsTrue(movedDatum.size() == 2);
+			Assert::IsTrue(movedDatum.get<string>(0) == strs[0]);
+			Assert::IsTrue(movedDatum.get<string>(1) == strs[1]);
+
+			Datum assignedDatum;
+			assignedDatum.pushBack(strs[2]);
+			assignedDatum = std::move(movedDatum);
+			Assert::IsTrue(movedDatum.size() == 0);
+			Assert::IsTrue(assignedDatum.size() == 2);
+			Assert::IsTrue(assignedDatum.get<string>(0) == strs[0]);
+
+			// verify that copies of inline Datums are independent
+			Datum copiedDatum(assignedDatum);
+			copiedDatum.set(strs[3]);
+			Assert::IsTrue(copiedDatum.get<string>(0) == strs[3]);
+			Assert::IsTrue(assignedDatum.get<string>(0) == strs[0]);
+		}
+
 		TEST_METHOD(DatumPushBack)
 		{
 			// verify that pushing back with a type mismatch throws an exception
@@ -450,6 +588,101 @@ namespace LibraryDesktopTest
 			SetStorageTestHelper<vec4, float>(vecs, floats, Datum::DatumType::Vector);
 		}
 
+		TEST_METHOD(DatumStridedStorage)
+		{
+			struct Particle
+			{
+				vec4 mPosition;
+				float mMass;
+				int32_t mId;
+			};
+
+			Particle particles[4];
+			for(int32_t i = 0; i < 4; ++i)
+			{
+				particles[i].mPosition = vecs[i];
+				particles[i].mMass = floats[i];
+				particles[i].mId = ints[i];
+			}
+
+			// verify that a strided view reads and writes one field of an array of structs
+			Datum massDatum;
+			massDatum.setStorage(&particles[0].mMass, 4, sizeof(Particle));
+			Assert::IsTrue(massDatum.isExternal());
+			Assert::IsTrue(massDatum.stride() == sizeof(Particle));
+			Assert::IsTrue(massDatum.size() == 4);
+			Assert::IsTrue(massDatum.get<float>(3) == floats[3]);
+
+			massDatum.set(10.0f, 2);
+			Assert::IsTrue(particles[2].mMass == 10.0f);
+			Assert::IsTrue(particles[2].mId == ints[2]);
+			Assert::IsTrue(&massDatum.get<float>(1) == &particles[1].mMass);
+
+			Datum positionDatum;
+			positionDatum.setStorage(&particles[0].mPosition, 4, sizeof(Particle));
+			Assert::IsTrue(positionDatum.get<vec4>(3) == vecs[3]);
+			Datum vectorDatum;
+			vectorDatum = vecs[1];
+			Assert::IsTrue(positionDatum.toString(1) == vectorDatum.toString());
+
+			positionDatum.setFromString("vec4(1.0, 2.0, 3.0, 4.0)", 1);
+			Assert::IsTrue(particles[1].mPosition == vec4(1.0f, 2.0f, 3.0f, 4.0f));
+
+			// verify that a stride of one element is a packed view, and compares equal to one
+			Datum packedDatum;
+			packedDatum.setStorage(ints, 4, sizeof(int32_t));
+			Assert::IsTrue(packedDatum.stride() == 0);
+
+			Datum idDatum;
+			idDatum.setStorage(&particles[0].mId, 4, sizeof(Particle));
+			Assert::IsTrue(idDatum == packedDatum);
+
+			// verify that copies of a strided view alias the same fields
+			Datum copiedDatum(massDatum);
+			Assert::IsTrue(copiedDatum.stride() == sizeof(Particle));
+			Assert::IsTrue(&copiedDatum.get<float>(3) == &particles[3].mMass);
+
+			Datum assignedDatum;
+			assignedDatum = massDatum;
+			Assert::IsTrue(assignedDatum == massDatum);
+
+			Datum movedDatum(std::move(copiedDatum));
+			Assert::IsTrue(movedDatum.stride() == sizeof(Particle));
+			Assert::IsTrue(copiedDatum.stride() == 0);
+			Assert::IsTrue(&movedDatum.get<float>(0) == &particles[0].mMass);
+
+			// verify that a strided view has no contiguous array for bulk operations
+			auto stridedData = [&massDatum]{ massDatum.data<float>(); };
+			Assert::ExpectException<exception>(stridedData);
+			auto stridedScale = [&massDatum]{ DatumMath::scale(massDatum, 2.0f); };
+			Assert::ExpectException<exception>(stridedScale);
+
+			// verify that overlapping elements are rejected
+			Datum overlapDatum;
+			auto overlappingStride = [&overlapDatum, &particles]{ overlapDatum.setStorage(&particles[0].mPosition, 4, sizeof(float)); };
+			Assert::ExpectException<exception>(overlappingStride);
+
+			// verify that rebinding keeps type, size and stride, and only moves the view
+			Particle otherParticles[4];
+			for(int32_t i = 0; i < 4; ++i)
+			{
+				otherParticles[i].mMass = floats[i] * 2.0f;
+			}
+
+			massDatum.rebindStorage(&otherParticles[0].mMass);
+			Assert::IsTrue(massDatum.type() == Datum::DatumType::Float);
+			Assert::IsTrue(massDatum.size() == 4);
+			Assert::IsTrue(massDatum.stride() == sizeof(Particle));
+			Assert::IsTrue(&massDatum.get<float>(3) == &otherParticles[3].mMass);
+			Assert::IsTrue(massDatum.get<float>(3) == floats[3] * 2.0f);
+
+			// verify that a Datum owning its memory cannot be rebound
+			Datum internalDatum;
+			internalDatum.pushBack(1);
+			auto internalRebind = [&internalDatum]{ internalDatum.rebindStorage(ints); };
+			Assert::ExpectException<exception>(internalRebind);
+		}
+
 		TEST_METHOD(DatumSet)
 		{
 			// verify that a type mismatch in set throws an exception
@@ -707,6 +940,296 @@ namespace LibraryDesktopTest
 			Assert::IsTrue(matDatum.get<glm::mat4x4>(2) == glm::mat4x4(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
 		}
 
+		TEST_METHOD(DatumStringConversion)
+		{
+			// verify that formatting matches std::to_string and glm::to_string exactly
+			Datum floatDatum;
+			for(int32_t i = -2000; i < 2000; ++i)
+			{
+				float value = i * 0.37f + i * i * 0.0013f;
+				floatDatum = value;
+				Assert::IsTrue(floatDatum.toString() == std::to_string(value));
+
+				// and that parsing it back gives the closest float
+				floatDatum.setFromString(std::to_string(value));
+				Assert::IsTrue(floatDatum.get<float>() == strtof(std::to_string(value).c_str(), nullptr));
+			}
+
+			const float specialFloats[] = { 0.0f, -0.0f, 1.0e-9f, -1.0e-9f, 0.0078125f, 123456789.0f, 3.0e20f, -3.0e20f };
+			for(const float& value : specialFloats)
+			{
+				floatDatum = value;
+				Assert::IsTrue(floatDatum.toString() == std::to_string(value));
+			}
+
+			Datum intDatum;
+			const int32_t specialInts[] = { 0, -1, 42, 2147483647, -2147483647 - 1 };
+			for(const int32_t& value : specialInts)
+			{
+				intDatum = value;
+				Assert::IsTrue(intDatum.toString() == std::to_string(value));
+
+				intDatum.setFromString(std::to_string(value));
+				Assert::IsTrue(intDatum.get<int32_t>() == value);
+			}
+
+			for(uint32_t i = 0; i < arraySize; ++i)
+			{
+				ToStringTestHelper<vec4>(vecs[i] * 0.3f, glm::to_string(vecs[i] * 0.3f));
+				ToStringTestHelper<mat4x4>(mats[i] * -1.7f, glm::to_string(mats[i] * -1.7f));
+			}
+
+			// exponents, signs, and spacing the old format strings allowed
+			floatDatum.setFromString("  -1.5e2");
+			Assert::IsTrue(floatDatum.get<float>() == -150.0f);
+			floatDatum.setFromString("2.5E-1");
+			Assert::IsTrue(floatDatum.get<float>() == 0.25f);
+			floatDatum.setFromString("0.1234567890123456789012345");
+			Assert::IsTrue(floatDatum.get<float>() == 0.1234567890123456789012345f);
+
+			// decimals just off a halfway point between two floats, which rounding through a double gets wrong
+			const char* halfwayFloats[] = { "0.04485466144979", "0.0007676491222810", "0.009776980150491" };
+			for(const char* value : halfwayFloats)
+			{
+				floatDatum.setFromString(value);
+				Assert::IsTrue(floatDatum.get<float>() == strtof(value, nullptr));
+			}
+
+			Datum vecDatum(Datum::DatumType::Vector);
+			vecDatum.pushBackFromString("vec4(1,-2.5, 3e1 ,4)");
+			Assert::IsTrue(vecDatum.get<vec4>() == vec4(1.0f, -2.5f, 30.0f, 4.0f));
+
+			// malformed values throw exceptions
+			auto badFloat = [&floatDatum]{ floatDatum.setFromString("abc"); };
+			Assert::ExpectException<exception>(badFloat);
+			auto badInt = [&intDatum]{ intDatum.pushBackFromString("-"); };
+			Assert::ExpectException<exception>(badInt);
+			auto badVector = [&vecDatum]{ vecDatum.pushBackFromString("vec4(1, 2, 3)"); };
+			Assert::ExpectException<exception>(badVector);
+			auto badMatrix = [&vecDatum]{ Datum matDatum(Datum::DatumType::Matrix); matDatum.pushBackFromString("mat4x4(1, 2)"); };
+			Assert::ExpectException<exception>(badMatrix);
+		}
+
+		TEST_METHOD(DatumPushBackArrayFromString)
+		{
+			// verify that every value in a comma separated list is pushed back
+			Datum intDatum(Datum::DatumType::Integer);
+			Assert::IsTrue(intDatum.pushBackArrayFromString(" 1, -2,3 ") == 3);
+			Assert::IsTrue(intDatum.size() == 3);
+			Assert::IsTrue(intDatum.get<int32_t>(0) == 1);
+			Assert::IsTrue(intDatum.get<int32_t>(1) == -2);
+			Assert::IsTrue(intDatum.get<int32_t>(2) == 3);
+
+			Datum floatDatum(Datum::DatumType::Float);
+			Assert::IsTrue(floatDatum.pushBackArrayFromString("0.5,1.25, 2") == 3);
+			Assert::IsTrue(floatDatum.get<float>(1) == 1.25f);
+
+			Datum strDatum(Datum::DatumType::String);
+			Assert::IsTrue(strDatum.pushBackArrayFromString("hello, world,again") == 3);
+			Assert::IsTrue(strDatum.get<string>(0) == "hello");
+			Assert::IsTrue(strDatum.get<string>(1) == "world");
+			Assert::IsTrue(strDatum.get<string>(2) == "again");
+
+			Datum vecDatum(Datum::DatumType::Vector);
+			Assert::IsTrue(vecDatum.pushBackArrayFromString("vec4(0, 1, 2, 3), vec4(4, 5, 6, 7)") == 2);
+			Assert::IsTrue(vecDatum.get<vec4>(1) == vec4(4, 5, 6, 7));
+
+			Datum matDatum(Datum::DatumType::Matrix);
+			Assert::IsTrue(matDatum.pushBackArrayFromString(glm::to_string(mats[0]) + ", " + glm::to_string(mats[1])) == 2);
+			Assert::IsTrue(matDatum.get<mat4x4>(0) == mats[0]);
+			Assert::IsTrue(matDatum.get<mat4x4>(1) == mats[1]);
+
+			// empty lists push nothing
+			Assert::IsTrue(intDatum.pushBackArrayFromString("  ") == 0);
+			Assert::IsTrue(strDatum.pushBackArrayFromString("") == 0);
+			Assert::IsTrue(intDatum.size() == 3);
+
+			// values before a malformed one stay pushed
+			auto missingComma = [&intDatum]{ intDatum.pushBackArrayFromString("4, 5 6"); };
+			Assert::ExpectException<exception>(missingComma);
+			Assert::IsTrue(intDatum.size() == 5);
+
+			// untyped, pointer, and table Datums throw exceptions
+			Datum untypedDatum;
+			auto untypedPush = [&untypedDatum]{ untypedDatum.pushBackArrayFromString("1"); };
+			Assert::ExpectException<exception>(untypedPush);
+			Datum pointerDatum(Datum::DatumType::Pointer);
+			auto pointerPush = [&pointerDatum]{ pointerDatum.pushBackArrayFromString("1"); };
+			Assert::ExpectException<exception>(pointerPush);
+			Datum tableDatum(Datum::DatumType::Table);
+			auto tablePush = [&tableDatum]{ tableDatum.pushBackArrayFromString("1"); };
+			Assert::ExpectException<exception>(tablePush);
+		}
+
+		TEST_METHOD(DatumData)
+		{
+			// verify that data points at the array get indexes into
+			Datum floatDatum;
+			floatDatum.pushBack(floats[0]);
+			floatDatum.pushBack(floats[1]);
+			Assert::IsTrue(floatDatum.data<float>() == &floatDatum.get<float>(0));
+			Assert::IsTrue(floatDatum.data<float>()[1] == floats[1]);
+
+			floatDatum.data<float>()[1] = 7.0f;
+			Assert::IsTrue(floatDatum.get<float>(1) == 7.0f);
+
+			const Datum& constDatum = floatDatum;
+			Assert::IsTrue(constDatum.data<float>() == floatDatum.data<float>());
+
+			// external data is returned as is
+			Datum externalDatum;
+			externalDatum.setStorage(vecs, arraySize);
+			Assert::IsTrue(externalDatum.data<vec4>() == vecs);
+
+			// type mismatch throws exception
+			auto mismatchedData = [&floatDatum]{ floatDatum.data<int32_t>(); };
+			Assert::ExpectException<exception>(mismatchedData);
+		}
+
+		TEST_METHOD(DatumMathOperations)
+		{
+			// verify each kernel against the same math done through glm, one element at a time
+			//		odd sizes, so the non-multiple-of-four tails are covered
+			Datum floatDatum, otherFloatDatum;
+			for(uint32_t i = 0; i < 11; ++i)
+			{
+				floatDatum.pushBack(static_cast<float>(i));
+				otherFloatDatum.pushBack(static_cast<float>(i) * 0.5f);
+			}
+
+			DatumMath::add(floatDatum, otherFloatDatum);
+			DatumMath::scale(floatDatum, 2.0f);
+			DatumMath::multiplyAdd(floatDatum, otherFloatDatum, 3.0f, 2, 5);
+			for(uint32_t i = 0; i < 11; ++i)
+			{
+				float expected = (i + i * 0.5f) * 2.0f;
+				if(i >= 2 && i < 7)
+				{
+					expected += i * 0.5f * 3.0f;
+				}
+				Assert::AreEqual(expected, floatDatum.get<float>(i), 0.0001f);
+			}
+
+			Datum vecDatum, velocityDatum;
+			for(uint32_t i = 0; i < arraySize; ++i)
+			{
+				vecDatum.pushBack(vecs[i]);
+				velocityDatum.pushBack(vec4(1.0f, -1.0f, 0.5f, 0.0f));
+			}
+
+			DatumMath::multiplyAdd(vecDatum, velocityDatum, 0.25f);
+			DatumMath::normalize(vecDatum);
+			for(uint32_t i = 0; i < arraySize; ++i)
+			{
+				vec4 expected = normalize(vecs[i] + vec4(1.0f, -1.0f, 0.5f, 0.0f) * 0.25f);
+				AssertNear(expected, vecDatum.get<vec4>(i));
+			}
+
+			// one matrix applied to every vector, then one matrix per vector
+			Datum matDatum;
+			matDatum.pushBack(mats[1]);
+
+			Datum transformedDatum(vecDatum);
+			DatumMath::transform(transformedDatum, matDatum);
+			for(uint32_t i = 0; i < arraySize; ++i)
+			{
+				AssertNear(mats[1] * vecDatum.get<vec4>(i), transformedDatum.get<vec4>(i));
+			}
+
+			Datum matsDatum;
+			for(uint32_t i = 0; i < arraySize; ++i)
+			{
+				matsDatum.pushBack(mats[i]);
+			}
+
+			transformedDatum = vecDatum;
+			DatumMath::transform(transformedDatum, matsDatum);
+			for(uint32_t i = 0; i < arraySize; ++i)
+			{
+				AssertNear(mats[i] * vecDatum.get<vec4>(i), transformedDatum.get<vec4>(i));
+			}
+
+			// left multiplying by the matrices, including a Datum by itself
+			Datum productDatum(matsDatum);
+			DatumMath::multiply(productDatum, matDatum);
+			DatumMath::multiply(productDatum, productDatum);
+			for(uint32_t i = 0; i < arraySize; ++i)
+			{
+				mat4x4 expected = mats[1] * mats[i];
+				expected = expected * expected;
+				for(uint32_t column = 0; column < 4; ++column)
+				{
+					AssertNear(expected[column], productDatum.get<mat4x4>(i)[column]);
+				}
+			}
+
+			// mismatched types, non-arithmetic types, and bad ranges throw exceptions
+			auto mismatchedAdd = [&floatDatum, &vecDatum]{ DatumMath::add(floatDatum, vecDatum); };
+			Assert::ExpectException<exception>(mismatchedAdd);
+
+			Datum intDatum;
+			intDatum.pushBack(ints[0]);
+			auto intScale = [&intDatum]{ DatumMath::scale(intDatum, 2.0f); };
+			Assert::ExpectException<exception>(intScale);
+
+			auto badRange = [&floatDatum]{ DatumMath::scale(floatDatum, 2.0f, 4, 8); };
+			Assert::ExpectException<exception>(badRange);
+
+			auto shortSource = [&vecDatum, &matsDatum]{ matsDatum.popBack(); DatumMath::transform(vecDatum, matsDatum); };
+			Assert::ExpectException<exception>(shortSource);
+		}
+
+		TEST_METHOD(DatumMathBenchmark)
+		{
+			// "position += velocity * dt" through get/set versus one bulk call
+			Datum positions, velocities;
+			for(uint32_t i = 0; i < sNumBenchmarkElements; ++i)
+			{
+				positions.pushBack(vec4(static_cast<float>(i)));
+				velocities.pushBack(vec4(1.0f, 2.0f, 3.0f, 0.0f));
+			}
+
+			high_resolution_clock::time_point start = high_resolution_clock::now();
+			for(uint32_t pass = 0; pass < sNumBenchmarkPasses; ++pass)
+			{
+				for(uint32_t i = 0; i < positions.size(); ++i)
+				{
+					positions.set(positions.get<vec4>(i) + velocities.get<vec4>(i) * 0.016f, i);
+				}
+			}
+			double elementSeconds = duration<double>(high_resolution_clock::now() - start).count();
+
+			start = high_resolution_clock::now();
+			for(uint32_t pass = 0; pass < sNumBenchmarkPasses; ++pass)
+			{
+				DatumMath::multiplyAdd(positions, velocities, 0.016f);
+			}
+			double bulkSeconds = duration<double>(high_resolution_clock::now() - start).count();
+
+			double nsPerElement = 1000000000.0 / (static_cast<double>(sNumBenchmarkElements) * sNumBenchmarkPasses);
+			stringstream results;
+			results << "Datum vec4 multiply-add benchmark (" << sNumBenchmarkElements << " elements, " << sNumBenchmarkPasses << " passes)\n";
+			results << "  get/set:                 " << elementSeconds * nsPerElement << " ns/element\n";
+			results << "  DatumMath::multiplyAdd:  " << bulkSeconds * nsPerElement << " ns/element\n";
+			Logger::WriteMessage(results.str().c_str());
+		}
+
+		TEST_METHOD(DatumDispatchBenchmark)
+		{
+			// copy, compare, and clear cost per element for every stored type
+			stringstream results;
+			results << "Datum dispatch benchmark (" << sNumBenchmarkElements << " elements, " << sNumBenchmarkPasses << " passes, ns/element copy | compare | clear)\n";
+			TimeDatumOperations<int32_t>(ints[1], "Integer", results);
+			TimeDatumOperations<float>(floats[1], "Float  ", results);
+			TimeDatumOperations<string>(strs[1], "String ", results);
+			RTTI* foo = foos[1];
+			TimeDatumOperations<RTTI*>(foo, "Pointer", results);
+			TimeDatumOperations<mat4x4>(mats[1], "Matrix ", results);
+			TimeDatumOperations<vec4>(vecs[1], "Vector ", results);
+			TimeDatumOperations<Scope>(scopes[1], "Table  ", results);
+			Logger::WriteMessage(results.str().c_str());
+		}
+
 	private:
 
 		void ConstructorTestHelper(Datum::DatumType type)
@@ -1163,6 +1686,45 @@ namespace LibraryDesktopTest
 			Assert::IsTrue(datum.toString() == expectedString);
 		}
 
+		template <typename T>
+		void TimeDatumOperations(T& value, const char* typeName, stringstream& results)
+		{
+			Datum source;
+			for(uint32_t i = 0; i < sNumBenchmarkElements; ++i)
+			{
+				source.pushBack(value);
+			}
+
+			double copySeconds = 0.0, compareSeconds = 0.0, clearSeconds = 0.0;
+			for(uint32_t pass = 0; pass < sNumBenchmarkPasses; ++pass)
+			{
+				high_resolution_clock::time_point start = high_resolution_clock::now();
+				Datum copy(source);
+				copySeconds += duration<double>(high_resolution_clock::now() - start).count();
+
+				start = high_resolution_clock::now();
+				bool isEqual = copy == source;
+				compareSeconds += duration<double>(high_resolution_clock::now() - start).count();
+				Assert::IsTrue(isEqual);
+
+				start = high_resolution_clock::now();
+				copy.clear();
+				clearSeconds += duration<double>(high_resolution_clock::now() - start).count();
+				Assert::IsTrue(copy.isEmpty());
+			}
+
+			double nsPerElement = 1000000000.0 / (static_cast<double>(sNumBenchmarkElements) * sNumBenchmarkPasses);
+			results << "  " << typeName << ": " << copySeconds * nsPerElement << " | " << compareSeconds * nsPerElement << " | " << clearSeconds * nsPerElement << "\n";
+		}
+
+		void AssertNear(const vec4& expected, const vec4& actual)
+		{
+			for(uint32_t i = 0; i < 4; ++i)
+			{
+				Assert::AreEqual(expected[i], actual[i], 0.001f * (1.0f + abs(expected[i])));
+			}
+		}
+
 		void testDatumEquivalency(const Datum& originalDatum, const Datum& copiedDatum)
 		{
 			// verify that all non-array members are the same
@@ -1189,6 +1751,9 @@ namespace LibraryDesktopTest
 		static mat4x4* mats;
 		static Scope* scopes;
 
+		static uint32_t sNumBenchmarkElements;
+		static uint32_t sNumBenchmarkPasses;
+
 	};
 
 	_CrtMemState DatumTest::sStartMemState;
@@ -1203,5 +1768,8 @@ namespace LibraryDesktopTest
 	vec4* DatumTest::vecs;
 	mat4x4* DatumTest::mats;
 	Scope* DatumTest::scopes;
+
+	uint32_t DatumTest::sNumBenchmarkElements = 10000;
+	uint32_t DatumTest::sNumBenchmarkPasses = 50;
 }
 
@@ -11,10 +11,7 @@ RTTI_DEFINITIONS(EntityFoo);
 EntityFoo::EntityFoo(const string& name) :
 	Entity(name)
 {
-	if(!areSignaturesInitialized())
-	{
-		initSignatures();
-	}
+	initSignaturesOnce();
 	populate();
 }
 
@@ -11,12 +11,18 @@
 #include "XmlParseHelperTable.h"
 #include "XmlParseHelperData.h"
 #include "SharedDataTable.h"
+#include "XmlSubfileCache.h"
 
 #include "WorldState.h"
 #include "World.h"
 #include "Sector.h"
 #include "Entity.h"
 
+#include "ActionList.h"
+#include "ActionCreateAction.h"
+#include "ActionDestroyAction.h"
+#include "JobSystem.h"
+
 #include "EntityFoo.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -34,6 +40,9 @@ namespace LibraryDesktopTest
 
 		TEST_METHOD_INITIALIZE(Initialize)
 		{
+			// the shared job system starts its worker threads on first use, so that happens before the memory snapshot
+			JobSystem::instance();
+
 #ifdef _DEBUG
 			// grab snapshot of memory state at start of test
 			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
@@ -51,9 +60,6 @@ namespace LibraryDesktopTest
 
 			Attributed::clearAttributeCache();
 
-			XmlParseHelperData::clearHandlerCache();
-			XmlParseHelperTable::clearHandlerCache();
-
 #ifdef _DEBUG
 			_CrtMemState endMemState, diffMemState;
 
@@ -157,6 +163,36 @@ namespace LibraryDesktopTest
 			}
 		}
 
+		TEST_METHOD(EntityWorldArena)
+		{
+			ActionList::ActionListFactory actionListFactory;
+
+			World* world = new World("World");
+			Assert::IsTrue(world->getArena().bytesAllocated() == 0);
+
+			// Scopes created while the World's arena is active are stored in it
+			{
+				ScopeArena::Activation activation(world->getArena());
+				Sector* sector = world->createSector("Sector");
+				sector->createEntity("Entity", "Entity")->createAction("ActionList", "List");
+			}
+			size_t bytesAllocated = world->getArena().bytesAllocated();
+			Assert::IsTrue(bytesAllocated > 0);
+
+			// the arena moves with the Scopes stored in it
+			World movedWorld(std::move(*world));
+			Assert::IsTrue(movedWorld.getArena().bytesAllocated() == bytesAllocated);
+			Assert::IsTrue(world->getArena().bytesAllocated() == 0);
+			delete world;
+
+			Assert::IsTrue(movedWorld.getSectors().size() == 1);
+			Assert::IsTrue(movedWorld.getSectors()[0]["entities"][0]["actions"].size() == 1);
+
+			// heap Scopes may still be added, and are deleted as usual when the arena's Scopes are destroyed
+			movedWorld.getSectors()[0].As<Sector>()->createEntity("Entity", "HeapEntity");
+			Assert::IsTrue(movedWorld.getArena().bytesAllocated() == bytesAllocated);
+		}
+
 		TEST_METHOD(EntityWorldCreateSector)
 		{
 			// worlds have empty sectors datum at start
@@ -280,6 +316,119 @@ namespace LibraryDesktopTest
 			delete world;
 		}
 
+		TEST_METHOD(EntityUpdateBenchmark)
+		{
+			// walks world -> sectors -> entities -> actions, resolving each child collection by string, by symbol and by cached pointer
+			EntityUpdateBenchmarkHelper();
+		}
+
+		TEST_METHOD(EntityDestroyBenchmark)
+		{
+			World world;
+			Sector& sector = *world.createSector("Sector");
+			Vector<Entity*> doomed(sNumBenchmarkDestroyEntities / 2);
+			for(uint32_t i = 0; i < sNumBenchmarkDestroyEntities; ++i)
+			{
+				Entity* entity = sector.createEntity("Entity", "Entity_" + to_string(i));
+				if(i % 2 == 0)
+				{
+					doomed.pushBack(entity);
+				}
+			}
+
+			// half the sector is queued for deletion in one frame...
+			PendingDelete& pendingDelete = world.getPendingDelete();
+			high_resolution_clock::time_point start = high_resolution_clock::now();
+			for(Entity* entity : doomed)
+			{
+				pendingDelete.enqueue(*entity);
+			}
+			duration<double, std::milli> enqueueTime = high_resolution_clock::now() - start;
+
+			// ...and deleted when the queue empties at the end of it
+			start = high_resolution_clock::now();
+			pendingDelete.empty();
+			duration<double, std::milli> destroyTime = high_resolution_clock::now() - start;
+
+			// the survivors are all still reachable, and each still knows where it is stored
+			Datum& entities = sector.getEntities();
+			Assert::IsTrue(entities.size() == sNumBenchmarkDestroyEntities - doomed.size());
+			for(uint32_t i = 0; i < entities.size(); ++i)
+			{
+				Assert::IsTrue(sector.findName(&entities[i]) == Sector::sEntitiesAttribute);
+			}
+
+			stringstream results;
+			results << "Entity destroy benchmark (" << doomed.size() << " of " << sNumBenchmarkDestroyEntities << " entities in one sector)\n";
+			results << "  Enqueue: " << enqueueTime.count() << " ms, " << enqueueTime.count() * 1000000.0 / doomed.size() << " ns/entity\n";
+			results << "  Destroy: " << destroyTime.count() << " ms, " << destroyTime.count() * 1000000.0 / doomed.size() << " ns/entity\n";
+			Logger::WriteMessage(results.str().c_str());
+		}
+
+		TEST_METHOD(EntityParseWorldBenchmark)
+		{
+			// load times for synthetic worlds of a few sizes, each built from the sectors in the full entity file
+			for(uint32_t megabytes : sBenchmarkWorldMegabytes)
+			{
+				ParseWorldBenchmarkHelper(megabytes);
+			}
+		}
+
+		TEST_METHOD(EntityParallelUpdate)
+		{
+			ActionList::ActionListFactory actionListFactory;
+			ActionCreateAction::ActionCreateActionFactory createActionFactory;
+			ActionDestroyAction::ActionDestroyActionFactory destroyActionFactory;
+
+			World serialWorld;
+			World parallelWorld;
+			BuildParallelUpdateWorld(serialWorld);
+			BuildParallelUpdateWorld(parallelWorld);
+
+			Assert::IsFalse(serialWorld.isParallelUpdate());
+			parallelWorld.setParallelUpdate(true);
+			Assert::IsTrue(parallelWorld.isParallelUpdate());
+
+			// the second frame runs over the actions created by the first
+			for(uint32_t frame = 0; frame < 2; ++frame)
+			{
+				serialWorld.update();
+				parallelWorld.update();
+
+				Assert::IsTrue(serialWorld.getPendingCreate().size() == 0);
+				Assert::IsTrue(parallelWorld.getPendingCreate().size() == 0);
+				Assert::IsTrue(ActionNames(serialWorld.getActions()) == ActionNames(parallelWorld.getActions()));
+
+				Datum& serialSectors = serialWorld.getSectors();
+				Datum& parallelSectors = parallelWorld.getSectors();
+				Assert::IsTrue(serialSectors.size() == parallelSectors.size());
+
+				for(uint32_t i = 0; i < serialSectors.size(); ++i)
+				{
+					Sector* serialSector = serialSectors[i].As<Sector>();
+					Sector* parallelSector = parallelSectors[i].As<Sector>();
+					Assert::IsTrue(ActionNames(serialSector->getActions()) == ActionNames(parallelSector->getActions()));
+
+					Datum& serialEntities = serialSector->getEntities();
+					Datum& parallelEntities = parallelSector->getEntities();
+					Assert::IsTrue(serialEntities.size() == parallelEntities.size());
+
+					for(uint32_t j = 0; j < serialEntities.size(); ++j)
+					{
+						Assert::IsTrue(ActionNames(serialEntities[j].As<Entity>()->getActions()) == ActionNames(parallelEntities[j].As<Entity>()->getActions()));
+					}
+				}
+			}
+
+			// and both match what the actions asked for
+			Assert::IsTrue(ActionNames(parallelWorld.getActions()) == "World_New ");
+
+			Sector* sector = parallelWorld.getSectors()[1].As<Sector>();
+			Assert::IsTrue(ActionNames(sector->getActions()) == "Sector_1_New ");
+			Assert::IsTrue(ActionNames(sector->getEntities()[6].As<Entity>()->getActions()) == "Keep Doomed Entity_1_6_New ");
+			Assert::IsTrue(ActionNames(sector->getEntities()[7].As<Entity>()->getActions()) == "Keep Entity_1_7_New ");
+		}
+
 		TEST_METHOD(EntityParseXml)
 		{
 			SharedDataTable sharedData;
@@ -383,6 +532,9 @@ namespace LibraryDesktopTest
 				World* world = extractedScope->As<World>();
 				Assert::IsTrue(world->getName() == "Test World");
 
+				// the subfile was parsed by a job, which loaded it into the World's arena
+				Assert::IsTrue(world->getArena().bytesAllocated() > 0);
+
 				Assert::IsTrue((*world)["sectors"].size() == 1);
 				Assert::IsTrue((*world)["sectors"][0].Is(Sector::TypeIdClass()));
 
@@ -413,6 +565,185 @@ namespace LibraryDesktopTest
 			}
 		}
 
+		TEST_METHOD(EntityParseXmlWorldsArenas)
+		{
+			SharedDataTable sharedData;
+			XmlParseMaster master(sharedData);
+
+			XmlParseHelperTable helperTable;
+			XmlParseHelperData helperData;
+			master.addHelper(helperTable);
+			master.addHelper(helperData);
+
+			Assert::IsTrue(master.parseFromFile(sXmlFile_Full));
+			World* sourceWorld = sharedData.extractScope()->As<World>();
+			Assert::IsTrue(master.parseFromFile(sXmlFile_Full));
+			World* targetWorld = sharedData.extractScope()->As<World>();
+
+			// a Sector loaded into one World's arena would be destroyed with it, so it can't simply move to another
+			Sector* sector = sourceWorld->getSectors()[0].As<Sector>();
+			auto expression = [targetWorld, sector]{ targetWorld->adopt(World::sSectorsAttribute, *sector); };
+			Assert::ExpectException<exception>(expression);
+			Assert::IsTrue(sector->getParent() == sourceWorld);
+			Assert::IsTrue(sourceWorld->getSectors().size() == 2);
+
+			// copied with the target's arena active, it outlives the World it came from
+			Scope* copiedSector = nullptr;
+			{
+				ScopeArena::Activation activation(targetWorld->getArena());
+				copiedSector = sector->copy();
+			}
+			targetWorld->adopt(World::sSectorsAttribute, *copiedSector);
+			delete sourceWorld;
+
+			Datum& sectors = targetWorld->getSectors();
+			Assert::IsTrue(sectors.size() == 3);
+			Assert::IsTrue(sectors[2].As<Sector>()->getName() == "Test Sector 1");
+			Assert::IsTrue(sectors[2].As<Sector>()->getEntities().size() == sectors[0].As<Sector>()->getEntities().size());
+			Assert::IsTrue(sectors[2].As<Sector>()->getWorld() == targetWorld);
+
+			delete targetWorld;
+		}
+
+		TEST_METHOD(EntityParseXmlSubfilesOrder)
+		{
+			SharedDataTable sharedData;
+			XmlParseMaster master(sharedData);
+
+			XmlParseHelperSubfile helperSubfile;
+			XmlParseHelperTable helperTable;
+			XmlParseHelperData helperData;
+			master.addHelper(helperSubfile);
+			master.addHelper(helperTable);
+			master.addHelper(helperData);
+
+			// subfiles are adopted after the inline entities, in the order they appear
+			Assert::IsTrue(master.parseFromFile(sXmlFile_SubfilesMixed));
+
+			Scope* extractedScope = sharedData.extractScope();
+			Sector* sector = extractedScope->As<Sector>();
+			Assert::IsTrue(sector != nullptr);
+
+			Datum& entities = sector->getEntities();
+			Assert::IsTrue(entities.size() == 4);
+			Assert::IsTrue(entities[0].As<Entity>()->getName() == "Inline Entity 1");
+			Assert::IsTrue(entities[1].As<Entity>()->getName() == "Inline Entity 2");
+			Assert::IsTrue(entities[2].As<Entity>()->getName() == "Test Entity 1");
+			Assert::IsTrue(entities[3].As<Entity>()->getName() == "Test Entity 2");
+			Assert::IsTrue(entities[2].getParent() == sector);
+			Assert::IsTrue((*entities[3].As<Entity>())["int"].get<int32_t>() == 200);
+
+			// reparsing with the same master starts from nothing
+			Assert::IsTrue(master.parseFromFile(sXmlFile_SubfilesMixed));
+			Assert::IsTrue(sharedData.getScope()->As<Sector>()->getEntities().size() == 4);
+
+			delete extractedScope;
+		}
+
+		TEST_METHOD(EntityParseSubfilesBenchmark)
+		{
+			ParseSubfilesBenchmarkHelper();
+		}
+
+		TEST_METHOD(EntityParseXmlSubfileCache)
+		{
+			XmlSubfileCache cache;
+
+			SharedDataTable sharedData;
+			XmlParseMaster master(sharedData);
+
+			XmlParseHelperSubfile helperSubfile(&cache);
+			XmlParseHelperTable helperTable;
+			XmlParseHelperData helperData;
+			master.addHelper(helperSubfile);
+			master.addHelper(helperTable);
+			master.addHelper(helperData);
+
+			// each file is parsed once, and every include of it is a separate copy
+			Assert::IsTrue(master.parseFromFile(sXmlFile_SubfilesRepeat));
+			Assert::IsTrue(cache.misses() == 2 && cache.hits() == 2 && cache.size() == 2);
+			{
+				Sector* sector = sharedData.getScope()->As<Sector>();
+				Datum& entities = sector->getEntities();
+				Assert::IsTrue(entities.size() == 4);
+				Assert::IsTrue(entities[0].As<Entity>()->getName() == "Test Entity 1");
+				Assert::IsTrue(entities[2].As<Entity>()->getName() == "Test Entity 2");
+				Assert::IsTrue(entities[3].As<Entity>()->getName() == "Test Entity 1");
+				Assert::IsTrue(&entities[0] != &entities[1] && &entities[0] != &entities[3]);
+				Assert::IsTrue(entities[1].getParent() == sector);
+
+				// copies are independent of each other
+				(*entities[0].As<Entity>())["int"] = 5;
+				Assert::IsTrue((*entities[1].As<Entity>())["int"].get<int32_t>() == 100);
+			}
+
+			// a second parse is served from the cache entirely
+			Assert::IsTrue(master.parseFromFile(sXmlFile_SubfilesRepeat));
+			Assert::IsTrue(cache.misses() == 2 && cache.hits() == 6);
+			Assert::IsTrue((*sharedData.getScope()->As<Sector>()->getEntities()[0].As<Entity>())["int"].get<int32_t>() == 100);
+
+			// invalidated files are parsed again
+			Assert::IsTrue(cache.invalidate(sXmlFile_SubfileEntity));
+			Assert::IsFalse(cache.invalidate(sXmlFile_SubfileEntity));
+			Assert::IsTrue(cache.size() == 1);
+			Assert::IsTrue(master.parseFromFile(sXmlFile_SubfilesRepeat));
+			Assert::IsTrue(cache.misses() == 3 && cache.hits() == 9);
+
+			// nested includes go through the same cache
+			Assert::IsTrue(master.parseFromFile(sXmlFile_Subfiles));
+			Assert::IsTrue(cache.misses() == 4 && cache.hits() == 11 && cache.size() == 3);
+			Assert::IsTrue(sharedData.getScope()->As<World>()->getSectors()[0].As<Sector>()->getEntities().size() == 2);
+
+			cache.clear();
+			cache.resetCounters();
+			Assert::IsTrue(cache.size() == 0 && cache.hits() == 0 && cache.misses() == 0);
+		}
+
+		TEST_METHOD(EntityParseXmlSubfileCacheStale)
+		{
+			XmlSubfileCache cache;
+
+			SharedDataTable sharedData;
+			XmlParseMaster master(sharedData);
+
+			XmlParseHelperSubfile helperSubfile(&cache);
+			XmlParseHelperTable helperTable;
+			XmlParseHelperData helperData;
+			master.addHelper(helperSubfile);
+			master.addHelper(helperTable);
+			master.addHelper(helperData);
+
+			{
+				ofstream root(sXmlFile_CacheRoot, ios::out | ios::binary | ios::trunc);
+				root << "<Sector name=\"Sector\">\n<File path=\"" << sXmlFile_CachePrefab << "\" />\n</Sector>\n";
+			}
+			WritePrefab(1);
+
+			Assert::IsTrue(master.parseFromFile(sXmlFile_CacheRoot));
+			Assert::IsTrue((*sharedData.getScope()->As<Sector>()->getEntities()[0].As<Entity>())["int"].get<int32_t>() == 1);
+			Assert::IsTrue(master.parseFromFile(sXmlFile_CacheRoot));
+			Assert::IsTrue(cache.misses() == 1 && cache.hits() == 1);
+
+			// a rewritten file no longer matches its entry
+			WritePrefab(1000);
+			Assert::IsTrue(master.parseFromFile(sXmlFile_CacheRoot));
+			Assert::IsTrue((*sharedData.getScope()->As<Sector>()->getEntities()[0].As<Entity>())["int"].get<int32_t>() == 1000);
+			Assert::IsTrue(cache.misses() == 2 && cache.hits() == 1 && cache.size() == 1);
+
+			// a missing file is not cached, and fails the include
+			remove(sXmlFile_CachePrefab.c_str());
+			auto expression = [&master]{ master.parseFromFile(sXmlFile_CacheRoot); };
+			Assert::ExpectException<exception>(expression);
+			Assert::IsTrue(cache.misses() == 3 && cache.size() == 1);
+
+			remove(sXmlFile_CacheRoot.c_str());
+		}
+
+		TEST_METHOD(EntityParseSubfileCacheBenchmark)
+		{
+			ParseSubfileCacheBenchmarkHelper();
+		}
+
 	private:
 
 		template <typename DerivedT, typename BaseT>
@@ -478,6 +809,7 @@ namespace LibraryDesktopTest
 			Assert::IsTrue(&copiedObj["name"].get<string>() != &obj["name"].get<string>());
 
 			Assert::IsTrue(copiedObj == obj);
+			checkCachedTables(copiedObj);
 
 			// move constructor
 			T movedObj(std::move(obj));
@@ -489,6 +821,17 @@ namespace LibraryDesktopTest
 
 			Assert::IsTrue(movedObj != obj);
 			Assert::IsTrue(movedObj == copiedObj);
+			checkCachedTables(movedObj);
+			checkCachedTables(obj);
+
+			// cached tables survive the table growing
+			Datum* actions = &movedObj.getActions();
+			for(uint32_t i = 0; i < 64; ++i)
+			{
+				movedObj.append("aux_" + to_string(i)) = static_cast<int32_t>(i);
+			}
+			Assert::IsTrue(&movedObj.getActions() == actions);
+			checkCachedTables(movedObj);
 		}
 
 		template <typename T>
@@ -523,6 +866,394 @@ namespace LibraryDesktopTest
 
 			Assert::IsTrue(movedObj != obj);
 			Assert::IsTrue(movedObj == copiedObj);
+			checkCachedTables(copiedObj);
+			checkCachedTables(movedObj);
+			checkCachedTables(obj);
+		}
+
+		template <typename T>
+		void checkCachedTables(T& obj)
+		{
+			Assert::IsTrue(&obj.getActions() == obj.find("actions"));
+			Assert::IsTrue(&obj.getReactions() == obj.find("reactions"));
+		}
+
+		void BuildParallelUpdateWorld(World& world)
+		{
+			ActionCreateAction* worldCreate = world.createAction("ActionCreateAction", "Create")->As<ActionCreateAction>();
+			worldCreate->setClassName("ActionList");
+			worldCreate->setInstanceName("World_New");
+
+			// enough entities that each sector spans several jobs
+			for(uint32_t i = 0; i < 3; ++i)
+			{
+				Sector* sector = world.createSector("Sector_" + to_string(i));
+
+				ActionCreateAction* sectorCreate = sector->createAction("ActionCreateAction", "Create")->As<ActionCreateAction>();
+				sectorCreate->setClassName("ActionList");
+				sectorCreate->setInstanceName("Sector_" + to_string(i) + "_New");
+
+				for(uint32_t j = 0; j < 150; ++j)
+				{
+					Entity* entity = sector->createEntity("Entity", "Entity_" + to_string(j));
+					entity->createAction("ActionList", "Keep");
+					entity->createAction("ActionList", "Doomed");
+
+					ActionCreateAction* entityCreate = entity->createAction("ActionCreateAction", "Create")->As<ActionCreateAction>();
+					entityCreate->setClassName("ActionList");
+					entityCreate->setInstanceName("Entity_" + to_string(i) + "_" + to_string(j) + "_New");
+
+					// odd entities lose an action in the same frame they gain one
+					if(j % 2 == 1)
+					{
+						ActionDestroyAction* entityDestroy = entity->createAction("ActionDestroyAction", "Destroy")->As<ActionDestroyAction>();
+						entityDestroy->setDeleteTarget("Doomed");
+					}
+				}
+			}
+		}
+
+		string ActionNames(Datum& actions)
+		{
+			string names;
+			for(uint32_t i = 0; i < actions.size(); ++i)
+			{
+				names += actions[i].As<Action>()->getName() + " ";
+			}
+
+			return names;
+		}
+
+		template <typename TGetSectors, typename TGetEntities, typename TGetActions>
+		double TimeTraversal(World& world, TGetSectors getSectors, TGetEntities getEntities, TGetActions getActions, uint32_t& outNumVisited)
+		{
+			WorldState& worldState = world.getWorldState();
+			outNumVisited = 0;
+
+			high_resolution_clock::time_point start = high_resolution_clock::now();
+			for(uint32_t frame = 0; frame < sNumBenchmarkFrames; ++frame)
+			{
+				Datum& sectors = getSectors(world);
+				for(uint32_t i = 0; i < sectors.size(); ++i)
+				{
+					Sector& sector = static_cast<Sector&>(sectors[i]);
+					worldState.sector = &sector;
+
+					Datum& entities = getEntities(sector);
+					for(uint32_t j = 0; j < entities.size(); ++j)
+					{
+						Entity& entity = static_cast<Entity&>(entities[j]);
+						worldState.entity = &entity;
+
+						Datum& actions = getActions(entity);
+						for(uint32_t k = 0; k < actions.size(); ++k)
+						{
+							static_cast<Action*>(&actions[k])->update(worldState);
+						}
+						++outNumVisited;
+					}
+				}
+			}
+
+			return duration<double>(high_resolution_clock::now() - start).count();
+		}
+
+		void EntityUpdateBenchmarkHelper()
+		{
+			World world;
+			for(uint32_t i = 0; i < sNumBenchmarkSectors; ++i)
+			{
+				Sector* sector = world.createSector("Sector_" + to_string(i));
+				for(uint32_t j = 0; j < sNumBenchmarkEntities; ++j)
+				{
+					sector->createEntity("Entity", "Entity_" + to_string(j));
+				}
+			}
+
+			// previous path -- every collection is a string lookup every frame
+			uint32_t numByString;
+			double stringSeconds = TimeTraversal(world,
+				[](World& w) -> Datum& { return *w.find(World::sSectorsAttribute); },
+				[](Sector& sector) -> Datum& { return *sector.find(Sector::sEntitiesAttribute); },
+				[](Entity& entity) -> Datum& { return *entity.find(Entity::sActionsAttribute); },
+				numByString);
+
+			// interned keys
+			uint32_t numBySymbol;
+			double symbolSeconds = TimeTraversal(world,
+				[](World& w) -> Datum& { return *w.find(World::sSectorsSymbol); },
+				[](Sector& sector) -> Datum& { return *sector.find(Sector::sEntitiesSymbol); },
+				[](Entity& entity) -> Datum& { return *entity.find(Entity::sActionsSymbol); },
+				numBySymbol);
+
+			// cached pointers
+			uint32_t numByPointer;
+			double pointerSeconds = TimeTraversal(world,
+				[](World& w) -> Datum& { return w.getSectors(); },
+				[](Sector& sector) -> Datum& { return sector.getEntities(); },
+				[](Entity& entity) -> Datum& { return entity.getActions(); },
+				numByPointer);
+
+			// every path visits every entity every frame
+			uint32_t numExpected = sNumBenchmarkSectors * sNumBenchmarkEntities * sNumBenchmarkFrames;
+			Assert::IsTrue(numByString == numExpected);
+			Assert::IsTrue(numBySymbol == numExpected);
+			Assert::IsTrue(numByPointer == numExpected);
+
+			// and the real update still runs over the same tree
+			world.update();
+			Assert::IsTrue(world.getWorldState().entity == &world.getSectors()[sNumBenchmarkSectors - 1].As<Sector>()->getEntities()[sNumBenchmarkEntities - 1]);
+
+			stringstream results;
+			results << "Update traversal benchmark (" << sNumBenchmarkSectors << " sectors, " << sNumBenchmarkEntities << " entities each, " << sNumBenchmarkFrames << " frames)\n";
+			results << "  String lookup:  " << stringSeconds * 1000000000.0 / numExpected << " ns/entity\n";
+			results << "  Symbol lookup:  " << symbolSeconds * 1000000000.0 / numExpected << " ns/entity\n";
+			results << "  Cached pointer: " << pointerSeconds * 1000000000.0 / numExpected << " ns/entity\n";
+			Logger::WriteMessage(results.str().c_str());
+		}
+
+		void ParseWorldBenchmarkHelper(uint32_t megabytes)
+		{
+			ifstream file(sXmlFile_Full, ios::in | ios::binary);
+			stringstream contents;
+			contents << file.rdbuf();
+
+			// the world body is every sector in the file, repeated until the document is the requested size
+			string fileContents = contents.str();
+			size_t bodyStart = fileContents.find("<Sector");
+			size_t bodyEnd = fileContents.rfind("</Sector>") + string("</Sector>").size();
+			string body = fileContents.substr(bodyStart, bodyEnd - bodyStart) + "\n";
+			Assert::IsTrue(bodyStart != string::npos && !body.empty());
+
+			uint32_t numCopies = megabytes * 1024 * 1024 / static_cast<uint32_t>(body.size()) + 1;
+			string document = "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n<World name=\"Benchmark World\">\n";
+			document.reserve(numCopies * body.size() + 128);
+			for(uint32_t i = 0; i < numCopies; ++i)
+			{
+				document.append(body);
+			}
+			document.append("</World>\n");
+
+			{
+				ofstream world(sXmlFile_BenchmarkWorld, ios::out | ios::binary | ios::trunc);
+				world.write(document.data(), document.size());
+			}
+
+			SharedDataTable sharedData;
+			XmlParseMaster master(sharedData);
+
+			XmlParseHelperTable helperTable;
+			XmlParseHelperData helperData;
+			master.addHelper(helperTable);
+			master.addHelper(helperData);
+
+			// previous path -- the file is read through a 1 KB buffer and handed to expat a chunk at a time
+			high_resolution_clock::time_point start = high_resolution_clock::now();
+			{
+				ifstream world(sXmlFile_BenchmarkWorld, ios::in | ios::binary);
+				char buffer[1024];
+				bool isFirstChunk = true;
+				while(world)
+				{
+					world.read(buffer, sizeof(buffer));
+					Assert::IsTrue(master.parse(buffer, static_cast<uint32_t>(world.gcount()), !world, isFirstChunk));
+					isFirstChunk = false;
+				}
+			}
+			duration<double> chunkedTime = high_resolution_clock::now() - start;
+			delete sharedData.extractScope();
+
+			// the whole file in one call
+			start = high_resolution_clock::now();
+			Assert::IsTrue(master.parseFromFile(sXmlFile_BenchmarkWorld));
+			duration<double> wholeTime = high_resolution_clock::now() - start;
+
+			Scope* extractedScope = sharedData.extractScope();
+			World* world = extractedScope->As<World>();
+			Assert::IsTrue(world != nullptr);
+			Assert::IsTrue(world->getSectors().size() == numCopies * 2);
+			Entity* lastEntity = world->getSectors()[numCopies * 2 - 1].As<Sector>()->getEntities()[1].As<Entity>();
+			Assert::IsTrue((*lastEntity)["int"].get<int32_t>() == 400);
+			delete extractedScope;
+
+			remove(sXmlFile_BenchmarkWorld.c_str());
+
+			double documentMegabytes = document.size() / (1024.0 * 1024.0);
+			stringstream results;
+			results << "World load benchmark (" << documentMegabytes << " MB, " << numCopies * 2 << " sectors)\n";
+			results << "  1 KB chunks: " << chunkedTime.count() * 1000.0 << " ms, " << documentMegabytes / chunkedTime.count() << " MB/s\n";
+			results << "  Whole file:  " << wholeTime.count() * 1000.0 << " ms, " << documentMegabytes / wholeTime.count() << " MB/s\n";
+			Logger::WriteMessage(results.str().c_str());
+		}
+
+		void ParseSubfilesBenchmarkHelper()
+		{
+			ifstream file(sXmlFile_Full, ios::in | ios::binary);
+			stringstream contents;
+			contents << file.rdbuf();
+
+			// each sector is the entities of the last sector in the full entity file, repeated
+			string fileContents = contents.str();
+			size_t bodyStart = fileContents.find("<Entity", fileContents.rfind("<Sector"));
+			size_t bodyEnd = fileContents.rfind("</Entity>") + string("</Entity>").size();
+			Assert::IsTrue(bodyStart != string::npos);
+			string body = fileContents.substr(bodyStart, bodyEnd - bodyStart) + "\n";
+
+			uint32_t numCopies = sBenchmarkSubfileKilobytes * 1024 / static_cast<uint32_t>(body.size()) + 1;
+			string sectorBody;
+			sectorBody.reserve(numCopies * body.size());
+			for(uint32_t i = 0; i < numCopies; ++i)
+			{
+				sectorBody.append(body);
+			}
+
+			// one file per sector plus a root that includes them, and the same world inlined in a single file
+			const string header = "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n";
+			string root = header + "<World name=\"Benchmark World\">\n";
+			string inlined = root;
+			for(uint32_t i = 0; i < sNumBenchmarkSubfiles; ++i)
+			{
+				string sector = "<Sector name=\"Sector " + to_string(i) + "\">\n" + sectorBody + "</Sector>\n";
+
+				ofstream subfile(BenchmarkSubfileName(i), ios::out | ios::binary | ios::trunc);
+				subfile << header << sector;
+
+				root.append("<File path=\"" + BenchmarkSubfileName(i) + "\" />\n");
+				inlined.append(sector);
+			}
+			root.append("</World>\n");
+			inlined.append("</World>\n");
+
+			{
+				ofstream rootFile(sXmlFile_BenchmarkSubfileRoot, ios::out | ios::binary | ios::trunc);
+				rootFile << root;
+				ofstream inlinedFile(sXmlFile_BenchmarkWorld, ios::out | ios::binary | ios::trunc);
+				inlinedFile << inlined;
+			}
+
+			SharedDataTable sharedData;
+			XmlParseMaster master(sharedData);
+
+			XmlParseHelperSubfile helperSubfile;
+			XmlParseHelperTable helperTable;
+			XmlParseHelperData helperData;
+			master.addHelper(helperSubfile);
+			master.addHelper(helperTable);
+			master.addHelper(helperData);
+
+			high_resolution_clock::time_point start = high_resolution_clock::now();
+			Assert::IsTrue(master.parseFromFile(sXmlFile_BenchmarkWorld));
+			duration<double> inlinedTime = high_resolution_clock::now() - start;
+			delete sharedData.extractScope();
+
+			start = high_resolution_clock::now();
+			Assert::IsTrue(master.parseFromFile(sXmlFile_BenchmarkSubfileRoot));
+			duration<double> subfileTime = high_resolution_clock::now() - start;
+
+			// sectors land in the order they were included
+			Scope* extractedScope = sharedData.extractScope();
+			World* world = extractedScope->As<World>();
+			Assert::IsTrue(world != nullptr);
+			Assert::IsTrue(world->getSectors().size() == sNumBenchmarkSubfiles);
+			for(uint32_t i = 0; i < sNumBenchmarkSubfiles; ++i)
+			{
+				Sector* sector = world->getSectors()[i].As<Sector>();
+				Assert::IsTrue(sector->getName() == "Sector " + to_string(i));
+				Assert::IsTrue(sector->getEntities().size() == numCopies * 2);
+			}
+			delete extractedScope;
+
+			remove(sXmlFile_BenchmarkSubfileRoot.c_str());
+			remove(sXmlFile_BenchmarkWorld.c_str());
+			for(uint32_t i = 0; i < sNumBenchmarkSubfiles; ++i)
+			{
+				remove(BenchmarkSubfileName(i).c_str());
+			}
+
+			double documentMegabytes = inlined.size() / (1024.0 * 1024.0);
+			stringstream results;
+			results << "Subfile load benchmark (" << documentMegabytes << " MB, " << sNumBenchmarkSubfiles << " sector subfiles, " << JobSystem::instance().numWorkers() << " workers)\n";
+			results << "  Single file: " << inlinedTime.count() * 1000.0 << " ms\n";
+			results << "  Subfiles:    " << subfileTime.count() * 1000.0 << " ms\n";
+			Logger::WriteMessage(results.str().c_str());
+		}
+
+		void ParseSubfileCacheBenchmarkHelper()
+		{
+			// a prefab entity with a few dozen attributes, included many times by one sector
+			{
+				ofstream prefab(sXmlFile_CachePrefab, ios::out | ios::binary | ios::trunc);
+				prefab << "<Entity class=\"Entity\" name=\"Prefab\">\n";
+				for(uint32_t i = 0; i < 32; ++i)
+				{
+					prefab << "\t<Int name=\"int_" << i << "\" value=\"" << i << "\" />\n";
+					prefab << "\t<Float name=\"float_" << i << "\" value=\"" << i << ".5\" />\n";
+				}
+				prefab << "</Entity>\n";
+
+				ofstream root(sXmlFile_CacheRoot, ios::out | ios::binary | ios::trunc);
+				root << "<Sector name=\"Sector\">\n";
+				for(uint32_t i = 0; i < sNumBenchmarkPrefabIncludes; ++i)
+				{
+					root << "\t<File path=\"" << sXmlFile_CachePrefab << "\" />\n";
+				}
+				root << "</Sector>\n";
+			}
+
+			XmlSubfileCache cache;
+
+			SharedDataTable sharedData;
+			XmlParseMaster master(sharedData);
+
+			XmlParseHelperSubfile helperSubfile;
+			XmlParseHelperSubfile helperCachedSubfile(&cache);
+			XmlParseHelperTable helperTable;
+			XmlParseHelperData helperData;
+			master.addHelper(helperSubfile);
+			master.addHelper(helperTable);
+			master.addHelper(helperData);
+
+			high_resolution_clock::time_point start = high_resolution_clock::now();
+			Assert::IsTrue(master.parseFromFile(sXmlFile_CacheRoot));
+			duration<double> uncachedTime = high_resolution_clock::now() - start;
+			Assert::IsTrue(sharedData.getScope()->As<Sector>()->getEntities().size() == sNumBenchmarkPrefabIncludes);
+
+			master.removeHelper(helperSubfile);
+			master.addHelper(helperCachedSubfile);
+
+			start = high_resolution_clock::now();
+			Assert::IsTrue(master.parseFromFile(sXmlFile_CacheRoot));
+			duration<double> coldTime = high_resolution_clock::now() - start;
+			Assert::IsTrue(cache.misses() == 1 && cache.hits() == sNumBenchmarkPrefabIncludes - 1);
+
+			start = high_resolution_clock::now();
+			Assert::IsTrue(master.parseFromFile(sXmlFile_CacheRoot));
+			duration<double> warmTime = high_resolution_clock::now() - start;
+			Assert::IsTrue(cache.misses() == 1 && cache.hits() == sNumBenchmarkPrefabIncludes * 2 - 1);
+
+			Entity* last = sharedData.getScope()->As<Sector>()->getEntities()[sNumBenchmarkPrefabIncludes - 1].As<Entity>();
+			Assert::IsTrue((*last)["int_31"].get<int32_t>() == 31);
+
+			remove(sXmlFile_CachePrefab.c_str());
+			remove(sXmlFile_CacheRoot.c_str());
+
+			stringstream results;
+			results << "Subfile cache benchmark (" << sNumBenchmarkPrefabIncludes << " includes of one prefab entity)\n";
+			results << "  No cache:   " << uncachedTime.count() * 1000.0 << " ms\n";
+			results << "  Cold cache: " << coldTime.count() * 1000.0 << " ms\n";
+			results << "  Warm cache: " << warmTime.count() * 1000.0 << " ms\n";
+			Logger::WriteMessage(results.str().c_str());
+		}
+
+		void WritePrefab(int32_t value)
+		{
+			ofstream prefab(sXmlFile_CachePrefab, ios::out | ios::binary | ios::trunc);
+			prefab << "<Entity class=\"Entity\" name=\"Prefab\">\n<Int name=\"int\" value=\"" << value << "\" />\n</Entity>\n";
+		}
+
+		string BenchmarkSubfileName(uint32_t index)
+		{
+			return "entity_benchmark_sector_" + to_string(index) + ".xml";
 		}
 
 		//
@@ -533,10 +1264,42 @@ namespace LibraryDesktopTest
 
 		const static string sXmlFile_Full;
 		const static string sXmlFile_Subfiles;
+		const static string sXmlFile_BenchmarkWorld;
+		const static string sXmlFile_SubfilesMixed;
+		const static string sXmlFile_BenchmarkSubfileRoot;
+		const static string sXmlFile_SubfilesRepeat;
+		const static string sXmlFile_SubfileEntity;
+		const static string sXmlFile_CacheRoot;
+		const static string sXmlFile_CachePrefab;
+
+		static uint32_t sNumBenchmarkSectors;
+		static uint32_t sNumBenchmarkEntities;
+		static uint32_t sNumBenchmarkFrames;
+		static uint32_t sNumBenchmarkDestroyEntities;
+		static uint32_t sBenchmarkWorldMegabytes[3];
+		static uint32_t sNumBenchmarkSubfiles;
+		static uint32_t sBenchmarkSubfileKilobytes;
+		static uint32_t sNumBenchmarkPrefabIncludes;
 	};
 
 	_CrtMemState EntityTest::sStartMemState;
 	const string EntityTest::sXmlFile_Full = "assets/xml/Table_entity/entity_full.xml";
 	const string EntityTest::sXmlFile_Subfiles = "assets/xml/Table_entity/entity_subfile_root.xml";
+	const string EntityTest::sXmlFile_BenchmarkWorld = "entity_benchmark_world.xml";
+	const string EntityTest::sXmlFile_SubfilesMixed = "assets/xml/Table_entity/entity_subfile_mixed.xml";
+	const string EntityTest::sXmlFile_BenchmarkSubfileRoot = "entity_benchmark_subfile_root.xml";
+	const string EntityTest::sXmlFile_SubfilesRepeat = "assets/xml/Table_entity/entity_subfile_repeat.xml";
+	const string EntityTest::sXmlFile_SubfileEntity = "assets/xml/Table_entity/entity_subfile_entity_1.xml";
+	const string EntityTest::sXmlFile_CacheRoot = "entity_cache_root.xml";
+	const string EntityTest::sXmlFile_CachePrefab = "entity_cache_prefab.xml";
+
+	uint32_t EntityTest::sNumBenchmarkSectors = 10;
+	uint32_t EntityTest::sNumBenchmarkEntities = 1000;
+	uint32_t EntityTest::sNumBenchmarkFrames = 100;
+	uint32_t EntityTest::sNumBenchmarkDestroyEntities = 100000;
+	uint32_t EntityTest::sBenchmarkWorldMegabytes[3] = { 1, 10, 100 };
+	uint32_t EntityTest::sNumBenchmarkSubfiles = 64;
+	uint32_t EntityTest::sBenchmarkSubfileKilobytes = 256;
+	uint32_t EntityTest::sNumBenchmarkPrefabIncludes = 500;
 }
 
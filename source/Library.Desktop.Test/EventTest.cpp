@@ -8,6 +8,7 @@
 #include "Event.h"
 
 #include "EventQueue.h"
+#include "JobSystem.h"
 
 #include "Foo.h"
 #include "EntityFoo.h"
@@ -28,6 +29,9 @@ namespace LibraryDesktopTest
 
 		TEST_METHOD_INITIALIZE(Initialize)
 		{
+			// the shared job system starts its worker threads on first use, so that happens before the memory snapshot
+			JobSystem::instance();
+
 #ifdef _DEBUG
 			// grab snapshot of memory state at start of test
 			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
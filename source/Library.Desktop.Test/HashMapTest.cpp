@@ -4,8 +4,11 @@
 
 #include "Foo.h"
 #include "HashMap.h"
+#include "Vector.h"
+#include "Datum.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace std::chrono;
 using namespace DOGEngine;
 using namespace UnitTests;
 using namespace std;
@@ -1247,8 +1250,235 @@ namespace LibraryDesktopTest
 			Assert::IsTrue(hashmap != otherHashmap);
 		}
 
+		TEST_METHOD(HashMapRehash)
+		{
+			// verify that the map grows past its initial size and keeps its load factor bounded
+			// verify that references to stored pairs survive a rehash
+			// verify that removal leaves every remaining key reachable
+
+			HashMap<string, uint32_t> stringMap(2);
+			Assert::IsTrue(stringMap.capacity() == 0);
+
+			uint32_t& firstValue = stringMap["first"];
+			firstValue = 100;
+
+			for(uint32_t i = 0; i < 1000; ++i)
+			{
+				stringMap[to_string(i)] = i;
+				Assert::IsTrue(stringMap.loadFactor() <= 0.875f);
+			}
+
+			Assert::IsTrue(stringMap.size() == 1001);
+			Assert::IsTrue(&stringMap["first"] == &firstValue);
+			Assert::IsTrue(firstValue == 100);
+
+			// anagrams must not be treated as the same key
+			stringMap["ab"] = 1;
+			stringMap["ba"] = 2;
+			Assert::IsTrue(stringMap["ab"] == 1);
+			Assert::IsTrue(stringMap["ba"] == 2);
+
+			for(uint32_t i = 0; i < 1000; i += 2)
+			{
+				stringMap.remove(to_string(i));
+			}
+
+			for(uint32_t i = 0; i < 1000; ++i)
+			{
+				Assert::IsTrue(stringMap.containsKey(to_string(i)) == (i % 2 == 1));
+			}
+
+			uint32_t count = 0;
+			for(auto iter = stringMap.begin(); iter != stringMap.end(); ++iter)
+			{
+				++count;
+			}
+			Assert::IsTrue(count == stringMap.size());
+
+			// reserving up front means no rehash while filling
+			HashMap<uint32_t, uint32_t> primitiveMap;
+			primitiveMap.reserve(500);
+
+			uint32_t reservedCapacity = primitiveMap.capacity();
+			for(uint32_t i = 0; i < 500; ++i)
+			{
+				primitiveMap[i] = i;
+			}
+			Assert::IsTrue(primitiveMap.capacity() == reservedCapacity);
+
+			// rehash never shrinks below what the contents need
+			primitiveMap.rehash(1);
+			Assert::IsTrue(primitiveMap.capacity() >= 500);
+			for(uint32_t i = 0; i < 500; ++i)
+			{
+				Assert::IsTrue(primitiveMap[i] == i);
+			}
+
+			// emptying a map keeps its slots, so reserve() holds across clear and remove
+			uint32_t filledCapacity = primitiveMap.capacity();
+			primitiveMap.clear();
+			Assert::IsTrue(primitiveMap.capacity() == filledCapacity);
+			Assert::IsTrue(primitiveMap.find(1) == primitiveMap.end());
+
+			uint32_t numAllocations = primitiveMap.numHeapAllocations();
+			for(uint32_t i = 0; i < 100; ++i)
+			{
+				primitiveMap[1] = 1;
+				primitiveMap.remove(1);
+			}
+			Assert::IsTrue(primitiveMap.capacity() == filledCapacity);
+			Assert::IsTrue(primitiveMap.numHeapAllocations() == numAllocations);
+			Assert::IsTrue(primitiveMap.find(1) == primitiveMap.end());
+
+			// only shrinkToFit gives the storage back
+			primitiveMap[1] = 1;
+			primitiveMap.shrinkToFit();
+			Assert::IsTrue(primitiveMap.capacity() == 8);
+			Assert::IsTrue(primitiveMap[1] == 1);
+
+			primitiveMap.remove(1);
+			primitiveMap.shrinkToFit();
+			Assert::IsTrue(primitiveMap.capacity() == 0);
+			Assert::IsTrue(primitiveMap.find(1) == primitiveMap.end());
+
+			primitiveMap[2] = 2;
+			Assert::IsTrue(primitiveMap[2] == 2);
+		}
+
+		TEST_METHOD(HashMapAllocator)
+		{
+			// pairs come out of blocks, so far fewer allocations than pairs
+			HashMap<string, uint32_t> slabMap;
+			for(uint32_t i = 0; i < 100; ++i)
+			{
+				slabMap[to_string(i)] = i;
+			}
+			uint32_t numAllocations = slabMap.numHeapAllocations();
+			Assert::IsTrue(numAllocations > 0);
+			Assert::IsTrue(numAllocations < 10);
+
+			// removed pairs are recycled
+			for(uint32_t i = 0; i < 50; ++i)
+			{
+				slabMap.remove(to_string(i));
+			}
+			for(uint32_t i = 100; i < 150; ++i)
+			{
+				slabMap[to_string(i)] = i;
+			}
+			Assert::IsTrue(slabMap.numHeapAllocations() == numAllocations);
+			Assert::IsTrue(slabMap.size() == 100);
+
+			// moving keeps pairs where they are
+			uint32_t* value = &slabMap["120"];
+			HashMap<string, uint32_t> movedMap(std::move(slabMap));
+			Assert::IsTrue(&movedMap["120"] == value);
+			Assert::IsTrue(*value == 120);
+			Assert::IsTrue(slabMap.numHeapAllocations() == 0);
+			Assert::IsTrue(movedMap.numHeapAllocations() == numAllocations);
+
+			// a copy gets blocks of its own
+			HashMap<string, uint32_t> copiedMap(movedMap);
+			checkHashMapEquality(movedMap, copiedMap);
+			Assert::IsTrue(&copiedMap["120"] != value);
+			Assert::IsTrue(copiedMap.numHeapAllocations() > 0);
+
+			// emptying a map keeps its blocks for reuse, shrinkToFit hands them back
+			numAllocations = copiedMap.numHeapAllocations();
+			copiedMap.clear();
+			copiedMap["a"] = 1;
+			Assert::IsTrue(copiedMap.numHeapAllocations() == numAllocations);
+			copiedMap.clear();
+			copiedMap.shrinkToFit();
+			copiedMap["a"] = 1;
+			Assert::IsTrue(copiedMap.numHeapAllocations() == numAllocations + 1);
+
+			// the heap policy allocates per pair
+			HashMap<string, uint32_t, HashFunc<string>, CompareFunc<string>, HeapAllocator> heapMap;
+			for(uint32_t i = 0; i < 100; ++i)
+			{
+				heapMap[to_string(i)] = i;
+			}
+			Assert::IsTrue(heapMap.numHeapAllocations() == 100);
+			heapMap.remove("50");
+			Assert::IsFalse(heapMap.containsKey("50"));
+			Assert::IsTrue(heapMap.size() == 99);
+		}
+
+		TEST_METHOD(HashMapAllocatorBenchmark)
+		{
+			// lots of small attribute tables, the shape of a populated Scope tree
+			uint32_t heapAllocations, slabAllocations;
+			double heapBuildSeconds, slabBuildSeconds;
+			double heapIterateSeconds, slabIterateSeconds;
+
+			TimeTableWorkload<HeapAllocator>(heapAllocations, heapBuildSeconds, heapIterateSeconds);
+			TimeTableWorkload<SlabAllocator>(slabAllocations, slabBuildSeconds, slabIterateSeconds);
+
+			uint32_t numPairs = sNumBenchmarkTables * sNumBenchmarkAttributes;
+			Assert::IsTrue(heapAllocations == numPairs);
+			Assert::IsTrue(slabAllocations < heapAllocations);
+
+			uint32_t numVisited = numPairs * sNumBenchmarkPasses;
+
+			stringstream results;
+			results << "HashMap allocator benchmark (" << sNumBenchmarkTables << " tables, " << sNumBenchmarkAttributes << " attributes each, " << sNumBenchmarkPasses << " iteration passes)\n";
+			results << "  Heap: " << heapAllocations << " pair allocations, " << heapBuildSeconds * 1000000000.0 / numPairs << " ns/insert, " << numVisited / heapIterateSeconds / 1000000.0 << " M pairs/sec\n";
+			results << "  Slab: " << slabAllocations << " pair allocations, " << slabBuildSeconds * 1000000000.0 / numPairs << " ns/insert, " << numVisited / slabIterateSeconds / 1000000.0 << " M pairs/sec\n";
+			Logger::WriteMessage(results.str().c_str());
+		}
+
 	private:
 
+		template <template <typename> class TAllocator>
+		void TimeTableWorkload(uint32_t& outNumAllocations, double& outBuildSeconds, double& outIterateSeconds)
+		{
+			typedef HashMap<string, Datum, HashFunc<string>, CompareFunc<string>, TAllocator> TableMap;
+
+			Vector<string> names(sNumBenchmarkAttributes);
+			for(uint32_t i = 0; i < sNumBenchmarkAttributes; ++i)
+			{
+				names.pushBack("attribute_" + to_string(i));
+			}
+
+			Vector<TableMap*> tables(sNumBenchmarkTables);
+			high_resolution_clock::time_point start = high_resolution_clock::now();
+			for(uint32_t i = 0; i < sNumBenchmarkTables; ++i)
+			{
+				TableMap* table = new TableMap();
+				for(uint32_t j = 0; j < sNumBenchmarkAttributes; ++j)
+				{
+					(*table)[names[j]] = static_cast<int32_t>(j);
+				}
+				tables.pushBack(table);
+			}
+			outBuildSeconds = duration<double>(high_resolution_clock::now() - start).count();
+
+			int64_t sum = 0;
+			start = high_resolution_clock::now();
+			for(uint32_t pass = 0; pass < sNumBenchmarkPasses; ++pass)
+			{
+				for(uint32_t i = 0; i < sNumBenchmarkTables; ++i)
+				{
+					for(auto& pair : *tables[i])
+					{
+						sum += pair.second.get<int32_t>();
+					}
+				}
+			}
+			outIterateSeconds = duration<double>(high_resolution_clock::now() - start).count();
+
+			int64_t expectedSum = static_cast<int64_t>(sNumBenchmarkAttributes) * (sNumBenchmarkAttributes - 1) / 2 * sNumBenchmarkTables * sNumBenchmarkPasses;
+			Assert::IsTrue(sum == expectedSum);
+
+			outNumAllocations = 0;
+			for(uint32_t i = 0; i < sNumBenchmarkTables; ++i)
+			{
+				outNumAllocations += tables[i]->numHeapAllocations();
+				delete tables[i];
+			}
+		}
+
 		template <typename TKey, typename TValue, typename THash, typename TComp>
 		void checkHashMapEquality(HashMap<TKey, TValue, THash, TComp>& originalMap, HashMap<TKey, TValue, THash, TComp>& copiedMap)
 		{
@@ -1258,7 +1488,14 @@ namespace LibraryDesktopTest
 
 		static _CrtMemState sStartMemState;
 
+		static uint32_t sNumBenchmarkTables;
+		static uint32_t sNumBenchmarkAttributes;
+		static uint32_t sNumBenchmarkPasses;
 	};
 
 	_CrtMemState HashMapTest::sStartMemState;
+
+	uint32_t HashMapTest::sNumBenchmarkTables = 10000;
+	uint32_t HashMapTest::sNumBenchmarkAttributes = 16;
+	uint32_t HashMapTest::sNumBenchmarkPasses = 20;
 }
@@ -6,6 +6,7 @@
 #include "Sector.h"
 #include "Entity.h"
 #include "Event.h"
+#include "JobSystem.h"
 
 #include "EventArgs.h"
 #include "ActionEvent.h"
@@ -18,6 +19,7 @@
 #include "XmlParseHelperTable.h"
 #include "XmlParseHelperData.h"
 #include "SharedDataTable.h"
+#include "XmlSubfileCache.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace std::chrono;
@@ -32,6 +34,12 @@ namespace LibraryDesktopTest
 
 		TEST_METHOD_INITIALIZE(Initialize)
 		{
+			// the shared job system starts its worker threads on first use, so that happens before the memory snapshot
+			JobSystem::instance();
+
+			// the cleanup frees the subscriber index, so each test starts without one
+			Event<EventArgs>::unsubscribeAll();
+
 #ifdef _DEBUG
 			// grab snapshot of memory state at start of test
 			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
@@ -49,10 +57,9 @@ namespace LibraryDesktopTest
 			delete sReactionFactory;
 			delete sActionListFactory;
 			delete sActionCreateActionFactory;
+			Event<EventArgs>::unsubscribeAll();
 
 			Attributed::clearAttributeCache();
-			XmlParseHelperData::clearHandlerCache();
-			XmlParseHelperTable::clearHandlerCache();
 
 #ifdef _DEBUG
 			_CrtMemState endMemState, diffMemState;
@@ -308,6 +315,69 @@ namespace LibraryDesktopTest
 			Assert::IsTrue(Event<EventArgs>::numSubscribers() == 1);
 		}
 
+		TEST_METHOD(ReactionSubtypeRouting)
+		{
+			WorldState worldState;
+
+			// delivers an event with the "routed" subtype, carrying the given value
+			auto deliverRouted = [&worldState](int32_t value)
+			{
+				EventArgs args("routed");
+				args.setWorldState(worldState);
+				args.append("arg") = value;
+
+				Event<EventArgs> routedEvent(args);
+				Assert::IsTrue(routedEvent.subtype() == "routed");
+				routedEvent.deliver();
+			};
+
+			// only reactions handling the event's subtype are routed to
+			ReactionAttributed routed;
+			ReactionAttributed ignored;
+			routed.addSubtype("routed");
+			ignored.addSubtype("ignored");
+			Assert::IsTrue(Event<EventArgs>::numSubscribers() == 2);
+
+			deliverRouted(10);
+			Assert::IsTrue(routed["arg"] == 10);
+			Assert::IsTrue(ignored.find("arg") == nullptr);
+
+			// removing a duplicate subtype keeps the route, removing the last copy drops it
+			routed.addSubtype("routed");
+			Assert::IsTrue(routed.removeSubtype("routed"));
+			deliverRouted(20);
+			Assert::IsTrue(routed["arg"] == 20);
+
+			Assert::IsTrue(routed.removeSubtype("routed"));
+			deliverRouted(30);
+			Assert::IsTrue(routed["arg"] == 20);
+			Assert::IsTrue(Event<EventArgs>::numSubscribers() == 2);
+
+			// copies and moves route by their own subtypes
+			{
+				ReactionAttributed copied(ignored);
+				copied.addSubtype("routed");
+				Assert::IsTrue(Event<EventArgs>::numSubscribers() == 3);
+
+				ReactionAttributed moved(std::move(copied));
+				Assert::IsTrue(Event<EventArgs>::numSubscribers() == 4);
+
+				deliverRouted(40);
+				Assert::IsTrue(moved["arg"] == 40);
+				Assert::IsTrue(copied.find("arg") == nullptr);
+				Assert::IsTrue(ignored.find("arg") == nullptr);
+			}
+			Assert::IsTrue(Event<EventArgs>::numSubscribers() == 2);
+
+			// unsubscribing drops every route at once
+			ignored.addSubtype("routed");
+			Event<EventArgs>::unsubscribe(ignored);
+			Assert::IsTrue(Event<EventArgs>::numSubscribers() == 1);
+
+			deliverRouted(50);
+			Assert::IsTrue(ignored.find("arg") == nullptr);
+		}
+
 		TEST_METHOD(ActionEventUpdate)
 		{
 			World world;
@@ -405,6 +475,51 @@ namespace LibraryDesktopTest
 			Assert::IsTrue((*reaction_2)["arg_2"] == "world");
 		}
 
+		TEST_METHOD(ReactionNotifySharesPayload)
+		{
+			ActionEvent* action = new ActionEvent("ActionEvent");
+			ReactionAttributed* reaction_1 = new ReactionAttributed("Reaction");
+			ReactionAttributed* reaction_2 = new ReactionAttributed("Reaction");
+
+			// an argument too big for a Datum's inline buffer
+			action->setSubtype("type");
+			action->setDelay(1000);
+			Datum argument;
+			for(int32_t i = 0; i < 64; ++i)
+			{
+				argument.pushBack(i);
+			}
+			action->addAuxiliaryAttribute("arg") = argument;
+
+			reaction_1->addSubtype("type");
+			reaction_2->addSubtype("type");
+
+			World world;
+			world.adopt("actions", *action);
+			world.adopt("reaction", *reaction_1);
+			world.adopt("reaction", *reaction_2);
+
+			// enqueue, then remove the ActionEvent and deliver
+			world.update();
+			delete action;
+
+			GameTime& time = world.getWorldState().gameTime;
+			time.SetCurrentTime(time.CurrentTime() + milliseconds(1500));
+			world.update();
+			Assert::IsTrue(world.getEventQueue().size() == 0);
+
+			// both reactions read the array the action built, until one of them writes to it
+			const Datum& received_1 = *reaction_1->find("arg");
+			const Datum& received_2 = *reaction_2->find("arg");
+			Assert::IsTrue(received_1 == argument);
+			Assert::IsTrue(received_1.data<int32_t>() == received_2.data<int32_t>());
+
+			(*reaction_1)["arg"].set(-1, 3);
+			Assert::IsTrue(received_1.data<int32_t>() != received_2.data<int32_t>());
+			Assert::IsTrue(received_1.get<int32_t>(3) == -1);
+			Assert::IsTrue(received_2.get<int32_t>(3) == 3);
+		}
+
 		TEST_METHOD(ReactionAddSubtype)
 		{
 			ReactionAttributed reaction;
@@ -504,6 +619,122 @@ namespace LibraryDesktopTest
 			delete scope;
 		}
 
+		TEST_METHOD(ReactionXmlParseDeliver)
+		{
+			SharedDataTable tableData;
+			XmlParseMaster master(tableData);
+			XmlParseHelperSubfile subfileHelper;
+			XmlParseHelperTable tableHelper;
+			XmlParseHelperData dataHelper;
+			master.addHelper(subfileHelper);
+			master.addHelper(tableHelper);
+			master.addHelper(dataHelper);
+
+			Assert::IsTrue(master.parseFromFile(sReactionPath));
+			Scope* scope = master.getSharedData()->As<SharedDataTable>()->extractScope();
+
+			// every reaction subscribes to the subtypes from its String fields, not just its subtype attribute
+			Datum& worldReactions = (*scope)[World::sReactionsAttribute];
+			Sector* sector = (*scope)[World::sSectorsAttribute][0].As<Sector>();
+			Datum& sectorReactions = (*sector)[Sector::sReactionsAttribute];
+			Entity* entity = (*sector)[Sector::sEntitiesAttribute][0].As<Entity>();
+			Datum& entityReactions = (*entity)[Entity::sReactionsAttribute];
+			Datum& actionReactions = (*entity)[Entity::sActionsAttribute][0][Action::sReactionsAttribute];
+			Datum* reactionLists[] = { &worldReactions, &sectorReactions, &entityReactions, &actionReactions };
+
+			WorldState worldState;
+			auto deliver = [&worldState](const string& subtype, int32_t value)
+			{
+				EventArgs args(subtype);
+				args.setWorldState(worldState);
+				args.append("arg") = value;
+
+				Event<EventArgs> event(args);
+				event.deliver();
+			};
+
+			deliver("Other", 10);
+			for(Datum* reactions : reactionLists)
+			{
+				Assert::IsTrue((*reactions)[0]["arg"] == 10);
+				Assert::IsTrue((*reactions)[1]["arg"] == 10);
+			}
+
+			deliver("Subfile", 20);
+			deliver("Unhandled", 30);
+			for(Datum* reactions : reactionLists)
+			{
+				Assert::IsTrue((*reactions)[0]["arg"] == 10);
+				Assert::IsTrue((*reactions)[1]["arg"] == 20);
+			}
+
+			deliver("World", 40);
+			for(Datum* reactions : reactionLists)
+			{
+				Assert::IsTrue((*reactions)[0]["arg"] == 40);
+				Assert::IsTrue((*reactions)[1]["arg"] == 20);
+			}
+
+			delete scope;
+			Assert::IsTrue(Event<EventArgs>::numSubscribers() == 0);
+		}
+
+		TEST_METHOD(ReactionXmlSubfileCache)
+		{
+			XmlSubfileCache cache;
+
+			SharedDataTable tableData;
+			XmlParseMaster master(tableData);
+			XmlParseHelperSubfile subfileHelper(&cache);
+			XmlParseHelperTable tableHelper;
+			XmlParseHelperData dataHelper;
+			master.addHelper(subfileHelper);
+			master.addHelper(tableHelper);
+			master.addHelper(dataHelper);
+
+			WorldState worldState;
+			auto deliverSubfile = [&worldState](int32_t value)
+			{
+				EventArgs args("Subfile");
+				args.setWorldState(worldState);
+				args.append("arg") = value;
+
+				Event<EventArgs> event(args);
+				event.deliver();
+			};
+
+			// the subfile reaction is included four times, only the copies are subscribed
+			Assert::IsTrue(master.parseFromFile(sReactionPath));
+			Assert::IsTrue(cache.misses() == 1 && cache.hits() == 3);
+
+			Scope* scope = master.getSharedData()->As<SharedDataTable>()->extractScope();
+			Assert::IsTrue(Event<EventArgs>::numSubscribers() == 8);
+
+			deliverSubfile(10);
+			Datum& worldReactions = (*scope)[World::sReactionsAttribute];
+			Assert::IsTrue(worldReactions[1]["arg"] == 10);
+			delete scope;
+
+			// events fired while the prototype sits in the cache never reach it
+			Assert::IsTrue(cache.size() == 1);
+			Assert::IsTrue(Event<EventArgs>::numSubscribers() == 0);
+			deliverSubfile(20);
+
+			Assert::IsTrue(master.parseFromFile(sReactionPath));
+			Assert::IsTrue(cache.misses() == 1 && cache.hits() == 7);
+
+			scope = master.getSharedData()->As<SharedDataTable>()->extractScope();
+			Assert::IsTrue(Event<EventArgs>::numSubscribers() == 8);
+			Assert::IsTrue((*scope)[World::sReactionsAttribute][1].find("arg") == nullptr);
+
+			deliverSubfile(30);
+			Assert::IsTrue((*scope)[World::sReactionsAttribute][1]["arg"] == 30);
+			delete scope;
+
+			cache.clear();
+			Assert::IsTrue(Event<EventArgs>::numSubscribers() == 0);
+		}
+
 		TEST_METHOD(ReactionFactory)
 		{
 			// test factory registered
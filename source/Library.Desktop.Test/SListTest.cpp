@@ -4,8 +4,10 @@
 
 #include "Foo.h"
 #include "SList.h"
+#include "Vector.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace std::chrono;
 using namespace DOGEngine;
 using namespace UnitTests;
 using namespace std;
@@ -752,8 +754,141 @@ namespace LibraryDesktopTest
 			Assert::IsTrue(pointerList.isEmpty());
 		}
 
+		TEST_METHOD(SListAllocator)
+		{
+			// nodes come out of blocks, so far fewer allocations than nodes
+			SList<Foo> slabList;
+			for(int32_t i = 0; i < 100; ++i)
+			{
+				slabList.pushBack(Foo(i));
+			}
+			uint32_t numAllocations = slabList.numHeapAllocations();
+			Assert::IsTrue(numAllocations > 0);
+			Assert::IsTrue(numAllocations < 10);
+
+			// removed nodes are recycled
+			for(int32_t i = 0; i < 50; ++i)
+			{
+				slabList.popFront();
+			}
+			for(int32_t i = 0; i < 50; ++i)
+			{
+				slabList.pushFront(Foo(i));
+			}
+			Assert::IsTrue(slabList.numHeapAllocations() == numAllocations);
+			Assert::IsTrue(slabList.size() == 100);
+			Assert::IsTrue(slabList.front() == Foo(49));
+			Assert::IsTrue(slabList.back() == Foo(99));
+
+			// moving carries the blocks along with the nodes
+			SList<Foo> movedList(std::move(slabList));
+			Assert::IsTrue(slabList.numHeapAllocations() == 0);
+			Assert::IsTrue(movedList.numHeapAllocations() == numAllocations);
+			movedList.pushBack(Foo(100));
+			Assert::IsTrue(movedList.back() == Foo(100));
+
+			slabList = std::move(movedList);
+			Assert::IsTrue(slabList.size() == 101);
+			Assert::IsTrue(slabList.numHeapAllocations() == numAllocations);
+
+			// a copy gets blocks of its own
+			SList<Foo> copiedList(slabList);
+			CheckListEquivalency(slabList, copiedList);
+			Assert::IsTrue(copiedList.numHeapAllocations() > 0);
+
+			// emptying through popFront keeps the blocks, clear hands them back
+			while(!copiedList.isEmpty())
+			{
+				copiedList.popFront();
+			}
+			numAllocations = copiedList.numHeapAllocations();
+			copiedList.pushBack(Foo(0));
+			Assert::IsTrue(copiedList.numHeapAllocations() == numAllocations);
+
+			copiedList.clear();
+			copiedList.pushBack(Foo(0));
+			Assert::IsTrue(copiedList.numHeapAllocations() == numAllocations + 1);
+
+			// the heap policy allocates per node
+			SList<Foo, HeapAllocator> heapList;
+			for(int32_t i = 0; i < 100; ++i)
+			{
+				heapList.pushBack(Foo(i));
+			}
+			Assert::IsTrue(heapList.numHeapAllocations() == 100);
+			Assert::IsTrue(heapList.remove(Foo(50)));
+			Assert::IsTrue(heapList.find(Foo(50)) == heapList.end());
+			Assert::IsTrue(heapList.size() == 99);
+		}
+
+		TEST_METHOD(SListAllocatorBenchmark)
+		{
+			// several lists growing side by side, the way a busy heap interleaves them
+			uint32_t heapAllocations, slabAllocations;
+			double heapBuildSeconds, slabBuildSeconds;
+			double heapIterateSeconds, slabIterateSeconds;
+
+			TimeListWorkload<HeapAllocator>(heapAllocations, heapBuildSeconds, heapIterateSeconds);
+			TimeListWorkload<SlabAllocator>(slabAllocations, slabBuildSeconds, slabIterateSeconds);
+
+			Assert::IsTrue(heapAllocations == sNumBenchmarkLists * sNumBenchmarkElements);
+			Assert::IsTrue(slabAllocations < heapAllocations);
+
+			uint32_t numElements = sNumBenchmarkLists * sNumBenchmarkElements;
+			uint32_t numVisited = numElements * sNumBenchmarkPasses;
+
+			stringstream results;
+			results << "SList allocator benchmark (" << sNumBenchmarkLists << " lists, " << sNumBenchmarkElements << " elements each, " << sNumBenchmarkPasses << " iteration passes)\n";
+			results << "  Heap: " << heapAllocations << " allocations, " << heapBuildSeconds * 1000000000.0 / numElements << " ns/push, " << numVisited / heapIterateSeconds / 1000000.0 << " M elements/sec\n";
+			results << "  Slab: " << slabAllocations << " allocations, " << slabBuildSeconds * 1000000000.0 / numElements << " ns/push, " << numVisited / slabIterateSeconds / 1000000.0 << " M elements/sec\n";
+			Logger::WriteMessage(results.str().c_str());
+		}
+
 	private:
 
+		template <template <typename> class TAllocator>
+		void TimeListWorkload(uint32_t& outNumAllocations, double& outBuildSeconds, double& outIterateSeconds)
+		{
+			Vector<SList<int32_t, TAllocator>> lists(sNumBenchmarkLists);
+			for(uint32_t i = 0; i < sNumBenchmarkLists; ++i)
+			{
+				lists.pushBack(SList<int32_t, TAllocator>());
+			}
+
+			high_resolution_clock::time_point start = high_resolution_clock::now();
+			for(uint32_t j = 0; j < sNumBenchmarkElements; ++j)
+			{
+				for(uint32_t i = 0; i < sNumBenchmarkLists; ++i)
+				{
+					lists[i].pushBack(static_cast<int32_t>(j));
+				}
+			}
+			outBuildSeconds = duration<double>(high_resolution_clock::now() - start).count();
+
+			int64_t sum = 0;
+			start = high_resolution_clock::now();
+			for(uint32_t pass = 0; pass < sNumBenchmarkPasses; ++pass)
+			{
+				for(uint32_t i = 0; i < sNumBenchmarkLists; ++i)
+				{
+					for(int32_t value : lists[i])
+					{
+						sum += value;
+					}
+				}
+			}
+			outIterateSeconds = duration<double>(high_resolution_clock::now() - start).count();
+
+			int64_t expectedSum = static_cast<int64_t>(sNumBenchmarkElements) * (sNumBenchmarkElements - 1) / 2 * sNumBenchmarkLists * sNumBenchmarkPasses;
+			Assert::IsTrue(sum == expectedSum);
+
+			outNumAllocations = 0;
+			for(uint32_t i = 0; i < sNumBenchmarkLists; ++i)
+			{
+				outNumAllocations += lists[i].numHeapAllocations();
+			}
+		}
+
 		template <typename T>
 		void CheckListEquivalency(SList<T>& originalList, SList<T>& copiedList)
 		{
@@ -770,7 +905,14 @@ namespace LibraryDesktopTest
 
 		static _CrtMemState sStartMemState;
 
+		static uint32_t sNumBenchmarkLists;
+		static uint32_t sNumBenchmarkElements;
+		static uint32_t sNumBenchmarkPasses;
 	};
 
 	_CrtMemState SListTest::sStartMemState;
+
+	uint32_t SListTest::sNumBenchmarkLists = 8;
+	uint32_t SListTest::sNumBenchmarkElements = 20000;
+	uint32_t SListTest::sNumBenchmarkPasses = 20;
 }
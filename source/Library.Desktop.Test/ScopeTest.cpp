@@ -4,11 +4,14 @@
 
 #include "Foo.h"
 #include "Scope.h"
+#include "ScopeArena.h"
+#include "JobSystem.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace DOGEngine;
 using namespace UnitTests;
 using namespace std;
+using namespace std::chrono;
 
 namespace LibraryDesktopTest
 {
@@ -18,6 +21,19 @@ namespace LibraryDesktopTest
 
 		TEST_METHOD_INITIALIZE(Initialize)
 		{
+			// the shared job system starts its worker threads on first use, so that happens before the memory snapshot
+			JobSystem::instance();
+
+			// interned names live as long as the process, so the ones the tests use are interned before the memory snapshot
+			for(const char* name : { "value", "head_value", "name", "health", "late", "early" })
+			{
+				Symbol symbol(name);
+			}
+			for(uint32_t i = 0; i < 40; ++i)
+			{
+				Symbol symbol(to_string(i));
+			}
+
 #ifdef _DEBUG
 			// grab snapshot of memory state at start of test
 			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
@@ -104,6 +120,25 @@ namespace LibraryDesktopTest
 			Assert::IsTrue(*brothersScope == otherBrothersScope);
 			Assert::IsFalse(*brothersScope != otherBrothersScope);
 
+			// the copied Scopes are new, but their heap arrays are shared with the original until written to
+			Datum& scores = personScope_1->append("scores");
+			for(int32_t i = 0; i < 64; ++i)
+			{
+				scores.pushBack(i);
+			}
+
+			Scope* copiedBrothers = brothersScope->copy();
+			Scope& copiedOlder = (*copiedBrothers)["older"][0];
+			const Datum& copiedScores = copiedOlder["scores"];
+			const Datum& originalScores = scores;
+			Assert::IsTrue(&copiedOlder != personScope_1);
+			Assert::IsTrue(copiedScores.data<int32_t>() == originalScores.data<int32_t>());
+
+			copiedOlder["scores"].set(-1, 0);
+			Assert::IsTrue(copiedScores.get<int32_t>() == -1);
+			Assert::IsTrue(originalScores.get<int32_t>() == 0);
+
+			delete copiedBrothers;
 			delete brothersScope;
 		}
 
@@ -357,6 +392,41 @@ namespace LibraryDesktopTest
 			Assert::IsTrue(keyOwner == &middleScope);
 			Assert::IsTrue(keyDatum != nullptr);
 			Assert::IsTrue(*keyDatum == 300);
+
+			// a binding resolves once and is reused until the tree changes shape
+			Symbol valueSymbol("value");
+			Scope::Binding binding;
+			keyOwner = nullptr;
+			Assert::IsTrue(bottomScope.search(valueSymbol, binding, &keyOwner) == keyDatum);
+			Assert::IsTrue(keyOwner == &middleScope);
+			Assert::IsTrue(bottomScope.search(valueSymbol, binding) == keyDatum);
+
+			// a closer key shadows the bound one
+			bottomScope["value"] = 400;
+			Assert::IsTrue(bottomScope.search(valueSymbol, binding, &keyOwner) == bottomScope.find("value"));
+			Assert::IsTrue(keyOwner == &bottomScope);
+
+			// the same binding used from another Scope resolves from there
+			Assert::IsTrue(middleScope.search(valueSymbol, binding, &keyOwner) == keyDatum);
+			Assert::IsTrue(keyOwner == &middleScope);
+
+			// changes to another tree leave it alone
+			Scope otherTree;
+			otherTree["value"] = 500;
+			otherTree.appendScope("child");
+			Assert::IsTrue(middleScope.search(valueSymbol, binding, &keyOwner) == keyDatum);
+			Assert::IsTrue(keyOwner == &middleScope);
+
+			// reparenting invalidates it too
+			Scope& otherBottom = rootScope.appendScope("other");
+			Scope::Binding headBinding;
+			Symbol headSymbol("head_value");
+			Assert::IsTrue(otherBottom.search(headSymbol, headBinding, &keyOwner) == rootScope.find("head_value"));
+			Assert::IsTrue(keyOwner == &rootScope);
+			otherBottom.orphan();
+			Assert::IsTrue(otherBottom.search(headSymbol, headBinding, &keyOwner) == nullptr);
+			Assert::IsTrue(keyOwner == nullptr);
+			delete &otherBottom;
 		}
 
 		TEST_METHOD(ScopeFindName)
@@ -386,6 +456,13 @@ namespace LibraryDesktopTest
 			Assert::IsTrue(rootScope.findName(&child_1b) == "child_1");
 			Assert::IsTrue(rootScope.findName(&child_2) == "child_2");
 			Assert::IsTrue(child_2.findName(&child_bottom) == "child");
+
+			// a child moved by hand within its parent's Datum is still found
+			Datum& children = rootScope["child_1"];
+			children.set(child_1b, 0);
+			children.set(child_1a, 1);
+			Assert::IsTrue(rootScope.findName(&child_1a) == "child_1");
+			Assert::IsTrue(rootScope.findName(&child_1b) == "child_1");
 		}
 
 		TEST_METHOD(ScopeAppend)
@@ -580,6 +657,42 @@ namespace LibraryDesktopTest
 
 			// orphans are responsible for their own destruction (unless another Scope picks them up)
 			delete &bottomChild;
+
+			// the last sibling in the field takes an orphan's place
+			Scope& rootChild_1c = rootScope.appendScope("child");
+			Scope& rootChild_1d = rootScope.appendScope("child");
+			rootChild_1a.orphan();
+
+			Datum& children = rootScope["child"];
+			Assert::IsTrue(children.size() == 3);
+			Assert::IsTrue(&children[0] == &rootChild_1d);
+			Assert::IsTrue(&children[1] == &rootChild_1b);
+			Assert::IsTrue(&children[2] == &rootChild_1c);
+			delete &rootChild_1a;
+
+			// the moved sibling can itself be orphaned and renamed in constant time
+			Assert::IsTrue(rootScope.findName(&rootChild_1d) == "child");
+			rootChild_1d.orphan();
+			Assert::IsTrue(children.size() == 2);
+			Assert::IsTrue(&children[0] == &rootChild_1c);
+			Assert::IsTrue(&children[1] == &rootChild_1b);
+			Assert::IsTrue(rootScope.findName(&rootChild_1d) == "");
+
+			// re-adopting puts it at the back of its new field
+			rootScope.adopt("otherChild", rootChild_1d);
+			Assert::IsTrue(&rootScope["otherChild"][1] == &rootChild_1d);
+			Assert::IsTrue(rootScope.findName(&rootChild_1d) == "otherChild");
+			Assert::IsTrue(rootScope.findName(&rootChild_2) == "otherChild");
+
+			// children shifted or removed by editing the Datum directly are still orphaned cleanly
+			children.remove(rootChild_1c);
+			rootChild_1b.orphan();
+			Assert::IsTrue(children.isEmpty());
+			delete &rootChild_1b;
+
+			rootChild_1c.orphan();
+			Assert::IsTrue(rootChild_1c.getParent() == nullptr);
+			delete &rootChild_1c;
 		}
 
 		TEST_METHOD(ScopeToString)
@@ -673,6 +786,88 @@ namespace LibraryDesktopTest
 			Assert::IsTrue(childScope.isAncestor(*personScope_2));
 			Assert::IsTrue(childScope.isAncestor(*brothersScope));
 
+			// depths follow the tree
+			Assert::IsTrue(brothersScope->getDepth() == 0);
+			Assert::IsTrue(personScope_1->getDepth() == 1);
+			Assert::IsTrue(childScope.getDepth() == 2);
+
+			// reparenting a subtree updates everything below it
+			notRelated->adopt("person", *personScope_2);
+			Assert::IsTrue(childScope.getDepth() == 2);
+			Assert::IsTrue(childScope.isAncestor(*notRelated));
+			Assert::IsFalse(childScope.isAncestor(*brothersScope));
+
+			personScope_2->orphan();
+			Assert::IsTrue(personScope_2->getDepth() == 0);
+			Assert::IsTrue(childScope.getDepth() == 1);
+			Assert::IsTrue(childScope.isAncestor(*personScope_2));
+			Assert::IsFalse(childScope.isAncestor(*notRelated));
+			personScope_1->adopt("sibling", *personScope_2);
+			Assert::IsTrue(childScope.getDepth() == 3);
+			Assert::IsTrue(childScope.isAncestor(*brothersScope));
+
+			// chains deeper than the cached ancestors still answer correctly
+			Scope* deepScope = &childScope;
+			Vector<Scope*> chain(0);
+			for(uint32_t i = 0; i < 12; ++i)
+			{
+				chain.pushBack(deepScope);
+				deepScope = &deepScope->appendScope("deeper");
+			}
+			Assert::IsTrue(deepScope->getDepth() == 15);
+			for(Scope* ancestor : chain)
+			{
+				Assert::IsTrue(deepScope->isAncestor(*ancestor));
+				Assert::IsFalse(ancestor->isAncestor(*deepScope));
+			}
+			Assert::IsTrue(deepScope->isAncestor(*brothersScope));
+			Assert::IsFalse(deepScope->isAncestor(*notRelated));
+
+			Scope& deepCousin = chain[11]->appendScope("cousin");
+			Assert::IsFalse(deepScope->isAncestor(deepCousin));
+			Assert::IsTrue(deepCousin.isAncestor(*chain[10]));
+
+			// moving part of the chain keeps deep ancestry right on both sides of the inline ones
+			notRelated->adopt("chain", *chain[6]);
+			Assert::IsTrue(deepScope->getDepth() == 7);
+			Assert::IsTrue(deepScope->isAncestor(*notRelated));
+			Assert::IsTrue(deepScope->isAncestor(*chain[6]));
+			Assert::IsFalse(deepScope->isAncestor(*brothersScope));
+			Assert::IsFalse(deepScope->isAncestor(*chain[5]));
+			chain[5]->adopt("chain", *chain[6]);
+			Assert::IsTrue(deepScope->getDepth() == 15);
+			Assert::IsTrue(deepScope->isAncestor(*chain[5]));
+			Assert::IsTrue(deepScope->isAncestor(*brothersScope));
+			Assert::IsFalse(deepScope->isAncestor(*notRelated));
+
+			// a copy of the chain gets its ancestry from the top once it is built, so it roots its own tree
+			Scope* copiedChain = chain[2]->copy();
+			Scope* copiedDeep = copiedChain;
+			for(Datum* next = copiedDeep->find("deeper"); next != nullptr; next = copiedDeep->find("deeper"))
+			{
+				// chain[6] hangs off chain[5] under "chain" since it was moved back
+				copiedDeep = &(*next)[0];
+				if(copiedDeep->find("chain") != nullptr)
+				{
+					copiedDeep = &(*copiedDeep)["chain"][0];
+				}
+			}
+			Assert::IsTrue(copiedChain->getDepth() == 0);
+			Assert::IsTrue(copiedDeep->getDepth() == deepScope->getDepth() - chain[2]->getDepth());
+			Assert::IsTrue(copiedDeep->isAncestor(*copiedChain));
+			Assert::IsFalse(copiedDeep->isAncestor(*chain[2]));
+
+			notRelated->adopt("copy", *copiedChain);
+			Assert::IsTrue(copiedDeep->getDepth() == deepScope->getDepth() - chain[2]->getDepth() + 1);
+			Assert::IsTrue(copiedDeep->isAncestor(*notRelated));
+
+			// destroying the middle of the chain leaves the rest of the tree as it was
+			uint32_t depth = chain[7]->getDepth();
+			delete chain[8];
+			Assert::IsTrue(chain[7]->find("deeper")->isEmpty());
+			Assert::IsTrue(chain[7]->getDepth() == depth);
+			Assert::IsTrue(chain[7]->isAncestor(*brothersScope));
+
 			delete brothersScope;
 			delete notRelated;
 		}
@@ -704,8 +899,329 @@ namespace LibraryDesktopTest
 			delete brothersScope;
 		}
 
+		TEST_METHOD(ScopeSymbolLookup)
+		{
+			// interning is idempotent, and lookup never interns
+			Symbol nameSymbol("name");
+			Assert::IsTrue(nameSymbol == Symbol("name"));
+			Assert::IsTrue(nameSymbol != Symbol("health"));
+			Assert::IsTrue(nameSymbol.name() == "name");
+			Assert::IsTrue(Symbol::lookup("name") == nameSymbol);
+
+			uint32_t numSymbols = Symbol::numSymbols();
+			Assert::IsFalse(Symbol::lookup("not_interned").isValid());
+			Assert::IsTrue(Symbol::numSymbols() == numSymbols);
+
+			// invalid symbols name nothing
+			Symbol invalidSymbol;
+			Assert::IsFalse(invalidSymbol.isValid());
+			auto invalidName = [&invalidSymbol]{ invalidSymbol.name(); };
+			Assert::ExpectException<exception>(invalidName);
+
+			Scope scope;
+			Assert::IsTrue(scope.find(nameSymbol) == nullptr);
+			Assert::IsTrue(scope.find(invalidSymbol) == nullptr);
+			auto invalidAppend = [&scope, &invalidSymbol]{ scope.append(invalidSymbol); };
+			Assert::ExpectException<exception>(invalidAppend);
+
+			// symbol and string keys reach the same Datum
+			scope[nameSymbol] = "Justin";
+			scope.append("health") = 100;
+			Assert::IsTrue(scope.size() == 2);
+			Assert::IsTrue(scope.find(nameSymbol) == scope.find("name"));
+			Assert::IsTrue(&scope.append(nameSymbol) == scope.find("name"));
+			Assert::IsTrue(scope.size() == 2);
+
+			// a key added before its name was interned is still found by symbol
+			Symbol lateSymbol("late");
+			Scope lateScope;
+			lateScope["early"] = 1;
+			Symbol earlySymbol("early");
+			Assert::IsTrue(lateScope.find(earlySymbol) == lateScope.find("early"));
+			Assert::IsTrue(lateScope.find(lateSymbol) == nullptr);
+			Assert::IsTrue(&lateScope[earlySymbol] == lateScope.find("early"));
+			Assert::IsTrue(lateScope.size() == 1);
+
+			// keys past the id scan fall back on the string table
+			Scope bigScope;
+			for(uint32_t i = 0; i < 40; ++i)
+			{
+				bigScope[Symbol(to_string(i))] = static_cast<int32_t>(i);
+			}
+			for(uint32_t i = 0; i < 40; ++i)
+			{
+				Assert::IsTrue(*bigScope.find(Symbol(to_string(i))) == static_cast<int32_t>(i));
+			}
+			Assert::IsTrue(bigScope.find(lateSymbol) == nullptr);
+
+			// copies keep their symbols, and search walks the ancestry
+			Scope& childScope = scope.appendScope("child");
+			childScope["value"] = 5;
+			Scope copiedScope(scope);
+			Assert::IsTrue(*copiedScope.find(nameSymbol) == "Justin");
+
+			const Scope* foundScope = nullptr;
+			Scope& copiedChild = copiedScope["child"][0];
+			Assert::IsTrue(copiedChild.search(nameSymbol, &foundScope) == copiedScope.find(nameSymbol));
+			Assert::IsTrue(foundScope == &copiedScope);
+			Assert::IsTrue(copiedChild.search(lateSymbol) == nullptr);
+
+			// moving carries the symbols along
+			Scope movedScope(std::move(copiedScope));
+			Assert::IsTrue(*movedScope.find(nameSymbol) == "Justin");
+			Assert::IsTrue(copiedScope.find(nameSymbol) == nullptr);
+		}
+
+		TEST_METHOD(ScopeArenaAllocation)
+		{
+			ScopeArena arena;
+			Assert::IsTrue(ScopeArena::current() == nullptr);
+
+			// Scopes come from the heap when no arena is active
+			Scope* heapScope = new Scope();
+			Assert::IsTrue(arena.bytesAllocated() == 0);
+			Assert::IsTrue(arena.numBlocks() == 0);
+
+			Scope* root = nullptr;
+			{
+				ScopeArena::Activation activation(arena);
+				Assert::IsTrue(ScopeArena::current() == &arena);
+
+				root = new Scope();
+				size_t rootBytes = arena.bytesAllocated();
+				Assert::IsTrue(rootBytes > 0);
+				Assert::IsTrue(arena.numBlocks() == 1);
+
+				// appended children land in the active arena too
+				Scope& child = root->appendScope("child");
+				child["value"] = 10;
+				Assert::IsTrue(arena.bytesAllocated() > rootBytes);
+
+				// nested activations restore the outer arena when they end
+				ScopeArena innerArena;
+				{
+					ScopeArena::Activation innerActivation(innerArena);
+					Assert::IsTrue(ScopeArena::current() == &innerArena);
+
+					Scope* innerScope = new Scope();
+					Assert::IsTrue(innerArena.bytesAllocated() > 0);
+					delete innerScope;
+				}
+				Assert::IsTrue(ScopeArena::current() == &arena);
+
+				// heap and arena Scopes can be mixed in the same tree
+				root->adopt("adopted", *heapScope);
+				heapScope = nullptr;
+			}
+			Assert::IsTrue(ScopeArena::current() == nullptr);
+
+			Assert::IsTrue((*root)["child"][0]["value"] == 10);
+			Assert::IsTrue((*root)["adopted"].size() == 1);
+
+			// copies made outside the activation come from the heap
+			size_t bytesAllocated = arena.bytesAllocated();
+			Scope* copiedScope = new Scope(*root);
+			Assert::IsTrue(*copiedScope == *root);
+			Assert::IsTrue(arena.bytesAllocated() == bytesAllocated);
+			delete copiedScope;
+
+			// destructors still free what the Scopes own, the arena's storage is rewound all at once
+			delete root;
+			arena.reset();
+			Assert::IsTrue(arena.bytesAllocated() == 0);
+			Assert::IsTrue(arena.numBlocks() == 0);
+
+			// the next tree reuses the kept blocks
+			{
+				ScopeArena::Activation activation(arena);
+				root = new Scope();
+			}
+			Assert::IsTrue(arena.numBlocks() == 1);
+			delete root;
+			arena.release();
+			Assert::IsTrue(arena.bytesAllocated() == 0);
+			Assert::IsTrue(arena.numBlocks() == 0);
+
+			// oversized requests get a block of their own, which reset gives back
+			ScopeArena smallArena(64);
+			smallArena.allocate(16);
+			smallArena.allocate(256);
+			Assert::IsTrue(smallArena.numBlocks() == 2);
+			Assert::IsTrue(smallArena.bytesAllocated() == 272);
+
+			smallArena.reset();
+			smallArena.allocate(16);
+			Assert::IsTrue(smallArena.numBlocks() == 1);
+			Assert::IsTrue(smallArena.bytesAllocated() == 16);
+		}
+
+		TEST_METHOD(ScopeArenaDestroyScopes)
+		{
+			ScopeArena arena;
+			Scope* heapChild = new Scope();
+
+			Scope* root = nullptr;
+			{
+				ScopeArena::Activation activation(arena);
+
+				root = new Scope();
+				Scope& child = root->appendScope("child");
+				child["value"] = "owned by the Datum";
+
+				// a heap Scope in the middle of the tree, with an arena Scope below it again
+				child.adopt("heap", *heapChild);
+				heapChild->appendScope("grandchild")["value"] = "owned by the Datum";
+
+				// Scopes deleted on their own are not destroyed again
+				delete &root->appendScope("deleted");
+			}
+			Assert::IsFalse(arena.hasDestroyedScopes());
+
+			// every arena Scope is destroyed once, and the heap Scope is deleted by its arena parent
+			arena.reset();
+			Assert::IsFalse(arena.hasDestroyedScopes());
+			Assert::IsTrue(arena.bytesAllocated() == 0);
+			root = nullptr;
+			heapChild = nullptr;
+
+			// an owner outside the arena lets go of its destroyed children
+			Scope owner;
+			{
+				ScopeArena::Activation activation(arena);
+				owner.appendScope("loaded")["value"] = "owned by the Datum";
+				owner["loaded"][0].appendScope("nested");
+			}
+
+			arena.destroyScopes();
+			Assert::IsTrue(arena.hasDestroyedScopes());
+
+			owner.clear();
+			Assert::IsTrue(owner.size() == 0);
+
+			arena.release();
+			Assert::IsFalse(arena.hasDestroyedScopes());
+		}
+
+		TEST_METHOD(ScopeArenaJobs)
+		{
+			const uint32_t numJobs = 64;
+			Scope* roots[numJobs];
+
+			ScopeArena arena;
+			JobSystem::JobGroup group;
+
+			// jobs run with the arena that was active where they were submitted, and may allocate from it together
+			{
+				ScopeArena::Activation activation(arena);
+				for(uint32_t i = 0; i < numJobs; ++i)
+				{
+					group.submit([&roots, &arena, i]()
+					{
+						Assert::IsTrue(ScopeArena::current() == &arena);
+
+						roots[i] = new Scope();
+						for(uint32_t j = 0; j < 16; ++j)
+						{
+							roots[i]->appendScope("children")["value"] = static_cast<int32_t>(i);
+						}
+					});
+				}
+			}
+			group.wait();
+
+			Assert::IsTrue(ScopeArena::current() == nullptr);
+			for(uint32_t i = 0; i < numJobs; ++i)
+			{
+				Assert::IsTrue((*roots[i])["children"].size() == 16);
+				Assert::IsTrue((*roots[i])["children"][15]["value"] == static_cast<int32_t>(i));
+			}
+
+			// jobs submitted with no arena active use the heap
+			size_t bytesAllocated = arena.bytesAllocated();
+			Scope* heapScope = nullptr;
+			group.submit([&heapScope]()
+			{
+				Assert::IsTrue(ScopeArena::current() == nullptr);
+				heapScope = new Scope();
+			});
+			group.wait();
+
+			Assert::IsTrue(arena.bytesAllocated() == bytesAllocated);
+			delete heapScope;
+
+			arena.reset();
+		}
+
+		TEST_METHOD(ScopeArenaBenchmark)
+		{
+			duration<double, std::milli> heapBuildTime(0), heapTeardownTime(0);
+			duration<double, std::milli> arenaBuildTime(0), arenaTeardownTime(0);
+
+			// level reloads with every Scope on the heap
+			for(uint32_t reload = 0; reload < sNumBenchmarkReloads; ++reload)
+			{
+				high_resolution_clock::time_point start = high_resolution_clock::now();
+				Scope* root = buildBenchmarkTree();
+				heapBuildTime += high_resolution_clock::now() - start;
+
+				start = high_resolution_clock::now();
+				delete root;
+				heapTeardownTime += high_resolution_clock::now() - start;
+			}
+
+			// the same reloads, with the Scopes bumped out of one arena that is rewound between levels
+			ScopeArena arena;
+			for(uint32_t reload = 0; reload < sNumBenchmarkReloads; ++reload)
+			{
+				Scope* root = nullptr;
+
+				high_resolution_clock::time_point start = high_resolution_clock::now();
+				{
+					ScopeArena::Activation activation(arena);
+					root = buildBenchmarkTree();
+				}
+				arenaBuildTime += high_resolution_clock::now() - start;
+
+				// the reset destroys the whole tree in one pass
+				start = high_resolution_clock::now();
+				root = nullptr;
+				arena.reset();
+				arenaTeardownTime += high_resolution_clock::now() - start;
+			}
+			arena.release();
+
+			stringstream results;
+			results << "Scope tree reload, ms per level (" << sNumBenchmarkScopes << " Scopes)" << endl;
+			results << "  Heap build     : " << heapBuildTime.count() / sNumBenchmarkReloads << endl;
+			results << "  Heap teardown  : " << heapTeardownTime.count() / sNumBenchmarkReloads << endl;
+			results << "  Arena build    : " << arenaBuildTime.count() / sNumBenchmarkReloads << endl;
+			results << "  Arena teardown : " << arenaTeardownTime.count() / sNumBenchmarkReloads << endl;
+			Logger::WriteMessage(results.str().c_str());
+		}
+
 	private:
 
+		Scope* buildBenchmarkTree()
+		{
+			// a root of sectors, each holding a run of small entity-like Scopes
+			Scope* root = new Scope();
+			for(uint32_t i = 0; i < sNumBenchmarkScopes; ++i)
+			{
+				if(i % sNumBenchmarkChildren == 0)
+				{
+					root->appendScope("sectors");
+				}
+
+				Scope& sector = (*root)["sectors"][i / sNumBenchmarkChildren];
+				Scope& entity = sector.appendScope("entities");
+				entity["health"] = static_cast<int32_t>(i);
+				entity["speed"] = 1.0f;
+			}
+
+			return root;
+		}
+
+
 		void TestBrackets()
 		{
 			Datum datum, otherDatum;
@@ -770,8 +1286,15 @@ namespace LibraryDesktopTest
 
 		static _CrtMemState sStartMemState;
 
+		static uint32_t sNumBenchmarkScopes;
+		static uint32_t sNumBenchmarkChildren;
+		static uint32_t sNumBenchmarkReloads;
 	};
 
 	_CrtMemState ScopeTest::sStartMemState;
+
+	uint32_t ScopeTest::sNumBenchmarkScopes = 100000;
+	uint32_t ScopeTest::sNumBenchmarkChildren = 100;
+	uint32_t ScopeTest::sNumBenchmarkReloads = 4;
 }
 
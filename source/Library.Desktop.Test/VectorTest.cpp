@@ -6,6 +6,7 @@
 #include "Vector.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace std::chrono;
 using namespace DOGEngine;
 using namespace UnitTests;
 using namespace std;
@@ -532,6 +533,154 @@ namespace LibraryDesktopTest
 			Assert::IsTrue(otherPointerVector.capacity() == 1);
 		}
 
+		TEST_METHOD(VectorPushBackMove)
+		{
+			// verify that pushing back an rvalue moves it in instead of copying it
+			// verify that growing moves elements that can't be memcpy'd
+			// verify that pushing back an element of the Vector itself survives the growth
+
+			Vector<string> stringVector(1);
+			string longString(100, 'a');
+			stringVector.pushBack(std::move(longString));
+			Assert::IsTrue(longString.empty());
+			Assert::IsTrue(stringVector.back() == string(100, 'a'));
+
+			for(uint32_t i = 0; i < 20; ++i)
+			{
+				stringVector.pushBack(to_string(i) + string(50, 'b'));
+			}
+			Assert::IsTrue(stringVector.front() == string(100, 'a'));
+			Assert::IsTrue(stringVector[20] == "19" + string(50, 'b'));
+
+			CopyCounter::reset();
+			Vector<CopyCounter> counterVector(0);
+			for(int32_t i = 0; i < 100; ++i)
+			{
+				counterVector.pushBack(CopyCounter(i));
+			}
+			Assert::IsTrue(CopyCounter::sNumCopies == 0);
+			Assert::IsTrue(CopyCounter::sNumMoves > 100);
+			for(int32_t i = 0; i < 100; ++i)
+			{
+				Assert::IsTrue(counterVector[i].mValue == i);
+			}
+
+			// the copying pushBack still copies exactly once
+			CopyCounter counter(100);
+			counterVector.pushBack(counter);
+			Assert::IsTrue(CopyCounter::sNumCopies == 1);
+
+			Vector<string> selfVector(1);
+			selfVector.pushBack(string(100, 'c'));
+			Assert::IsTrue(selfVector.size() == selfVector.capacity());
+			selfVector.pushBack(selfVector[0]);
+			Assert::IsTrue(selfVector[1] == string(100, 'c'));
+		}
+
+		TEST_METHOD(VectorEmplaceBack)
+		{
+			// verify that emplacing constructs in place, with no copies or moves while there is room
+			// verify that emplacing grows the Vector like pushBack
+
+			CopyCounter::reset();
+			Vector<CopyCounter> counterVector(10);
+			for(int32_t i = 0; i < 10; ++i)
+			{
+				CopyCounter& counter = counterVector.emplaceBack(i);
+				Assert::IsTrue(&counter == &counterVector.back());
+			}
+			Assert::IsTrue(CopyCounter::sNumCopies == 0);
+			Assert::IsTrue(CopyCounter::sNumMoves == 0);
+
+			counterVector.emplaceBack(10);
+			Assert::IsTrue(counterVector.size() == 11);
+			Assert::IsTrue(counterVector.capacity() == 20);
+			Assert::IsTrue(CopyCounter::sNumCopies == 0);
+
+			Vector<pair<string, int32_t>> pairVector(0);
+			pairVector.emplaceBack("first", 1);
+			pairVector.emplaceBack("second", 2);
+			Assert::IsTrue(pairVector[0].first == "first");
+			Assert::IsTrue(pairVector[1].second == 2);
+
+			Vector<Foo> customVector(0);
+			customVector.emplaceBack(5);
+			Assert::IsTrue(customVector.back() == Foo(5));
+
+			// an element of the Vector can be an argument
+			Vector<Foo> selfVector(1);
+			selfVector.emplaceBack(7);
+			selfVector.emplaceBack(selfVector[0]);
+			Assert::IsTrue(selfVector[1] == Foo(7));
+		}
+
+		TEST_METHOD(VectorGrowth)
+		{
+			// verify that each growth strategy picks the capacities it promises
+
+			Vector<uint32_t> doubleVector(0);
+			uint32_t expectedCapacities[] = { 1, 2, 4, 4, 8 };
+			for(uint32_t i = 0; i < 5; ++i)
+			{
+				doubleVector.pushBack(i);
+				Assert::IsTrue(doubleVector.capacity() == expectedCapacities[i]);
+			}
+
+			Vector<uint32_t, HalfGrowth> halfVector(4);
+			for(uint32_t i = 0; i < 5; ++i)
+			{
+				halfVector.pushBack(i);
+			}
+			Assert::IsTrue(halfVector.capacity() == 6);
+
+			Vector<uint32_t, HalfGrowth> smallHalfVector(0);
+			smallHalfVector.pushBack(0);
+			smallHalfVector.pushBack(1);
+			Assert::IsTrue(smallHalfVector.capacity() == 2);
+
+			Vector<Foo, FixedGrowth<10>> fixedVector(0);
+			for(int32_t i = 0; i < 11; ++i)
+			{
+				fixedVector.pushBack(Foo(i));
+			}
+			Assert::IsTrue(fixedVector.capacity() == 20);
+			Assert::IsTrue(fixedVector[10] == Foo(10));
+
+			// copies and moves keep the strategy
+			Vector<Foo, FixedGrowth<10>> copiedVector(fixedVector);
+			Assert::IsTrue(copiedVector.capacity() == 20);
+			Vector<Foo, FixedGrowth<10>> movedVector(std::move(copiedVector));
+			Assert::IsTrue(movedVector.size() == 11);
+		}
+
+		TEST_METHOD(VectorGrowthBenchmark)
+		{
+			// copying vs moving inserts of heap-owning strings
+			uint32_t copyingCopies, movingCopies;
+			double copyingSeconds = TimeStringInserts(false, copyingCopies);
+			double movingSeconds = TimeStringInserts(true, movingCopies);
+			Assert::IsTrue(movingCopies == 0);
+			Assert::IsTrue(copyingCopies >= sNumBenchmarkElements);
+
+			// allocations and wasted space for each growth strategy
+			uint32_t doubleAllocations, halfAllocations, fixedAllocations;
+			uint32_t doubleCapacity, halfCapacity, fixedCapacity;
+			double doubleSeconds = TimeGrowth<DoubleGrowth>(doubleAllocations, doubleCapacity);
+			double halfSeconds = TimeGrowth<HalfGrowth>(halfAllocations, halfCapacity);
+			double fixedSeconds = TimeGrowth<FixedGrowth<4096>>(fixedAllocations, fixedCapacity);
+			Assert::IsTrue(doubleAllocations < halfAllocations);
+
+			stringstream results;
+			results << "Vector insert benchmark (" << sNumBenchmarkElements << " strings)\n";
+			results << "  pushBack(const T&): " << copyingCopies << " copies, " << copyingSeconds * 1000000000.0 / sNumBenchmarkElements << " ns/insert\n";
+			results << "  pushBack(T&&):      " << movingCopies << " copies, " << movingSeconds * 1000000000.0 / sNumBenchmarkElements << " ns/insert\n";
+			results << "Vector growth benchmark (" << sNumBenchmarkElements << " elements)\n";
+			results << "  Double:      " << doubleAllocations << " allocations, final capacity " << doubleCapacity << ", " << doubleSeconds * 1000000000.0 / sNumBenchmarkElements << " ns/insert\n";
+			results << "  Half:        " << halfAllocations << " allocations, final capacity " << halfCapacity << ", " << halfSeconds * 1000000000.0 / sNumBenchmarkElements << " ns/insert\n";
+			results << "  Fixed(4096): " << fixedAllocations << " allocations, final capacity " << fixedCapacity << ", " << fixedSeconds * 1000000000.0 / sNumBenchmarkElements << " ns/insert\n";
+			Logger::WriteMessage(results.str().c_str());
+		}
+
 		TEST_METHOD(VectorPopBack)
 		{
 			// verify that popping back reduces the list's size without memory leaks
@@ -1014,6 +1163,87 @@ namespace LibraryDesktopTest
 
 	private:
 
+		/**
+		 * Element type that counts how often it is copied
+		 * and moved.
+		 */
+		struct CopyCounter
+		{
+			explicit CopyCounter(int32_t value) : mValue(value) {}
+			CopyCounter(const CopyCounter& other) : mValue(other.mValue) { ++sNumCopies; }
+			CopyCounter(CopyCounter&& other) : mValue(other.mValue) { ++sNumMoves; }
+
+			static void reset() { sNumCopies = 0; sNumMoves = 0; }
+
+			int32_t mValue;
+
+			static uint32_t sNumCopies;
+			static uint32_t sNumMoves;
+		};
+
+		double TimeStringInserts(bool isMoving, uint32_t& outNumCopies)
+		{
+			// strings long enough to live on the heap
+			Vector<string> source(sNumBenchmarkElements);
+			for(uint32_t i = 0; i < sNumBenchmarkElements; ++i)
+			{
+				source.pushBack(to_string(i) + string(40, 'x'));
+			}
+
+			Vector<string> strings(0);
+			high_resolution_clock::time_point start = high_resolution_clock::now();
+			for(uint32_t i = 0; i < sNumBenchmarkElements; ++i)
+			{
+				if(isMoving)
+				{
+					strings.pushBack(std::move(source[i]));
+				}
+				else
+				{
+					strings.pushBack(source[i]);
+				}
+			}
+			double seconds = duration<double>(high_resolution_clock::now() - start).count();
+
+			Assert::IsTrue(strings.size() == sNumBenchmarkElements);
+			Assert::IsTrue(strings.back() == to_string(sNumBenchmarkElements - 1) + string(40, 'x'));
+
+			// a moved-from string is emptied, a copied one isn't
+			outNumCopies = 0;
+			for(uint32_t i = 0; i < sNumBenchmarkElements; ++i)
+			{
+				if(!source[i].empty())
+				{
+					++outNumCopies;
+				}
+			}
+
+			return seconds;
+		}
+
+		template <typename TGrowth>
+		double TimeGrowth(uint32_t& outNumAllocations, uint32_t& outCapacity)
+		{
+			Vector<uint32_t, TGrowth> values(0);
+			uint32_t lastCapacity = 0;
+			outNumAllocations = 0;
+
+			high_resolution_clock::time_point start = high_resolution_clock::now();
+			for(uint32_t i = 0; i < sNumBenchmarkElements; ++i)
+			{
+				values.pushBack(i);
+				if(values.capacity() != lastCapacity)
+				{
+					lastCapacity = values.capacity();
+					++outNumAllocations;
+				}
+			}
+			double seconds = duration<double>(high_resolution_clock::now() - start).count();
+
+			outCapacity = values.capacity();
+			return seconds;
+		}
+
 		template <typename T>
 		void checkVectorEquality(Vector<T>& originalList, Vector<T>& copiedList)
 		{
@@ -1196,7 +1426,13 @@ namespace LibraryDesktopTest
 
 		static _CrtMemState sStartMemState;
 
+		static uint32_t sNumBenchmarkElements;
 	};
 
 	_CrtMemState VectorTest::sStartMemState;
+
+	uint32_t VectorTest::CopyCounter::sNumCopies = 0;
+	uint32_t VectorTest::CopyCounter::sNumMoves = 0;
+
+	uint32_t VectorTest::sNumBenchmarkElements = 100000;
 }
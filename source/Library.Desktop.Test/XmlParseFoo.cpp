@@ -46,8 +46,9 @@ XmlParseFoo* XmlParseFoo::clone()
 
 //-----------------------------------------------------------------
 
-bool  XmlParseFoo::startElementHandler(SharedData& sharedData, const string& name, const AttributeMap& attributes)
+bool  XmlParseFoo::startElementHandler(SharedData& sharedData, const XmlElement& element, const XmlAttributes& attributes)
 {
+	const string& name = element.name();
 	UNREFERENCED_PARAMETER(attributes);
 
 	bool result = false;
@@ -69,8 +70,9 @@ bool  XmlParseFoo::startElementHandler(SharedData& sharedData, const string& nam
 
 //-----------------------------------------------------------------
 
-bool  XmlParseFoo::endElementHandler(SharedData& sharedData, const string& name)
+bool  XmlParseFoo::endElementHandler(SharedData& sharedData, const XmlElement& element)
 {
+	const string& name = element.name();
 	bool result = false;
 
 	SharedDataFoo* sharedFoo = sharedData.As<SharedDataFoo>();
@@ -92,7 +94,9 @@ bool  XmlParseFoo::endElementHandler(SharedData& sharedData, const string& name)
 void XmlParseFoo::clearHandlerCaches()
 {
 	sStartHandlers.clear();
+	sStartHandlers.shrinkToFit();
 	sEndHandlers.clear();
+	sEndHandlers.shrinkToFit();
 }
 
 #pragma endregion
@@ -101,7 +105,7 @@ void XmlParseFoo::clearHandlerCaches()
 
 #pragma region XmlParseFoo Private Parse Handlers
 
-void XmlParseFoo::startElementHandlerPerson(SharedDataFoo& sharedData, const AttributeMap& attributes)
+void XmlParseFoo::startElementHandlerPerson(SharedDataFoo& sharedData, const XmlAttributes& attributes)
 {
 	UNREFERENCED_PARAMETER(attributes);
 
@@ -110,12 +114,12 @@ void XmlParseFoo::startElementHandlerPerson(SharedDataFoo& sharedData, const Att
 
 //-----------------------------------------------------------------
 
-void XmlParseFoo::startElementHandlerString(SharedDataFoo& sharedData, const AttributeMap& attributes)
+void XmlParseFoo::startElementHandlerString(SharedDataFoo& sharedData, const XmlAttributes& attributes)
 {
-	for(auto& kvPair : attributes)
+	for(uint32_t i = 0; i < attributes.size(); ++i)
 	{
-		string& key = kvPair.first;
-		string& value = kvPair.second;
+		string key = attributes.nameAt(i);
+		string value = attributes.valueAt(i);
 
 		// append new property key, and push value to back
 		sharedData.mCurrentTable->append(key).pushBack(value);
@@ -124,12 +128,12 @@ void XmlParseFoo::startElementHandlerString(SharedDataFoo& sharedData, const Att
 
 //-----------------------------------------------------------------
 
-void XmlParseFoo::startElementHandlerInt(SharedDataFoo& sharedData, const AttributeMap& attributes)
+void XmlParseFoo::startElementHandlerInt(SharedDataFoo& sharedData, const XmlAttributes& attributes)
 {
-	for(auto& kvPair : attributes)
+	for(uint32_t i = 0; i < attributes.size(); ++i)
 	{
-		string& key = kvPair.first;
-		int32_t value = stoi(kvPair.second);
+		string key = attributes.nameAt(i);
+		int32_t value = stoi(attributes.valueAt(i));
 
 		// append new property key, and push value to back
 		sharedData.mCurrentTable->append(key).pushBack(value);
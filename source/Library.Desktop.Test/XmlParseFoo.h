@@ -26,9 +26,7 @@ namespace UnitTests
 
 	private:
 
-		typedef DOGEngine::HashMap<std::string, std::string> AttributeMap;
-
-		typedef std::function<void(XmlParseFoo&, SharedDataFoo&, const AttributeMap&)> StartElementHandler;
+		typedef std::function<void(XmlParseFoo&, SharedDataFoo&, const DOGEngine::XmlAttributes&)> StartElementHandler;
 		typedef std::function<void(XmlParseFoo&, SharedDataFoo&)> EndElementHandler;
 		typedef DOGEngine::HashMap<std::string, StartElementHandler> StartHandlers;
 		typedef DOGEngine::HashMap<std::string, EndElementHandler> EndHandlers;
@@ -65,14 +63,14 @@ namespace UnitTests
 		 *
 		 * @param userData Reference to the SharedData (or derived type)
 		 *				   of the XmlParseMaster that started the parse.
-		 * @param name The name of the tag.
-		 * @param attributes Map of attribute key-value pairs as unparsed
+		 * @param element The tag.
+		 * @param attributes View of attribute key-value pairs as unparsed
 		 *					 strings.
 		 *
 		 * @return Returns true if the parse request is handled. Otherwise, 
 		 *		   returns false.
 		 */
-		virtual bool startElementHandler(DOGEngine::SharedData& sharedData, const std::string& name, const AttributeMap& attributes) override;
+		virtual bool startElementHandler(DOGEngine::SharedData& sharedData, const DOGEngine::XmlElement& element, const DOGEngine::XmlAttributes& attributes) override;
 
 		/**
 		 * @brief Receives requests by the XmlParseMaster to handle Xml 
@@ -80,12 +78,12 @@ namespace UnitTests
 		 *
 		 * @param userData Reference to the SharedData (or derived tyep)
 		 *				   of the XmlParseMaster that started the parse.
-		 * @param name The name of the tag.
+		 * @param element The tag.
 		 *
 		 * @return Returns true if the parse request is handled. Otherwise, 
 		 *		   returns false.
 		 */
-		virtual bool endElementHandler(DOGEngine::SharedData& sharedData, const std::string& name) override;
+		virtual bool endElementHandler(DOGEngine::SharedData& sharedData, const DOGEngine::XmlElement& element) override;
 
 		/**
 		 * @brief Clears map that associates Xml element names
@@ -95,9 +93,9 @@ namespace UnitTests
 
 	private:
 
-		void startElementHandlerPerson(SharedDataFoo& sharedData, const AttributeMap& attributes);
-		void startElementHandlerString(SharedDataFoo& sharedData, const AttributeMap& attributes);
-		void startElementHandlerInt(SharedDataFoo& sharedData, const AttributeMap& attributes);
+		void startElementHandlerPerson(SharedDataFoo& sharedData, const DOGEngine::XmlAttributes& attributes);
+		void startElementHandlerString(SharedDataFoo& sharedData, const DOGEngine::XmlAttributes& attributes);
+		void startElementHandlerInt(SharedDataFoo& sharedData, const DOGEngine::XmlAttributes& attributes);
 
 		void endElementHandlerPerson(SharedDataFoo& sharedData);
 		void endElementHandlerString(SharedDataFoo& sharedData);
@@ -9,6 +9,7 @@
 #include "XmlParseHelperData.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace std::chrono;
 using namespace DOGEngine;
 using namespace std;
 using namespace glm;
@@ -30,9 +31,6 @@ namespace LibraryDesktopTest
 
 		TEST_METHOD_CLEANUP(Cleanup)
 		{
-			XmlParseHelperData::clearHandlerCache();
-			XmlParseHelperTable::clearHandlerCache();
-
 #ifdef _DEBUG
 			_CrtMemState endMemState, diffMemState;
 
@@ -319,6 +317,57 @@ namespace LibraryDesktopTest
 			Assert::ExpectException<exception>(parseNoValAttr);
 		}
 
+		TEST_METHOD(XmlParseTableBenchmark)
+		{
+			// the valid table files, repeated under one root until the document is megabytes long
+			const string* filePaths[] = { &sXmlFilePath_Scopes, &sXmlFilePath_Ints, &sXmlFilePath_Floats, &sXmlFilePath_Strings,
+				&sXmlFilePath_Vectors, &sXmlFilePath_Matrix, &sXmlFilePath_Full };
+
+			string body;
+			for(const string* filePath : filePaths)
+			{
+				ifstream file(*filePath, ios::in | ios::binary);
+				stringstream contents;
+				contents << file.rdbuf();
+
+				// drop the xml declaration, each file's root scope becomes a child of the benchmark's root
+				string fileContents = contents.str();
+				body.append(fileContents.substr(fileContents.find("?>") + 2));
+			}
+			Assert::IsTrue(!body.empty());
+
+			uint32_t numCopies = sNumBenchmarkBytes / static_cast<uint32_t>(body.size()) + 1;
+			string document = "<Scope name=\"benchmark\">";
+			document.reserve(numCopies * body.size() + 64);
+			for(uint32_t i = 0; i < numCopies; ++i)
+			{
+				document.append(body);
+			}
+			document.append("</Scope>");
+
+			SharedDataTable tableData;
+			XmlParseMaster master(tableData);
+
+			XmlParseHelperTable helperScope;
+			XmlParseHelperData helperData;
+			master.addHelper(helperScope);
+			master.addHelper(helperData);
+
+			high_resolution_clock::time_point start = high_resolution_clock::now();
+			Assert::IsTrue(master.parse(&document[0], static_cast<uint32_t>(document.size()), true));
+			double seconds = duration<double>(high_resolution_clock::now() - start).count();
+
+			Scope& parsedTable = *tableData.getScope();
+			Assert::IsTrue(parsedTable["root"].size() == numCopies * 7);
+			Assert::IsTrue(parsedTable["root"][numCopies * 7 - 1]["Person"][0]["matrix"] == mat4x4(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+
+			double megabytes = document.size() / (1024.0 * 1024.0);
+			stringstream results;
+			results << "Xml table parse benchmark (" << megabytes << " MB, " << numCopies << " copies of the valid table files)\n";
+			results << "  " << seconds * 1000.0 << " ms, " << megabytes / seconds << " MB/s\n";
+			Logger::WriteMessage(results.str().c_str());
+		}
+
 	private:
 
 		template <typename DerivedT, typename BaseT>
@@ -372,6 +421,8 @@ namespace LibraryDesktopTest
 		const static string sXmlFilePath_NoSetName;
 		const static string sXmlFilePath_NoName;
 		const static string sXmlFilePath_NoVal;
+
+		static uint32_t sNumBenchmarkBytes;
 	};
 
 	_CrtMemState XmlParseTableTest::sStartMemState;
@@ -387,5 +438,7 @@ namespace LibraryDesktopTest
 	const string XmlParseTableTest::sXmlFilePath_NoSetName = "assets/xml/Table_invalid/test_nosetname.xml";
 	const string XmlParseTableTest::sXmlFilePath_NoName = "assets/xml/Table_invalid/test_noname.xml";
 	const string XmlParseTableTest::sXmlFilePath_NoVal = "assets/xml/Table_invalid/test_noval.xml";
+
+	uint32_t XmlParseTableTest::sNumBenchmarkBytes = 4 * 1024 * 1024;
 }
 
@@ -38,8 +38,6 @@ namespace LibraryDesktopTest
 		TEST_METHOD_CLEANUP(Cleanup)
 		{
 			XmlParseFoo::clearHandlerCaches();
-			XmlParseHelperData::clearHandlerCache();
-			XmlParseHelperTable::clearHandlerCache();
 
 #ifdef _DEBUG
 			_CrtMemState endMemState, diffMemState;
@@ -456,6 +454,73 @@ namespace LibraryDesktopTest
 			}
 		}
 
+		TEST_METHOD(XmlParseDispatch)
+		{
+			SharedDataFoo fooData;
+			XmlParseMaster master(fooData);
+
+			// the data helper claims String and Int and is added first, the foo helper claims nothing
+			XmlParseHelperData helperData;
+			XmlParseHelperTable helperTable;
+			XmlParseFoo foo;
+			master.addHelper(helperData);
+			master.addHelper(helperTable);
+			master.addHelper(foo);
+
+			// data declines the foo data, so String and Int still reach foo, as do the names nobody claimed
+			Assert::IsTrue(master.parseFromFile(sXmlFilePath_1));
+			Assert::IsTrue(fooData.numElementsParsed() == 7);
+			Assert::IsTrue(fooData.getTable()["People"].size() == 2);
+			Assert::IsTrue(fooData.getTable()["People"][1]["age"] == 19);
+
+			// with foo gone, nothing handles the document
+			Assert::IsTrue(master.removeHelper(foo));
+			Assert::IsTrue(master.parseFromFile(sXmlFilePath_1));
+			Assert::IsTrue(fooData.numElementsParsed() == 0);
+
+			// and adding it back routes the elements to it again
+			Assert::IsTrue(master.addHelper(foo));
+			Assert::IsTrue(master.parseFromFile(sXmlFilePath_2));
+			Assert::IsTrue(fooData.numElementsParsed() == 3);
+			Assert::IsTrue(fooData.getTable()["People"][0]["profession"] == "Thief");
+		}
+
+		TEST_METHOD(XmlParseAttributes)
+		{
+			// laid out the way expat hands attributes to the start-element handler
+			const char* rawAttributes[] = { "name", "Foo", "value", "", "index", "2", nullptr };
+			XmlAttributes attributes(rawAttributes);
+
+			Assert::IsTrue(attributes.size() == 3);
+			Assert::IsTrue(strcmp(attributes.nameAt(0), "name") == 0);
+			Assert::IsTrue(strcmp(attributes.valueAt(0), "Foo") == 0);
+			Assert::IsTrue(strcmp(attributes.nameAt(2), "index") == 0);
+			Assert::IsTrue(strcmp(attributes.valueAt(2), "2") == 0);
+
+			auto nameOutOfBounds = [&attributes]{ attributes.nameAt(3); };
+			Assert::ExpectException<exception>(nameOutOfBounds);
+			auto valueOutOfBounds = [&attributes]{ attributes.valueAt(3); };
+			Assert::ExpectException<exception>(valueOutOfBounds);
+
+			// values are read in place, not copied
+			Assert::IsTrue(attributes.find("name") == rawAttributes[1]);
+			Assert::IsTrue(attributes["index"] == rawAttributes[5]);
+
+			// an attribute with an empty value is still present
+			Assert::IsTrue(attributes.containsKey("value"));
+			Assert::IsFalse(attributes.containsKey("class"));
+			Assert::IsTrue(attributes.find("class") == nullptr);
+
+			auto missingAttribute = [&attributes]{ attributes["class"]; };
+			Assert::ExpectException<exception>(missingAttribute);
+
+			// no attributes at all
+			const char* noAttributes[] = { nullptr };
+			XmlAttributes empty(noAttributes);
+			Assert::IsTrue(empty.size() == 0);
+			Assert::IsTrue(empty.find("name") == nullptr);
+		}
+
 	private:
 
 		//
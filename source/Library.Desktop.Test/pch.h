@@ -17,6 +17,7 @@
 #include <mutex>
 #include <memory>
 #include <cstdint>
+#include <fstream>
 #include <crtdbg.h>
 #include <stdexcept>
 #include <functional>
@@ -10,13 +10,13 @@ RTTI_DEFINITIONS(Action)
 const string Action::sNameAttribute = "name";
 const string Action::sReactionsAttribute = "reactions";
 
+const Symbol Action::sNameSymbol(Action::sNameAttribute);
+const Symbol Action::sReactionsSymbol(Action::sReactionsAttribute);
+
 Action::Action(const string& name) :
 	Attributed()
 {
-	if(!areSignaturesInitialized())
-	{
-		initSignatures();
-	}
+	initSignaturesOnce();
 	populate();
 
 	// set name to the argument if we were given one (populate sets name to some default value)
@@ -113,5 +113,4 @@ void Action::populate()
 void Action::updateExternalStorage()
 {
 	Attributed::updateExternalStorage();
-	(*this)[sNameAttribute].setStorage(&mName, 1);
 }
@@ -115,6 +115,9 @@ namespace DOGEngine
 
 		const static std::string sNameAttribute;
 		const static std::string sReactionsAttribute;
+
+		const static Symbol sNameSymbol;
+		const static Symbol sReactionsSymbol;
 	};
 
 #define ACTION_FACTORY(DerivedAction) FACTORY_DECLARATION(DerivedAction, Action)
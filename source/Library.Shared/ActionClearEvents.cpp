@@ -11,10 +11,7 @@ RTTI_DEFINITIONS(ActionClearEvents)
 ActionClearEvents::ActionClearEvents(const string& name) :
 	Action(name)
 {
-	if(!areSignaturesInitialized())
-	{
-		initSignatures();
-	}
+	initSignaturesOnce();
 	populate();
 }
 
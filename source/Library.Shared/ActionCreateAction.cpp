@@ -21,10 +21,7 @@ const string ActionCreateAction::sInstanceNameAttribute = "instance_name";
 ActionCreateAction::ActionCreateAction(const string& name) :
 	Action(name)
 {
-	if(!areSignaturesInitialized())
-	{
-		initSignatures();
-	}
+	initSignaturesOnce();
 	populate();
 }
 
@@ -100,14 +97,9 @@ void ActionCreateAction::update(WorldState& worldState)
 		mParent->Is(World::TypeIdClass()) || mParent->Is(Sector::TypeIdClass()) ||
 		mParent->Is(Entity::TypeIdClass()) || mParent->Is(ActionList::TypeIdClass()));
 
-	// create a new action, adopt it into parent's "actions" attribute
-	Action* action = Factory<Action>::create(mClassName);
-	if(action != nullptr)
-	{
-		action->setName(mInstanceName);
-		mParent->adopt(Entity::sActionsAttribute, *action);
-	}
-
+	// queue a new action for adoption into parent's "actions" attribute
+	//		deferred to the end of the world's update, so the parent's actions don't change underneath a running update
+	worldState.world->getPendingCreate().enqueue(worldState, *mParent, mClassName, mInstanceName);
 	worldState.world->getPendingDelete().enqueue(*this);
 }
 
@@ -164,6 +156,4 @@ void ActionCreateAction::populate()
 void ActionCreateAction::updateExternalStorage()
 {
 	Action::updateExternalStorage();
-	(*this)[sClassNameAttribute].setStorage(&mClassName, 1);
-	(*this)[sInstanceNameAttribute].setStorage(&mInstanceName, 1);
 }
@@ -77,9 +77,11 @@ namespace DOGEngine
 
 		/**
 		 * @brief Update method for the simulation loop.
-		 *		  Creates a new Action on its parent of
+		 *		  Queues a new Action on its parent of
 		 *		  the saved class name with the saved
-		 *		  instance name.
+		 *		  instance name. The Action is created
+		 *		  when the World's pending create queue
+		 *		  is emptied.
 		 *
 		 * @param worldState Data of the current simulation
 		 *					 state.
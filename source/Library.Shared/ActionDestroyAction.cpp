@@ -16,10 +16,7 @@ const string ActionDestroyAction::sDeleteTargetAttribute = "delete_target";
 ActionDestroyAction::ActionDestroyAction(const string& name) :
 	Action(name)
 {
-	if(!areSignaturesInitialized())
-	{
-		initSignatures();
-	}
+	initSignaturesOnce();
 	populate();
 }
 
@@ -141,5 +138,4 @@ void ActionDestroyAction::populate()
 void ActionDestroyAction::updateExternalStorage()
 {
 	Action::updateExternalStorage();
-	(*this)[sDeleteTargetAttribute].setStorage(&mDeleteTarget, 1);
 }
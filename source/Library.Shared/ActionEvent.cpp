@@ -18,10 +18,7 @@ const string ActionEvent::sDelayAttribute = "delay";
 ActionEvent::ActionEvent(const string& name) :
 	Action(name)
 {
-	if(!areSignaturesInitialized())
-	{
-		initSignatures();
-	}
+	initSignaturesOnce();
 	populate();
 }
 
@@ -96,6 +93,7 @@ void ActionEvent::update(WorldState& worldState)
 
 	// auxiliary attributes are data for the event argument
 	//		DOES NOT support child Scopes as arguments
+	//		heap arrays are shared with ours rather than copied
 	EventArgs args;
 	for(uint32_t i = auxiliaryBeginIndex(); i < size(); ++i)
 	{
@@ -104,12 +102,14 @@ void ActionEvent::update(WorldState& worldState)
 	}
 
 	// set event worldstate and subtype
-	args.setWorldState(worldState);
+	//		the world's own state, since a parallel update's copy is gone by the time the event is delivered
+	args.setWorldState(worldState.world->getWorldState());
 	args.setSubtype(mSubtype);
 
 	// enqueue event with our args and our delay
+	//		the args are built once and moved in, every subscriber then reads the same payload
 	worldState.world->getEventQueue().enqueue(
-		make_shared<Event<EventArgs>>(args),
+		make_shared<Event<EventArgs>>(std::move(args)),
 		worldState.gameTime,
 		milliseconds(mDelay));
 }
@@ -167,7 +167,4 @@ void ActionEvent::populate()
 void ActionEvent::updateExternalStorage()
 {
 	Action::updateExternalStorage();
-
-	(*this)[sSubtypeAttribute].setStorage(&mSubtype, 1);
-	(*this)[sDelayAttribute].setStorage(&mDelay, 1);
 }
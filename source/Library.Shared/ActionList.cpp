@@ -9,13 +9,12 @@ RTTI_DEFINITIONS(ActionList)
 
 const string ActionList::sActionsAttribute = "actions";
 
+const Symbol ActionList::sActionsSymbol(ActionList::sActionsAttribute);
+
 ActionList::ActionList(const string& name) :
 	Action(name)
 {
-	if(!areSignaturesInitialized())
-	{
-		initSignatures();
-	}
+	initSignaturesOnce();
 	populate();
 }
 
@@ -105,7 +104,7 @@ Action* ActionList::createAction(const string& className, const string& objectNa
 
 Datum& ActionList::getActions() const
 {
-	return *find(sActionsAttribute);
+	return *mActions;
 }
 
 //-----------------------------------------------------------------
@@ -122,6 +121,8 @@ void ActionList::populate()
 {
 	Action::populate();
 	addTableEntry(sActionsAttribute);
+
+	mActions = find(sActionsSymbol);
 }
 
 //-----------------------------------------------------------------
@@ -129,4 +130,6 @@ void ActionList::populate()
 void ActionList::updateExternalStorage()
 {
 	Action::updateExternalStorage();
+
+	mActions = find(sActionsSymbol);
 }
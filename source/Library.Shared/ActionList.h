@@ -120,13 +120,19 @@ namespace DOGEngine
 		virtual void populate() override;
 
 		/**
-		 * @brief Updates this class' table's pointers
-		 *		  to external storage.
+		 * @brief Re-resolves the cached child-collection
+		 *		  Datums.
 		 */
 		virtual void updateExternalStorage() override;
 
+	private:
+
+		Datum* mActions;
+
 	public:
 
 		const static std::string sActionsAttribute;
+
+		const static Symbol sActionsSymbol;
 	};
 }
@@ -14,10 +14,7 @@ const string ActionListIf::sElseAttribute = "else";
 ActionListIf::ActionListIf(const string& name) :
 	ActionList(name)
 {
-	if(!areSignaturesInitialized())
-	{
-		initSignatures();
-	}
+	initSignaturesOnce();
 	populate();
 }
 
@@ -188,8 +185,6 @@ void ActionListIf::updateExternalStorage()
 {
 	ActionList::updateExternalStorage();
 
-	(*this)[sConditionAttribute].setStorage(&mCondition, 1);
-
 	// update the then and else blocks
 	mThenBlock = (*this)[sThenAttribute].size() == 0 ? nullptr : &(*this)[sThenAttribute][0];
 	mElseBlock = (*this)[sElseAttribute].size() == 0 ? nullptr : &(*this)[sElseAttribute][0];
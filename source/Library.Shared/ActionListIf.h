@@ -161,8 +161,8 @@ namespace DOGEngine
 		virtual void populate() override;
 
 		/**
-		 * @brief Updates this class' table's pointers
-		 *		  to external storage.
+		 * @brief Re-resolves the cached then and else
+		 *		  blocks.
 		 */
 		virtual void updateExternalStorage() override;
 
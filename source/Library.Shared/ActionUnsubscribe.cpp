@@ -14,10 +14,7 @@ RTTI_DEFINITIONS(ActionUnsubscribe)
 ActionUnsubscribe::ActionUnsubscribe(const string& name) :
 	Action(name)
 {
-	if(!areSignaturesInitialized())
-	{
-		initSignatures();
-	}
+	initSignaturesOnce();
 	populate();
 }
 
@@ -9,26 +9,147 @@ using namespace DOGEngine;
 RTTI_DEFINITIONS(Attributed)
 
 Attributed::SignatureMap Attributed::sSignatureMap;
+recursive_mutex Attributed::sSignatureMutex;
+Attributed::ColumnMap Attributed::sColumnMap;
+const uint32_t Attributed::sRowsPerChunk = 64;
 
-#pragma region Public Interface
+#pragma region Columns
 
-Attributed::Attributed(uint32_t size) :
-	Scope(size)
+namespace
 {
-	if(!areSignaturesInitialized())
+	/**
+	 * Empty type carrying the element type of a column, so a
+	 * generic lambda handed to visitColumn can recover it.
+	 */
+	template <typename T> struct ColumnType { typedef T Type; };
+
+	template <typename TVisitor>
+	void visitColumn(const Datum::DatumType type, TVisitor visitor)
 	{
-		initSignatures();
+		switch(type)
+		{
+			case Datum::DatumType::Integer:	visitor(ColumnType<int32_t>());	break;
+			case Datum::DatumType::Float:	visitor(ColumnType<float>());	break;
+			case Datum::DatumType::String:	visitor(ColumnType<string>());	break;
+			case Datum::DatumType::Pointer:	visitor(ColumnType<RTTI*>());	break;
+			case Datum::DatumType::Vector:	visitor(ColumnType<vec4>());	break;
+			case Datum::DatumType::Matrix:	visitor(ColumnType<mat4x4>());	break;
+			default:						throw exception("Error -- columns can only hold Integer, Float, String, Pointer, Vector or Matrix values!");
+		}
 	}
 
+	//-----------------------------------------------------------------
+
+	void appendRow(Vector<Datum>& chunks, const Datum& defaults)
+	{
+		uint32_t width = defaults.size();
+		if(chunks.isEmpty() || chunks.back().size() == Attributed::sRowsPerChunk * width)
+		{
+			// a whole chunk is reserved up front, and never fits inline, so its rows stay put
+			chunks.pushBack(Datum(defaults.type()));
+			chunks.back().reserve(Attributed::sRowsPerChunk * width);
+		}
+
+		Datum& values = chunks.back();
+		visitColumn(values.type(), [&values, &defaults](auto tag)
+		{
+			for(uint32_t i = 0; i < defaults.size(); ++i)
+			{
+				values.pushBack(defaults.get<typename decltype(tag)::Type>(i));
+			}
+		});
+	}
+
+	//-----------------------------------------------------------------
+
+	void popRow(Vector<Datum>& chunks, const uint32_t width)
+	{
+		for(uint32_t i = 0; i < width; ++i)
+		{
+			chunks.back().popBack();
+		}
+
+		if(chunks.back().isEmpty())
+		{
+			chunks.popBack();
+		}
+	}
+
+	//-----------------------------------------------------------------
+
+	void* rowAddress(Vector<Datum>& chunks, const uint32_t width, const uint32_t row)
+	{
+		Datum& values = chunks[row / Attributed::sRowsPerChunk];
+		uint32_t index = (row % Attributed::sRowsPerChunk) * width;
+
+		void* result = nullptr;
+		visitColumn(values.type(), [&values, &result, index](auto tag)
+		{
+			result = &values.get<typename decltype(tag)::Type>(index);
+		});
+
+		return result;
+	}
+
+	//-----------------------------------------------------------------
+
+	void moveRow(Vector<Datum>& chunks, const uint32_t width, const uint32_t from, const uint32_t to)
+	{
+		void* source = rowAddress(chunks, width, from);
+		void* target = rowAddress(chunks, width, to);
+		visitColumn(chunks[0].type(), [source, target, width](auto tag)
+		{
+			typedef typename decltype(tag)::Type T;
+			for(uint32_t i = 0; i < width; ++i)
+			{
+				static_cast<T*>(target)[i] = std::move(static_cast<T*>(source)[i]);
+			}
+		});
+	}
+
+	//-----------------------------------------------------------------
+
+	void copyRow(Vector<Datum>& chunks, const uint32_t width, const uint32_t from, const uint32_t to)
+	{
+		void* source = rowAddress(chunks, width, from);
+		void* target = rowAddress(chunks, width, to);
+		visitColumn(chunks[0].type(), [source, target, width](auto tag)
+		{
+			typedef typename decltype(tag)::Type T;
+			for(uint32_t i = 0; i < width; ++i)
+			{
+				static_cast<T*>(target)[i] = static_cast<T*>(source)[i];
+			}
+		});
+	}
+}
+
+#pragma endregion
+
+//-----------------------------------------------------------------
+
+#pragma region Public Interface
+
+Attributed::Attributed(uint32_t size) :
+	Scope(size),
+	mExternalBindings(0),
+	mColumnBindings(0)
+{
+	initSignaturesOnce();
+
 	populate();
 }
 
 //-----------------------------------------------------------------
 
 Attributed::Attributed(const Attributed& other) :
-	Scope(other)
+	Scope(other),
+	mExternalBindings(other.mExternalBindings),
+	mColumnBindings(0)
 {
 	(*this)["this"] = this;
+	rebindExternalStorage();
+	copyRows(other);
 	updateExternalStorage();
 }
 
@@ -38,9 +159,13 @@ Attributed& Attributed::operator=(const Attributed& other)
 {
 	if(&other != this)
 	{
+		releaseRows();
 		Scope::operator=(other);
+		mExternalBindings = other.mExternalBindings;
 
 		(*this)["this"] = this;
+		rebindExternalStorage();
+		copyRows(other);
 		updateExternalStorage();
 	}
 
@@ -57,12 +182,16 @@ Scope* Attributed::copy()
 //-----------------------------------------------------------------
 
 Attributed::Attributed(Attributed&& other) :
-	Scope(std::move(other))
+	Scope(std::move(other)),
+	mExternalBindings(std::move(other.mExternalBindings)),
+	mColumnBindings(0)
 {
 	(*this)["this"] = this;
 
-	// repopulate other and update our external pointers
+	// take over other's rows, then repopulate other and update our external pointers
+	adoptRows(other);
 	other.populate();
+	rebindExternalStorage();
 	updateExternalStorage();
 }
 
@@ -72,12 +201,16 @@ Attributed& Attributed::operator=(Attributed&& other)
 {
 	if(this != &other)
 	{
+		releaseRows();
 		Scope::operator=(std::move(other));
+		mExternalBindings = std::move(other.mExternalBindings);
 
 		(*this)["this"] = this;
 
-		// repopulate other and update our external pointers
+		// take over other's rows, then repopulate other and update our external pointers
+		adoptRows(other);
 		other.populate();
+		rebindExternalStorage();
 		updateExternalStorage();
 	}
 
@@ -88,6 +221,7 @@ Attributed& Attributed::operator=(Attributed&& other)
 
 Attributed::~Attributed()
 {
+	releaseRows();
 }
 
 //-----------------------------------------------------------------
@@ -178,7 +312,9 @@ Datum& Attributed::addAuxiliaryAttribute(const string& key)
 uint32_t Attributed::prescribedSize() const
 {
 	// number of prescribed attributes is the size of the static list for this type
-	return sSignatureMap[TypeIdInstance()].size();
+	lock_guard<recursive_mutex> lock(sSignatureMutex);
+	SignatureMap::Iterator iter = sSignatureMap.find(TypeIdInstance());
+	return iter != sSignatureMap.end() ? iter->second.size() : 0;
 }
 
 //-----------------------------------------------------------------
@@ -209,8 +345,14 @@ bool Attributed::isAttribute(const string& name) const
 bool Attributed::isPrescribedAttribute(const string& name) const
 {
 	// prescribed attribute if in the signatures map AND currently in the table
-	SignatureList& signatureList = sSignatureMap[TypeIdInstance()];
-	return signatureList.find(name) != signatureList.end() && isAttribute(name);
+	bool isSignature = false;
+	{
+		lock_guard<recursive_mutex> lock(sSignatureMutex);
+		SignatureMap::Iterator iter = sSignatureMap.find(TypeIdInstance());
+		isSignature = iter != sSignatureMap.end() && iter->second.find(name) != iter->second.end();
+	}
+
+	return isSignature && isAttribute(name);
 }
 
 //-----------------------------------------------------------------
@@ -224,7 +366,37 @@ bool Attributed::isAuxiliaryAttribute(const string& name) const
 
 void Attributed::clearAttributeCache()
 {
+	lock_guard<recursive_mutex> lock(sSignatureMutex);
 	sSignatureMap.clear();
+	sSignatureMap.shrinkToFit();
+	sColumnMap.clear();
+	sColumnMap.shrinkToFit();
+}
+
+//-----------------------------------------------------------------
+
+Datum* Attributed::column(const uint64_t typeId, const string& name, const uint32_t chunk)
+{
+	Datum* result = nullptr;
+
+	lock_guard<recursive_mutex> lock(sSignatureMutex);
+	ColumnMap::Iterator tableIter = sColumnMap.find(typeId);
+	if(tableIter != sColumnMap.end())
+	{
+		for(Column& column : tableIter->second.mColumns)
+		{
+			if(column.mName == name)
+			{
+				if(chunk < column.mChunks.size())
+				{
+					result = &column.mChunks[chunk];
+				}
+				break;
+			}
+		}
+	}
+
+	return result;
 }
 
 #pragma endregion
@@ -255,13 +427,28 @@ void Attributed::updateExternalStorage()
 
 bool Attributed::areSignaturesInitialized() const
 {
-	return !sSignatureMap[TypeIdInstance()].isEmpty();
+	lock_guard<recursive_mutex> lock(sSignatureMutex);
+	SignatureMap::Iterator iter = sSignatureMap.find(TypeIdInstance());
+	return iter != sSignatureMap.end() && !iter->second.isEmpty();
+}
+
+//-----------------------------------------------------------------
+
+void Attributed::initSignaturesOnce()
+{
+	// held across initSignatures so no other thread sees a partially built list
+	lock_guard<recursive_mutex> lock(sSignatureMutex);
+	if(!areSignaturesInitialized())
+	{
+		initSignatures();
+	}
 }
 
 //-----------------------------------------------------------------
 
 void Attributed::addSignature(const string& signature)
 {
+	lock_guard<recursive_mutex> lock(sSignatureMutex);
 	SignatureList& signatureList = sSignatureMap[TypeIdInstance()];
 	if(signatureList.find(signature) == signatureList.end())
 	{
@@ -361,12 +548,255 @@ void Attributed::addExternalAttribute(const string& name, RTTI** const storage,
 	addExternalAttributeHelper<RTTI*>(name, storage, defaultValue, size);
 }
 
+//-----------------------------------------------------------------
+
+void Attributed::addColumnAttribute(const string& name, const int32_t defaultValue, const uint32_t size)
+{
+	addColumnAttributeHelper<int32_t>(name, defaultValue, size, Datum::DatumType::Integer);
+}
+
+//-----------------------------------------------------------------
+
+void Attributed::addColumnAttribute(const string& name, const float defaultValue, const uint32_t size)
+{
+	addColumnAttributeHelper<float>(name, defaultValue, size, Datum::DatumType::Float);
+}
+
+//-----------------------------------------------------------------
+
+void Attributed::addColumnAttribute(const string& name, const string& defaultValue, const uint32_t size)
+{
+	addColumnAttributeHelper<string>(name, defaultValue, size, Datum::DatumType::String);
+}
+
+//-----------------------------------------------------------------
+
+void Attributed::addColumnAttribute(const string& name, const vec4& defaultValue, const uint32_t size)
+{
+	addColumnAttributeHelper<vec4>(name, defaultValue, size, Datum::DatumType::Vector);
+}
+
+//-----------------------------------------------------------------
+
+void Attributed::addColumnAttribute(const string& name, const mat4x4& defaultValue, const uint32_t size)
+{
+	addColumnAttributeHelper<mat4x4>(name, defaultValue, size, Datum::DatumType::Matrix);
+}
+
+//-----------------------------------------------------------------
+
+void Attributed::addColumnAttribute(const string& name, RTTI* const defaultValue, const uint32_t size)
+{
+	addColumnAttributeHelper<RTTI*>(name, defaultValue, size, Datum::DatumType::Pointer);
+}
+
 #pragma endregion
 
 //-----------------------------------------------------------------
 
 #pragma region Private Helpers
 
+template <typename T>
+void Attributed::addColumnAttributeHelper(const string& name, const T& defaultValue, const uint32_t size, const Datum::DatumType type)
+{
+	if(find(name) == nullptr)
+	{
+		if(size == 0)
+		{
+			throw exception("Error -- a columnar attribute needs at least one element!");
+		}
+
+		// objects of one type may be built on several threads, and they all share its table
+		lock_guard<recursive_mutex> lock(sSignatureMutex);
+		ColumnTable& table = sColumnMap[TypeIdInstance()];
+
+		// the first instance of the class declares the column
+		uint32_t columnIndex = 0;
+		while(columnIndex < table.mColumns.size() && table.mColumns[columnIndex].mName != name)
+		{
+			++columnIndex;
+		}
+
+		if(columnIndex == table.mColumns.size())
+		{
+			Column newColumn;
+			newColumn.mName = name;
+			for(uint32_t i = 0; i < size; ++i)
+			{
+				newColumn.mDefaults.pushBack(defaultValue);
+			}
+
+			// rows that already exist get defaults, so every column covers every row
+			for(uint32_t row = 0; row < table.mOwners.size(); ++row)
+			{
+				appendRow(newColumn.mChunks, newColumn.mDefaults);
+			}
+
+			// growing the column list moves the other columns, but not the chunks their rows live in
+			table.mColumns.pushBack(std::move(newColumn));
+		}
+
+		Column& column = table.mColumns[columnIndex];
+		if(column.mDefaults.type() != type || column.mDefaults.size() != size)
+		{
+			throw exception("Error -- a columnar attribute does not match the column already declared under its name!");
+		}
+
+		// fill our row with the default value
+		uint32_t row = acquireRow(table);
+		T* values = static_cast<T*>(rowAddress(column.mChunks, size, row));
+		for(uint32_t i = 0; i < size; ++i)
+		{
+			values[i] = defaultValue;
+		}
+
+		Datum& datum = append(name);
+		datum.setStorage(values, size);
+
+		ColumnBinding binding = { Scope::size() - 1, &table, columnIndex, row };
+		mColumnBindings.pushBack(binding);
+	}
+}
+
+//-----------------------------------------------------------------
+
+uint32_t Attributed::acquireRow(ColumnTable& table)
+{
+	// we hold at most one row per table
+	for(ColumnBinding& binding : mColumnBindings)
+	{
+		if(binding.mTable == &table)
+		{
+			return binding.mRow;
+		}
+	}
+
+	uint32_t row = table.mOwners.size();
+	table.mOwners.pushBack(this);
+
+	for(Column& column : table.mColumns)
+	{
+		appendRow(column.mChunks, column.mDefaults);
+	}
+
+	return row;
+}
+
+//-----------------------------------------------------------------
+
+void Attributed::releaseRows()
+{
+	lock_guard<recursive_mutex> lock(sSignatureMutex);
+	for(uint32_t i = 0; i < mColumnBindings.size(); ++i)
+	{
+		// release each table's row once, at the first binding into it
+		bool isFirst = true;
+		for(uint32_t j = 0; j < i; ++j)
+		{
+			if(mColumnBindings[j].mTable == mColumnBindings[i].mTable)
+			{
+				isFirst = false;
+				break;
+			}
+		}
+
+		if(isFirst)
+		{
+			removeRow(*mColumnBindings[i].mTable, mColumnBindings[i].mRow);
+		}
+	}
+
+	mColumnBindings.clear();
+}
+
+//-----------------------------------------------------------------
+
+void Attributed::copyRows(const Attributed& other)
+{
+	lock_guard<recursive_mutex> lock(sSignatureMutex);
+
+	// our Datums still view other's rows until they are bound to rows of our own
+	for(const ColumnBinding& otherBinding : other.mColumnBindings)
+	{
+		ColumnTable& table = *otherBinding.mTable;
+		uint32_t row = acquireRow(table);
+
+		Column& column = table.mColumns[otherBinding.mColumn];
+		copyRow(column.mChunks, column.mDefaults.size(), otherBinding.mRow, row);
+
+		ColumnBinding binding = { otherBinding.mIndex, &table, otherBinding.mColumn, row };
+		mColumnBindings.pushBack(binding);
+		bindView(binding);
+	}
+}
+
+//-----------------------------------------------------------------
+
+void Attributed::adoptRows(Attributed& other)
+{
+	lock_guard<recursive_mutex> lock(sSignatureMutex);
+
+	// other's Datums moved to us still view the same rows, only the owner changes
+	mColumnBindings = std::move(other.mColumnBindings);
+	for(ColumnBinding& binding : mColumnBindings)
+	{
+		binding.mTable->mOwners[binding.mRow] = this;
+	}
+}
+
+//-----------------------------------------------------------------
+
+void Attributed::bindView(const ColumnBinding& binding)
+{
+	Column& column = binding.mTable->mColumns[binding.mColumn];
+	operator[](binding.mIndex).rebindStorage(rowAddress(column.mChunks, column.mDefaults.size(), binding.mRow));
+}
+
+//-----------------------------------------------------------------
+
+void Attributed::removeRow(ColumnTable& table, const uint32_t row)
+{
+	uint32_t lastRow = table.mOwners.size() - 1;
+	if(row != lastRow)
+	{
+		// the last row fills the gap, and its owner's views follow it
+		for(Column& column : table.mColumns)
+		{
+			moveRow(column.mChunks, column.mDefaults.size(), lastRow, row);
+		}
+
+		Attributed* owner = table.mOwners[lastRow];
+		table.mOwners[row] = owner;
+		for(ColumnBinding& binding : owner->mColumnBindings)
+		{
+			if(binding.mTable == &table)
+			{
+				binding.mRow = row;
+				owner->bindView(binding);
+			}
+		}
+	}
+
+	for(Column& column : table.mColumns)
+	{
+		popRow(column.mChunks, column.mDefaults.size());
+	}
+	table.mOwners.popBack();
+}
+
+//-----------------------------------------------------------------
+
+void Attributed::rebindExternalStorage()
+{
+	char* base = reinterpret_cast<char*>(this);
+	for(ExternalBinding& binding : mExternalBindings)
+	{
+		operator[](binding.mIndex).rebindStorage(base + binding.mOffset);
+	}
+}
+
+//-----------------------------------------------------------------
+
 template <typename T>
 void Attributed::addInternalAttributeHelper(const std::string& name, const T defaultValue, const std::uint32_t size, const Datum::DatumType type)
 {
@@ -396,6 +826,10 @@ void Attributed::addExternalAttributeHelper(const string& name, T* const storage
 		Datum& datum = append(name);
 		datum.setStorage(storage, size);
 
+		// remember where the member sits so copies and moves can find their own without a lookup
+		ExternalBinding binding = { Scope::size() - 1, reinterpret_cast<char*>(storage) - reinterpret_cast<char*>(this) };
+		mExternalBindings.pushBack(binding);
+
 		// fill the array with the default value
 		for(uint32_t i = 0; i < size; ++i)
 		{
@@ -26,6 +26,16 @@ namespace DOGEngine
 	 * Auxiliary attributes are not associated with the
 	 * type by default, but may be added to an object
 	 * after it is created.
+	 *
+	 * The per-type signature lists and attribute columns are
+	 * guarded, so objects of any Attributed type may be
+	 * created, copied and destroyed on several threads at
+	 * once. Columns are stored in chunks that never move,
+	 * so creating objects leaves every existing row where it
+	 * is. Destroying one moves the last row of its type into
+	 * the gap, so columnar values must not be read or written
+	 * on one thread while another destroys objects of the
+	 * same type.
 	 */
 	class Attributed : public Scope
 	{
@@ -238,9 +248,43 @@ namespace DOGEngine
 		/**
 		 * @brief Clears the list of attribute names for this
 		 *		  specific Attributed type.
+		 *
+		 * @note Also frees every attribute column, so no object
+		 *		 with columnar attributes may still exist.
 		 */
 		static void clearAttributeCache();
 
+		/**
+		 * @brief Gets one chunk of the shared column that holds
+		 *		  a columnar attribute for every instance that has
+		 *		  one. Each chunk holds up to sRowsPerChunk rows,
+		 *		  one after another, so their values can be scanned
+		 *		  as a single array. Ask for chunks 0, 1, 2... until
+		 *		  nullptr comes back to visit every row.
+		 *
+		 * @param typeId The RTTI id of the class that added
+		 *				 the attribute, e.g. Foo::TypeIdClass().
+		 * @param name The name of the attribute.
+		 * @param chunk The index of the chunk. Defaulted to 0.
+		 *
+		 * @return Returns the chunk, or nullptr if the class
+		 *		   has no columnar attribute by that name or the
+		 *		   column has fewer chunks.
+		 *
+		 * @note Values may be read and written freely, and a
+		 *		 chunk can be handed to DatumMath, but its size
+		 *		 must not be changed. Rows are in no particular
+		 *		 order and move when instances are destroyed.
+		 *		 Chunks never move, and are only freed once
+		 *		 they are empty.
+		 */
+		static Datum* column(const std::uint64_t typeId, const std::string& name, const std::uint32_t chunk = 0);
+
+		/**
+		 * The number of rows in each chunk of a column.
+		 */
+		static const std::uint32_t sRowsPerChunk;
+
 	protected:
 
 		/**
@@ -260,11 +304,12 @@ namespace DOGEngine
 		virtual void populate();
 
 		/**
-		 * @brief Updates this object's external storage pointers.
-		 *		  This prevents a copied or moved object from having
-		 *		  its external data pointing to members of another
-		 *		  Attributed object. Overridden implementations should
-		 *		  call their parent class' implementation as well.
+		 * @brief Refreshes anything a subclass caches about its
+		 *		  table after a copy or move. External attributes
+		 *		  have already been re-pointed at this object's
+		 *		  members by the time it is called. Overridden
+		 *		  implementations should call their parent class'
+		 *		  implementation as well.
 		 */
 		virtual void updateExternalStorage();
 
@@ -278,6 +323,16 @@ namespace DOGEngine
 		 */
 		bool areSignaturesInitialized() const;
 
+		/**
+		 * @brief Builds this type's list of prescribed attribute
+		 *		  names if no other object of the type has yet.
+		 *		  Derived constructors call this rather than
+		 *		  initSignatures, so that two threads constructing
+		 *		  the first objects of a type do not fill the list
+		 *		  twice or read it half-built.
+		 */
+		void initSignaturesOnce();
+
 		/**
 		 * @brief Adds a prescribed attribute name to the class'
 		 *		  list.
@@ -380,6 +435,9 @@ namespace DOGEngine
 		 *		  external storage.
 		 * @param size The number of elements in the external storage.
 		 *		  Defaulted to 1.
+		 *
+		 * @note The storage must be a member of this object. Copies
+		 *		 and moves re-point the attribute at their own member.
 		 */
 		void addExternalAttribute(const std::string& name, std::int32_t* const storage, const std::int32_t defaultValue, const std::uint32_t size = 1);
 
@@ -394,6 +452,9 @@ namespace DOGEngine
 		 *		  external storage.
 		 * @param size The number of elements in the external storage.
 		 *		  Defaulted to 1.
+		 *
+		 * @note The storage must be a member of this object. Copies
+		 *		 and moves re-point the attribute at their own member.
 		 */
 		void addExternalAttribute(const std::string& name, float* const storage, const float defaultValue, const std::uint32_t size = 1);
 
@@ -408,6 +469,9 @@ namespace DOGEngine
 		 *		  external storage.
 		 * @param size The number of elements in the external storage.
 		 *		  Defaulted to 1.
+		 *
+		 * @note The storage must be a member of this object. Copies
+		 *		 and moves re-point the attribute at their own member.
 		 */
 		void addExternalAttribute(const std::string& name, std::string* const storage, const std::string& defaultValue, const std::uint32_t size = 1);
 
@@ -422,6 +486,9 @@ namespace DOGEngine
 		 *		  external storage.
 		 * @param size The number of elements in the external storage.
 		 *		  Defaulted to 1.
+		 *
+		 * @note The storage must be a member of this object. Copies
+		 *		 and moves re-point the attribute at their own member.
 		 */
 		void addExternalAttribute(const std::string& name, glm::vec4* const storage, const glm::vec4& defaultValue, const std::uint32_t size = 1);
 
@@ -436,6 +503,9 @@ namespace DOGEngine
 		 *		  external storage.
 		 * @param size The number of elements in the external storage.
 		 *		  Defaulted to 1.
+		 *
+		 * @note The storage must be a member of this object. Copies
+		 *		 and moves re-point the attribute at their own member.
 		 */
 		void addExternalAttribute(const std::string& name, glm::mat4x4* const storage, const glm::mat4x4& defaultValue, const std::uint32_t size = 1);
 
@@ -450,9 +520,120 @@ namespace DOGEngine
 		 *		  external storage.
 		 * @param size The number of elements in the external storage.
 		 *		  Defaulted to 1.
+		 *
+		 * @note The storage must be a member of this object. Copies
+		 *		 and moves re-point the attribute at their own member.
 		 */
 		void addExternalAttribute(const std::string& name, RTTI** const storage, RTTI* const defaultValue, const std::uint32_t size = 1);
 
+		/**
+		 * @brief Adds a prescribed integer attribute to the table.
+		 *		  The attribute is set to some default value. The
+		 *		  attribute is stored in a column shared by every
+		 *		  instance of the class being constructed.
+		 *
+		 * @param name The name of the prescribed attribute.
+		 * @param defaultValue The value with which to fill the
+		 *		  attribute.
+		 * @param size The number of elements in the attribute.
+		 *		  Defaulted to 1.
+		 *
+		 * @exception Throws exception if size is 0, or if the
+		 *			  class already has a column by this name
+		 *			  with a different type or size.
+		 */
+		void addColumnAttribute(const std::string& name, const std::int32_t defaultValue, const std::uint32_t size = 1);
+
+		/**
+		 * @brief Adds a prescribed float attribute to the table.
+		 *		  The attribute is set to some default value. The
+		 *		  attribute is stored in a column shared by every
+		 *		  instance of the class being constructed.
+		 *
+		 * @param name The name of the prescribed attribute.
+		 * @param defaultValue The value with which to fill the
+		 *		  attribute.
+		 * @param size The number of elements in the attribute.
+		 *		  Defaulted to 1.
+		 *
+		 * @exception Throws exception if size is 0, or if the
+		 *			  class already has a column by this name
+		 *			  with a different type or size.
+		 */
+		void addColumnAttribute(const std::string& name, const float defaultValue, const std::uint32_t size = 1);
+
+		/**
+		 * @brief Adds a prescribed string attribute to the table.
+		 *		  The attribute is set to some default value. The
+		 *		  attribute is stored in a column shared by every
+		 *		  instance of the class being constructed.
+		 *
+		 * @param name The name of the prescribed attribute.
+		 * @param defaultValue The value with which to fill the
+		 *		  attribute.
+		 * @param size The number of elements in the attribute.
+		 *		  Defaulted to 1.
+		 *
+		 * @exception Throws exception if size is 0, or if the
+		 *			  class already has a column by this name
+		 *			  with a different type or size.
+		 */
+		void addColumnAttribute(const std::string& name, const std::string& defaultValue, const std::uint32_t size = 1);
+
+		/**
+		 * @brief Adds a prescribed glm vec4 attribute to the table.
+		 *		  The attribute is set to some default value. The
+		 *		  attribute is stored in a column shared by every
+		 *		  instance of the class being constructed.
+		 *
+		 * @param name The name of the prescribed attribute.
+		 * @param defaultValue The value with which to fill the
+		 *		  attribute.
+		 * @param size The number of elements in the attribute.
+		 *		  Defaulted to 1.
+		 *
+		 * @exception Throws exception if size is 0, or if the
+		 *			  class already has a column by this name
+		 *			  with a different type or size.
+		 */
+		void addColumnAttribute(const std::string& name, const glm::vec4& defaultValue, const std::uint32_t size = 1);
+
+		/**
+		 * @brief Adds a prescribed glm 4x4 matrix attribute to the table.
+		 *		  The attribute is set to some default value. The
+		 *		  attribute is stored in a column shared by every
+		 *		  instance of the class being constructed.
+		 *
+		 * @param name The name of the prescribed attribute.
+		 * @param defaultValue The value with which to fill the
+		 *		  attribute.
+		 * @param size The number of elements in the attribute.
+		 *		  Defaulted to 1.
+		 *
+		 * @exception Throws exception if size is 0, or if the
+		 *			  class already has a column by this name
+		 *			  with a different type or size.
+		 */
+		void addColumnAttribute(const std::string& name, const glm::mat4x4& defaultValue, const std::uint32_t size = 1);
+
+		/**
+		 * @brief Adds a prescribed RTTI pointer attribute to the table.
+		 *		  The attribute is set to some default value. The
+		 *		  attribute is stored in a column shared by every
+		 *		  instance of the class being constructed.
+		 *
+		 * @param name The name of the prescribed attribute.
+		 * @param defaultValue The value with which to fill the
+		 *		  attribute.
+		 * @param size The number of elements in the attribute.
+		 *		  Defaulted to 1.
+		 *
+		 * @exception Throws exception if size is 0, or if the
+		 *			  class already has a column by this name
+		 *			  with a different type or size.
+		 */
+		void addColumnAttribute(const std::string& name, RTTI* const defaultValue, const std::uint32_t size = 1);
+
 	private:
 
 		/**
@@ -481,8 +662,95 @@ namespace DOGEngine
 		template <typename T>
 		void addExternalAttributeHelper(const std::string& name, T* const storage, const T defaultValue, const std::uint32_t size);
 
+		/**
+		 * @brief Adds the attribute to the table as a view of
+		 *		  this object's row in the attribute's column.
+		 *		  Fills the row with a default value.
+		 *
+		 * @param name The name of the prescribed attribute.
+		 * @param defaultValue The value with which to fill the
+		 *		  row.
+		 * @param size The number of elements in the row.
+		 */
+		template <typename T>
+		void addColumnAttributeHelper(const std::string& name, const T& defaultValue, const std::uint32_t size, const Datum::DatumType type);
+
+		/**
+		 * @brief Points every external attribute at the member at
+		 *		  the same offset in this object. Indexes the table
+		 *		  by insertion order, so no keys are looked up.
+		 */
+		void rebindExternalStorage();
+
+		/**
+		 * Where an external attribute lives: its position in the
+		 * table's insertion order, and the offset of its storage
+		 * from the start of the object.
+		 */
+		struct ExternalBinding
+		{
+			std::uint32_t mIndex;
+			std::ptrdiff_t mOffset;
+		};
+
+		Vector<ExternalBinding> mExternalBindings;
+
+		/**
+		 * One columnar attribute of a class: the values of
+		 * every row, one after another, in chunks of
+		 * sRowsPerChunk rows, and the defaults that a new row
+		 * starts with. Its width is the number of defaults.
+		 *
+		 * Each chunk reserves room for all of its rows when it
+		 * is created, and that room is too big to be stored
+		 * inside the Datum, so appending rows never moves the
+		 * ones already there.
+		 */
+		struct Column
+		{
+			std::string mName;
+			Vector<Datum> mChunks;
+			Datum mDefaults;
+		};
+
+		/**
+		 * The columnar attributes of one class. Row r of every
+		 * column belongs to mOwners[r]. Rows are kept dense by
+		 * moving the last row into any row that is released.
+		 */
+		struct ColumnTable
+		{
+			Vector<Column> mColumns;
+			Vector<Attributed*> mOwners;
+		};
+
+		/**
+		 * Where a columnar attribute lives: its position in the
+		 * table's insertion order, and its column and row.
+		 */
+		struct ColumnBinding
+		{
+			std::uint32_t mIndex;
+			ColumnTable* mTable;
+			std::uint32_t mColumn;
+			std::uint32_t mRow;
+		};
+
+		std::uint32_t acquireRow(ColumnTable& table);
+		void releaseRows();
+		void copyRows(const Attributed& other);
+		void adoptRows(Attributed& other);
+		void bindView(const ColumnBinding& binding);
+		static void removeRow(ColumnTable& table, const std::uint32_t row);
+
+		Vector<ColumnBinding> mColumnBindings;
+
 		typedef Vector<std::string> SignatureList;
 		typedef HashMap<std::uint64_t, SignatureList> SignatureMap;
 		static SignatureMap sSignatureMap;
+		static std::recursive_mutex sSignatureMutex;
+
+		typedef HashMap<std::uint64_t, ColumnTable> ColumnMap;
+		static ColumnMap sColumnMap;
 	};
 }
@@ -10,135 +10,417 @@ using namespace glm;
 namespace DOGEngine
 {
 
-#pragma region Static Function Pointer Array Definitions
+#pragma region Type Dispatch
 
-	Datum::ComparisonFuncs Datum::sComparisonFuncs[(uint32_t)DatumType::Unknown] =
+	template <typename TVisitor>
+	auto Datum::visit(TVisitor visitor) const -> decltype(visitor(TypeTag<int32_t>()))
 	{
-		&Datum::comparisonHelper<int32_t>,
-		&Datum::comparisonHelper<float>,
-		&Datum::comparisonHelper<string>,
-		&Datum::comparisonHelperRTTI,		// calls implementations of RTTI::Equals
-		&Datum::comparisonHelper<mat4x4>,
-		&Datum::comparisonHelper<vec4>,
-		&Datum::comparisonHelperRTTI		// calls implementations of RTTI::Equals
-	};
+		// a switch the compiler can turn into a jump table, with each case's helper inlined
+		//		Pointer and Table both hold RTTI-derived pointers, but keep their own types so
+		//		helpers can tell them apart
+		switch(mType)
+		{
+			case DatumType::Integer:	return visitor(TypeTag<int32_t>());
+			case DatumType::Float:		return visitor(TypeTag<float>());
+			case DatumType::String:		return visitor(TypeTag<string>());
+			case DatumType::Pointer:	return visitor(TypeTag<RTTI*>());
+			case DatumType::Matrix:		return visitor(TypeTag<mat4x4>());
+			case DatumType::Vector:		return visitor(TypeTag<vec4>());
+			case DatumType::Table:		return visitor(TypeTag<Scope*>());
+			default:					throw exception("Error -- cannot operate on a Datum that has no type!");
+		}
+	}
 
 	//-----------------------------------------------------------------
 
-	Datum::ReserveFuncs Datum::sReserveFuncs[(uint32_t)DatumType::Unknown] =
+	namespace
 	{
-		&Datum::reserveHelper<int32_t>,
-		&Datum::reserveHelper<float>,
-		&Datum::reserveHelper<string>,
-		&Datum::reserveHelper<RTTI*>,
-		&Datum::reserveHelper<mat4x4>,
-		&Datum::reserveHelper<vec4>,
-		&Datum::reserveHelper<Scope*>
-	};
+		// element comparison -- values compare with ==, pointers defer to RTTI::Equals
+		template <typename T>
+		inline bool elementsEqual(const T& lhs, const T& rhs)
+		{
+			return lhs == rhs;
+		}
 
-	//-----------------------------------------------------------------
+		inline bool elementsEqual(RTTI* const& lhs, RTTI* const& rhs)
+		{
+			// if the pointer is null, the result is whether or not the other pointer is null
+			return lhs == nullptr ? rhs == nullptr : lhs->Equals(rhs);
+		}
 
-	Datum::ShrinkToFitFuncs Datum::sShrinkToFitFuncs[(uint32_t)DatumType::Unknown] =
-	{
-		&Datum::shrinkToFitHelper<int32_t>,
-		&Datum::shrinkToFitHelper<float>,
-		&Datum::shrinkToFitHelper<string>,
-		&Datum::shrinkToFitHelper<RTTI*>,
-		&Datum::shrinkToFitHelper<mat4x4>,
-		&Datum::shrinkToFitHelper<vec4>,
-		&Datum::shrinkToFitHelper<Scope*>
-	};
+		inline bool elementsEqual(Scope* const& lhs, Scope* const& rhs)
+		{
+			return elementsEqual(static_cast<RTTI*>(lhs), static_cast<RTTI*>(rhs));
+		}
+	}
+
+#pragma endregion
 
 	//-----------------------------------------------------------------
 
-	Datum::RemoveAtFuncs Datum::sRemoveAtFuncs[(uint32_t)DatumType::Unknown] =
+#pragma region String Conversion
+
+	namespace
 	{
-		&Datum::removeAtHelper<int32_t>,
-		&Datum::removeAtHelper<float>,
-		&Datum::removeAtHelper<string>,
-		&Datum::removeAtHelper<RTTI*>,
-		&Datum::removeAtHelper<mat4x4>,
-		&Datum::removeAtHelper<vec4>,
-		&Datum::removeAtHelper<Scope*>
-	};
+		// hand-written so conversions don't go through sscanf, streams, or the C locale
+		//		parsing accepts what the old sscanf formats accepted, and formatting produces exactly what %f did
 
-	//-----------------------------------------------------------------
+		// every power of ten a float holds exactly (5^10 still fits in 24 bits)
+		const float sPowersOfTen[] =
+		{
+			1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+		};
 
-	Datum::PopBackFuncs Datum::sPopBackFuncs[(uint32_t)DatumType::Unknown] =
-	{
-		&Datum::popBackHelper<int32_t>,
-		&Datum::popBackHelper<float>,
-		&Datum::popBackHelper<string>,
-		&Datum::popBackHelper<RTTI*>,
-		&Datum::popBackHelper<mat4x4>,
-		&Datum::popBackHelper<vec4>,
-		&Datum::popBackHelper<Scope*>
-	};
+		//-----------------------------------------------------------------
 
-	//-----------------------------------------------------------------
+		inline bool isDigit(const char c)
+		{
+			return c >= '0' && c <= '9';
+		}
 
-	Datum::ClearFuncs Datum::sClearFuncs[(uint32_t)DatumType::Unknown] =
-	{
-		&Datum::clearHelper<int32_t>,
-		&Datum::clearHelper<float>,
-		&Datum::clearHelper<string>,
-		&Datum::clearHelper<RTTI*>,
-		&Datum::clearHelper<mat4x4>,
-		&Datum::clearHelper<vec4>,
-		&Datum::clearHelper<Scope*>
-	};
+		//-----------------------------------------------------------------
 
-	//-----------------------------------------------------------------
+		inline void skipSpace(const char*& cursor)
+		{
+			while(*cursor == ' ' || (*cursor >= '\t' && *cursor <= '\r'))
+			{
+				++cursor;
+			}
+		}
 
-	Datum::PushFromStringFuncs Datum::sPushFromStringFuncs[(std::uint32_t)DatumType::Unknown] =
-	{
-		&Datum::pushBackFromStringHelper<int32_t>,
-		&Datum::pushBackFromStringHelper<float>,
-		&Datum::pushBackFromStringHelper<string>,
-		nullptr,
-		&Datum::pushBackFromStringHelper<mat4x4>,
-		&Datum::pushBackFromStringHelper<vec4>,
-		nullptr
-	};
+		//-----------------------------------------------------------------
 
-	//-----------------------------------------------------------------
+		inline bool matchLiteral(const char*& cursor, const char* literal)
+		{
+			skipSpace(cursor);
 
-	Datum::SetFromStringFuncs Datum::sSetFromStringFuncs[(std::uint32_t)DatumType::Unknown] =
-	{
-		&Datum::setFromStringHelper<int32_t>,
-		&Datum::setFromStringHelper<float>,
-		&Datum::setFromStringHelper<string>,
-		nullptr,
-		&Datum::setFromStringHelper<mat4x4>,
-		&Datum::setFromStringHelper<vec4>,
-		nullptr
-	};
+			const char* position = cursor;
+			for(; *literal != '\0'; ++literal, ++position)
+			{
+				if(*position != *literal)
+				{
+					return false;
+				}
+			}
 
-	//-----------------------------------------------------------------
+			cursor = position;
+			return true;
+		}
 
-	Datum::ToStringFuncs Datum::sToStringFuncs[(std::uint32_t)DatumType::Unknown] =
-	{
-		&Datum::toStringInt,
-		&Datum::toStringFloat,
-		&Datum::toStringString,
-		&Datum::toStringRTTI,
-		&Datum::toStringMatrix,
-		&Datum::toStringVector,
-		&Datum::toStringRTTI
-	};
+		//-----------------------------------------------------------------
 
-	//-----------------------------------------------------------------
+		inline bool parseInt(const char*& cursor, int32_t& data)
+		{
+			skipSpace(cursor);
 
-	Datum::CopyFuncs Datum::sCopyFuncs[(std::uint32_t)DatumType::Unknown] =
-	{
-		&Datum::performDeepCopyHelper<int32_t>,
-		&Datum::performDeepCopyHelper<float>,
-		&Datum::performDeepCopyHelper<string>,
-		&Datum::performDeepCopyHelperRTTI,
-		&Datum::performDeepCopyHelper<mat4x4>,
-		&Datum::performDeepCopyHelper<vec4>,
-		&Datum::performDeepCopyHelperRTTI
-	};
+			const char* position = cursor;
+			bool isNegative = *position == '-';
+			if(*position == '-' || *position == '+')
+			{
+				++position;
+			}
+
+			if(!isDigit(*position))
+			{
+				return false;
+			}
+
+			// out of range values saturate
+			uint64_t magnitude = 0;
+			for(; isDigit(*position); ++position)
+			{
+				if(magnitude <= 0x80000000ull)
+				{
+					magnitude = magnitude * 10 + (*position - '0');
+				}
+			}
+
+			uint64_t limit = isNegative ? 0x80000000ull : 0x7FFFFFFFull;
+			magnitude = magnitude > limit ? limit : magnitude;
+			data = isNegative ? static_cast<int32_t>(0 - magnitude) : static_cast<int32_t>(magnitude);
+
+			cursor = position;
+			return true;
+		}
+
+		//-----------------------------------------------------------------
+
+		inline bool parseFloat(const char*& cursor, float& data)
+		{
+			skipSpace(cursor);
+
+			const char* position = cursor;
+			bool isNegative = *position == '-';
+			if(*position == '-' || *position == '+')
+			{
+				++position;
+			}
+
+			// up to 19 significant digits fit in the mantissa, any more and we leave it to strtof
+			uint64_t mantissa = 0;
+			int32_t exponent = 0;
+			uint32_t numSignificant = 0;
+			bool hasDigits = false, isTruncated = false;
+
+			for(; isDigit(*position); ++position)
+			{
+				hasDigits = true;
+				if(numSignificant < 19)
+				{
+					mantissa = mantissa * 10 + (*position - '0');
+					numSignificant += (mantissa != 0) ? 1 : 0;
+				}
+				else
+				{
+					++exponent;
+					isTruncated = true;
+				}
+			}
+
+			if(*position == '.')
+			{
+				++position;
+				for(; isDigit(*position); ++position)
+				{
+					hasDigits = true;
+					if(numSignificant < 19)
+					{
+						mantissa = mantissa * 10 + (*position - '0');
+						numSignificant += (mantissa != 0) ? 1 : 0;
+						--exponent;
+					}
+					else
+					{
+						isTruncated = true;
+					}
+				}
+			}
+
+			if(hasDigits && (*position == 'e' || *position == 'E'))
+			{
+				const char* exponentPosition = position + 1;
+				bool isExponentNegative = *exponentPosition == '-';
+				if(*exponentPosition == '-' || *exponentPosition == '+')
+				{
+					++exponentPosition;
+				}
+
+				// only an exponent with digits belongs to the number
+				if(isDigit(*exponentPosition))
+				{
+					int32_t exponentValue = 0;
+					for(; isDigit(*exponentPosition); ++exponentPosition)
+					{
+						exponentValue = (exponentValue < 10000) ? exponentValue * 10 + (*exponentPosition - '0') : exponentValue;
+					}
+
+					exponent += isExponentNegative ? -exponentValue : exponentValue;
+					position = exponentPosition;
+				}
+			}
+
+			// exact mantissa and a power of ten that a float holds exactly: one correctly rounded float operation
+			//		(going through a double would round twice, which can be 1 ulp off in halfway cases)
+			if(hasDigits && !isTruncated && mantissa <= (1ull << 24) && exponent >= -10 && exponent <= 10)
+			{
+				float value = static_cast<float>(mantissa);
+				value = (exponent < 0) ? value / sPowersOfTen[-exponent] : value * sPowersOfTen[exponent];
+				data = isNegative ? -value : value;
+
+				cursor = position;
+				return true;
+			}
+
+			// long mantissas, huge exponents, inf and nan
+			char* end = nullptr;
+			float value = strtof(cursor, &end);
+			if(end == cursor)
+			{
+				return false;
+			}
+
+			data = value;
+			cursor = end;
+			return true;
+		}
+
+		//-----------------------------------------------------------------
+
+		inline bool parseVector(const char*& cursor, vec4& data)
+		{
+			return matchLiteral(cursor, "vec4") && matchLiteral(cursor, "(") &&
+				parseFloat(cursor, data.x) && matchLiteral(cursor, ",") &&
+				parseFloat(cursor, data.y) && matchLiteral(cursor, ",") &&
+				parseFloat(cursor, data.z) && matchLiteral(cursor, ",") &&
+				parseFloat(cursor, data.w) && matchLiteral(cursor, ")");
+		}
+
+		//-----------------------------------------------------------------
+
+		inline bool parseMatrix(const char*& cursor, mat4x4& data)
+		{
+			if(!matchLiteral(cursor, "mat4x4") || !matchLiteral(cursor, "("))
+			{
+				return false;
+			}
+
+			for(uint32_t column = 0; column < 4; ++column)
+			{
+				if((column > 0 && !matchLiteral(cursor, ",")) || !matchLiteral(cursor, "(") ||
+					!parseFloat(cursor, data[column].x) || !matchLiteral(cursor, ",") ||
+					!parseFloat(cursor, data[column].y) || !matchLiteral(cursor, ",") ||
+					!parseFloat(cursor, data[column].z) || !matchLiteral(cursor, ",") ||
+					!parseFloat(cursor, data[column].w) || !matchLiteral(cursor, ")"))
+				{
+					return false;
+				}
+			}
+
+			return matchLiteral(cursor, ")");
+		}
+
+		//-----------------------------------------------------------------
+
+		inline void appendInt(string& str, const int32_t data)
+		{
+			char buffer[12];
+			char* end = buffer + sizeof(buffer);
+			char* position = end;
+
+			uint32_t magnitude = (data < 0) ? 0u - static_cast<uint32_t>(data) : static_cast<uint32_t>(data);
+			do
+			{
+				*--position = static_cast<char>('0' + magnitude % 10);
+				magnitude /= 10;
+			} while(magnitude != 0);
+
+			if(data < 0)
+			{
+				*--position = '-';
+			}
+
+			str.append(position, end);
+		}
+
+		//-----------------------------------------------------------------
+
+		inline void appendFloat(string& str, const float data)
+		{
+			double magnitude = fabs(static_cast<double>(data));
+
+			// inf, nan, and values too big for the integer path keep the %f formatting of to_string
+			if(!(magnitude < 1.0e12))
+			{
+				str.append(std::to_string(data));
+				return;
+			}
+
+			// a float has 24 significant bits and 10^6 needs 20, so the scaled value is exact in a double,
+			//		and rounding it to an integer (ties to even) gives the same six decimals %f does
+			double scaled = magnitude * 1000000.0;
+			uint64_t units = static_cast<uint64_t>(scaled);
+			double remainder = scaled - static_cast<double>(units);
+			if(remainder > 0.5 || (remainder == 0.5 && (units & 1) != 0))
+			{
+				++units;
+			}
+
+			char buffer[32];
+			char* end = buffer + sizeof(buffer);
+			char* position = end;
+
+			for(uint32_t i = 0; i < 6; ++i)
+			{
+				*--position = static_cast<char>('0' + units % 10);
+				units /= 10;
+			}
+			*--position = '.';
+
+			do
+			{
+				*--position = static_cast<char>('0' + units % 10);
+				units /= 10;
+			} while(units != 0);
+
+			if(signbit(data))
+			{
+				*--position = '-';
+			}
+
+			str.append(position, end);
+		}
+
+		//-----------------------------------------------------------------
+
+		// element conversion to string, in the same formats glm::to_string and std::to_string use
+		inline string elementToString(const int32_t& data)
+		{
+			string str;
+			appendInt(str, data);
+			return str;
+		}
+
+		inline string elementToString(const float& data)
+		{
+			string str;
+			appendFloat(str, data);
+			return str;
+		}
+
+		inline string elementToString(const string& data)
+		{
+			return data;
+		}
+
+		inline string elementToString(const vec4& data)
+		{
+			string str;
+			str.reserve(64);
+			str.append("vec4(");
+			for(uint32_t i = 0; i < 4; ++i)
+			{
+				if(i > 0)
+				{
+					str.append(", ");
+				}
+				appendFloat(str, data[i]);
+			}
+			str.append(")");
+			return str;
+		}
+
+		inline string elementToString(const mat4x4& data)
+		{
+			string str;
+			str.reserve(256);
+			str.append("mat4x4(");
+			for(uint32_t column = 0; column < 4; ++column)
+			{
+				str.append(column > 0 ? ", (" : "(");
+				for(uint32_t row = 0; row < 4; ++row)
+				{
+					if(row > 0)
+					{
+						str.append(", ");
+					}
+					appendFloat(str, data[column][row]);
+				}
+				str.append(")");
+			}
+			str.append(")");
+			return str;
+		}
+
+		inline string elementToString(RTTI* const& data)
+		{
+			return data != nullptr ? data->ToString() : "";
+		}
+
+		inline string elementToString(Scope* const& data)
+		{
+			return elementToString(static_cast<RTTI*>(data));
+		}
+	}
 
 #pragma endregion
 
@@ -152,7 +434,9 @@ namespace DOGEngine
 		mType(type),
 		mSize(0),
 		mCapacity(0),
-		mIsExternal(false)
+		mStride(0),
+		mIsExternal(false),
+		mIsAliased(false)
 	{
 		mData.v = nullptr;
 	}
@@ -165,12 +449,18 @@ namespace DOGEngine
 		if(other.mIsExternal)
 		{
 			// if other is external...
-			//		sets size, capacity, external bool, location of data
+			//		sets size, capacity, stride, external bool, location of data
 			mData.v = other.mData.v;
 			mSize = other.mSize;
 			mCapacity = other.mCapacity;
+			mStride = other.mStride;
 			mIsExternal = other.mIsExternal;
 		}
+		else if(other.canShare())
+		{
+			// if other owns a heap array, we share it until one of us writes to it
+			shareStorage(other);
+		}
 		else
 		{
 			// if other is internal...
@@ -185,14 +475,18 @@ namespace DOGEngine
 		mType(other.mType),
 		mSize(other.mSize),
 		mCapacity(other.mCapacity),
-		mIsExternal(other.mIsExternal)
+		mStride(other.mStride),
+		mIsExternal(other.mIsExternal),
+		mIsAliased(other.mIsAliased)
 	{
-		mData.v = other.mData.v;
+		moveStorage(other);
 
 		other.mType = DatumType::Unknown;
 		other.mSize = 0;
 		other.mCapacity = 0;
+		other.mStride = 0;
 		other.mIsExternal = false;
+		other.mIsAliased = false;
 		other.mData.v = nullptr;
 	}
 
@@ -200,11 +494,10 @@ namespace DOGEngine
 
 	Datum::~Datum()
 	{
-		// can only clear and free memory that we own and if we have a type
+		// can only clear and free memory that we own -- a shared array is only freed by its last owner
 		if(!mIsExternal)
 		{
-			clear();
-			free(mData.v);
+			releaseStorage();
 		}
 	}
 
@@ -218,35 +511,60 @@ namespace DOGEngine
 	{
 		if(this != &other)
 		{
-			// our original data is internal, blow it away completely
-			// if the data is external, we just set the data pointer
-			if(!mIsExternal)
+			if(other.canShare())
 			{
-				clear();
-				free(mData.v);
+				// other owns a heap array -- share it, unless we already do
+				if(mIsExternal || mData.v != other.mData.v)
+				{
+					if(!mIsExternal)
+					{
+						releaseStorage();
+					}
+					mIsExternal = false;
+					mStride = 0;
+					mType = other.mType;
+
+					shareStorage(other);
+				}
 			}
-			mIsExternal = false;
-			mData.v = nullptr;
-
-			// setting type so any methods we need to call resolve against the required type
-			mType = other.mType;
-
-			if(other.mIsExternal)
+			else if(!mIsExternal && !other.mIsExternal && mType == other.mType && mType != DatumType::Unknown && !isShared())
 			{
-				// other is external -- we now point to other's (sets size, capacity, data location)
-				mData.v = other.mData.v;
-				mSize = other.mSize;
-				mCapacity = other.mCapacity;
+				// both own values of the same type -- copy over what we already have instead of reallocating
+				visit([this, &other](auto tag) { copyAssignHelper<typename decltype(tag)::Type>(other); });
 			}
 			else
 			{
-				// other is internal -- deep copy other's data (sets size, capacity, copies data)
-				mCapacity = mSize = 0;
-				performDeepCopy(other);
-			}
+				// our original data is internal, blow it away completely (or let go of it, if it is shared)
+				// if the data is external, we just set the data pointer
+				if(!mIsExternal)
+				{
+					releaseStorage();
+				}
+				mIsExternal = false;
+				mStride = 0;
+				mData.v = nullptr;
 
-			// setting external bool last now that all needed methods have been called
-			mIsExternal = other.mIsExternal;
+				// setting type so any methods we need to call resolve against the required type
+				mType = other.mType;
+
+				if(other.mIsExternal)
+				{
+					// other is external -- we now point to other's (sets size, capacity, stride, data location)
+					mData.v = other.mData.v;
+					mSize = other.mSize;
+					mCapacity = other.mCapacity;
+					mStride = other.mStride;
+				}
+				else
+				{
+					// other is internal -- deep copy other's data (sets size, capacity, copies data)
+					mCapacity = mSize = 0;
+					performDeepCopy(other);
+				}
+
+				// setting external bool last now that all needed methods have been called
+				mIsExternal = other.mIsExternal;
+			}
 		}
 
 		return *this;
@@ -259,22 +577,25 @@ namespace DOGEngine
 		if(&other != this)
 		{
 			// clear data if we have inserted values and we're not external
-			if(mType != DatumType::Unknown && !mIsExternal)
+			if(!mIsExternal)
 			{
-				clear();
-				free(mData.v);
+				releaseStorage();
 			}
 
 			mType = other.mType;
 			mSize = other.mSize;
 			mCapacity = other.mCapacity;
+			mStride = other.mStride;
 			mIsExternal = other.mIsExternal;
-			mData.v = other.mData.v;
+			mIsAliased = other.mIsAliased;
+			moveStorage(other);
 
 			other.mType = DatumType::Unknown;
 			other.mSize = 0;
 			other.mCapacity = 0;
+			other.mStride = 0;
 			other.mIsExternal = false;
+			other.mIsAliased = false;
 			other.mData.v = nullptr;
 		}
 
@@ -354,7 +675,7 @@ namespace DOGEngine
 		else
 		{
 			// typed, so we run a templated helper function
-			result = Datum::sComparisonFuncs[static_cast<uint32_t>(mType)](*this, other);
+			result = visit([this, &other](auto tag) { return comparisonHelper<typename decltype(tag)::Type>(other); });
 		}
 
 		return result;
@@ -479,7 +800,7 @@ namespace DOGEngine
 			throw exception("Error -- cannot reserve space for a Datum that has no type!");
 		}
 
-		Datum::sReserveFuncs[static_cast<uint32_t>(mType)](*this, reserveSize);
+		visit([this, reserveSize](auto tag) { reserveHelper<typename decltype(tag)::Type>(reserveSize); });
 	}
 
 	//-----------------------------------------------------------------
@@ -491,7 +812,7 @@ namespace DOGEngine
 			throw exception("Error -- cannot shrink space for a Datum that has no type!");
 		}
 
-		Datum::sShrinkToFitFuncs[static_cast<uint32_t>(mType)](*this);
+		visit([this](auto tag) { shrinkToFitHelper<typename decltype(tag)::Type>(); });
 	}
 
 #pragma endregion
@@ -500,44 +821,56 @@ namespace DOGEngine
 
 #pragma region SetStorage
 
-	void Datum::setStorage(int32_t* const& data, const uint32_t size)
+	void Datum::setStorage(int32_t* const& data, const uint32_t size, const uint32_t stride)
+	{
+		setStorageHelper<int32_t>(data, size, stride, DatumType::Integer);
+	}
+
+	//-----------------------------------------------------------------
+
+	void Datum::setStorage(float* const& data, const uint32_t size, const uint32_t stride)
 	{
-		setStorageHelper<int32_t>(data, size, DatumType::Integer);
+		setStorageHelper<float>(data, size, stride, DatumType::Float);
 	}
 
 	//-----------------------------------------------------------------
 
-	void Datum::setStorage(float* const& data, const uint32_t size)
+	void Datum::setStorage(string* const& data, const uint32_t size, const uint32_t stride)
 	{
-		setStorageHelper<float>(data, size, DatumType::Float);
+		setStorageHelper<string>(data, size, stride, DatumType::String);
 	}
 
 	//-----------------------------------------------------------------
 
-	void Datum::setStorage(string* const& data, const uint32_t size)
+	void Datum::setStorage(RTTI** const& data, const uint32_t size, const uint32_t stride)
 	{
-		setStorageHelper<string>(data, size, DatumType::String);
+		setStorageHelper<RTTI*>(data, size, stride, DatumType::Pointer);
 	}
 
 	//-----------------------------------------------------------------
 
-	void Datum::setStorage(RTTI** const& data, const uint32_t size)
+	void Datum::setStorage(vec4* const& data, const uint32_t size, const uint32_t stride)
 	{
-		setStorageHelper<RTTI*>(data, size, DatumType::Pointer);
+		setStorageHelper<vec4>(data, size, stride, DatumType::Vector);
 	}
 
 	//-----------------------------------------------------------------
 
-	void Datum::setStorage(vec4* const& data, const uint32_t size)
+	void Datum::setStorage(mat4x4* const& data, const uint32_t size, const uint32_t stride)
 	{
-		setStorageHelper<vec4>(data, size, DatumType::Vector);
+		setStorageHelper<mat4x4>(data, size, stride, DatumType::Matrix);
 	}
 
 	//-----------------------------------------------------------------
 
-	void Datum::setStorage(mat4x4* const& data, const uint32_t size)
+	void Datum::rebindStorage(void* const data)
 	{
-		setStorageHelper<mat4x4>(data, size, DatumType::Matrix);
+		if(!mIsExternal)
+		{
+			throw exception("Error -- cannot rebind a Datum that owns its memory!");
+		}
+
+		mData.v = data;
 	}
 
 #pragma endregion
@@ -649,7 +982,7 @@ namespace DOGEngine
 		// noop for untyped Datum
 		if(mType != DatumType::Unknown)
 		{
-			Datum::sRemoveAtFuncs[static_cast<uint32_t>(mType)](*this, index);
+			visit([this, index](auto tag) { removeAtHelper<typename decltype(tag)::Type>(index); });
 		}
 	}
 
@@ -660,7 +993,7 @@ namespace DOGEngine
 		// noop for untyped Datum
 		if(mType != DatumType::Unknown)
 		{
-			Datum::sPopBackFuncs[static_cast<uint32_t>(mType)](*this);
+			visit([this](auto tag) { popBackHelper<typename decltype(tag)::Type>(); });
 		}
 	}
 
@@ -671,7 +1004,7 @@ namespace DOGEngine
 		// noop for untyped Datum
 		if(mType != DatumType::Unknown)
 		{
-			Datum::sClearFuncs[static_cast<uint32_t>(mType)](*this);
+			visit([this](auto tag) { clearHelper<typename decltype(tag)::Type>(); });
 		}
 	}
 
@@ -733,7 +1066,7 @@ namespace DOGEngine
 	template<>
 	int32_t& Datum::get<int32_t>(const uint32_t index)
 	{
-		return getHelper<int32_t>(index, DatumType::Integer);
+		return mutableGetHelper<int32_t>(index, DatumType::Integer);
 	}
 
 	//-----------------------------------------------------------------
@@ -741,7 +1074,7 @@ namespace DOGEngine
 	template<>
 	float& Datum::get<float>(const uint32_t index)
 	{
-		return getHelper<float>(index, DatumType::Float);
+		return mutableGetHelper<float>(index, DatumType::Float);
 	}
 
 	//-----------------------------------------------------------------
@@ -749,7 +1082,7 @@ namespace DOGEngine
 	template<>
 	string& Datum::get<string>(const uint32_t index)
 	{
-		return getHelper<string>(index, DatumType::String);
+		return mutableGetHelper<string>(index, DatumType::String);
 	}
 
 	//-----------------------------------------------------------------
@@ -757,7 +1090,7 @@ namespace DOGEngine
 	template<>
 	RTTI*& Datum::get<RTTI*>(const uint32_t index)
 	{
-		return getHelper<RTTI*>(index, DatumType::Pointer);
+		return mutableGetHelper<RTTI*>(index, DatumType::Pointer);
 	}
 
 	//-----------------------------------------------------------------
@@ -765,7 +1098,7 @@ namespace DOGEngine
 	template<>
 	vec4& Datum::get<vec4>(const uint32_t index)
 	{
-		return getHelper<vec4>(index, DatumType::Vector);
+		return mutableGetHelper<vec4>(index, DatumType::Vector);
 	}
 
 	//-----------------------------------------------------------------
@@ -773,7 +1106,7 @@ namespace DOGEngine
 	template<>
 	mat4x4& Datum::get<mat4x4>(const uint32_t index)
 	{
-		return getHelper<mat4x4>(index, DatumType::Matrix);
+		return mutableGetHelper<mat4x4>(index, DatumType::Matrix);
 	}
 
 	//-----------------------------------------------------------------
@@ -842,83 +1175,185 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	Datum& Datum::operator[](const string& name)
+	template<>
+	int32_t* Datum::data<int32_t>()
 	{
-		return get<Scope>()[name];
+		return mutableDataHelper<int32_t>(DatumType::Integer);
 	}
 
 	//-----------------------------------------------------------------
 
-	Scope& Datum::operator[](std::uint32_t index)
+	template<>
+	float* Datum::data<float>()
 	{
-		return get<Scope>(index);
+		return mutableDataHelper<float>(DatumType::Float);
 	}
 
 	//-----------------------------------------------------------------
 
-	const Scope& Datum::operator[](std::uint32_t index) const
+	template<>
+	string* Datum::data<string>()
 	{
-		return get<Scope>(index);
+		return mutableDataHelper<string>(DatumType::String);
 	}
 
-#pragma endregion
-
 	//-----------------------------------------------------------------
 
-#pragma region To & From String
-
-	void Datum::pushBackFromString(const string& str)
+	template<>
+	vec4* Datum::data<vec4>()
 	{
-		if(mType == DatumType::Unknown)
-		{
-			throw exception("Error -- cannot set data from string on a Datum with no type!");
-		}
-
-		if(mType == DatumType::Pointer)
-		{
-			throw exception("Error -- cannot set data from string on a Datum with type Pointer!");
-		}
-
-		if(mType == DatumType::Table)
-		{
-			throw exception("Error -- cannot set data from string on a Datum with type Table!");
-		}
-
-		Datum::sPushFromStringFuncs[static_cast<uint32_t>(mType)](*this, str);
+		return mutableDataHelper<vec4>(DatumType::Vector);
 	}
 
 	//-----------------------------------------------------------------
 
-	void Datum::setFromString(const string& str, const uint32_t index)
+	template<>
+	mat4x4* Datum::data<mat4x4>()
 	{
-		if(mType == DatumType::Unknown)
-		{
-			throw exception("Error -- cannot set data from string on a Datum with no type!");
-		}
+		return mutableDataHelper<mat4x4>(DatumType::Matrix);
+	}
 
-		if(mType == DatumType::Pointer)
-		{
-			throw exception("Error -- cannot set data from string on a Datum with type Pointer!");
-		}
-		
-		if(mType == DatumType::Table)
-		{
-			throw exception("Error -- cannot set data from string on a Datum with type Table!");
-		}
+	//-----------------------------------------------------------------
 
-		Datum::sSetFromStringFuncs[static_cast<uint32_t>(mType)](*this, str, index);
+	template<>
+	const int32_t* Datum::data<int32_t>() const
+	{
+		return dataHelper<int32_t>(DatumType::Integer);
 	}
 
 	//-----------------------------------------------------------------
 
-	string Datum::toString(const uint32_t index) const
+	template<>
+	const float* Datum::data<float>() const
+	{
+		return dataHelper<float>(DatumType::Float);
+	}
+
+	//-----------------------------------------------------------------
+
+	template<>
+	const string* Datum::data<string>() const
+	{
+		return dataHelper<string>(DatumType::String);
+	}
+
+	//-----------------------------------------------------------------
+
+	template<>
+	const vec4* Datum::data<vec4>() const
+	{
+		return dataHelper<vec4>(DatumType::Vector);
+	}
+
+	//-----------------------------------------------------------------
+
+	template<>
+	const mat4x4* Datum::data<mat4x4>() const
+	{
+		return dataHelper<mat4x4>(DatumType::Matrix);
+	}
+
+	//-----------------------------------------------------------------
+
+	Datum& Datum::operator[](const string& name)
+	{
+		return get<Scope>()[name];
+	}
+
+	//-----------------------------------------------------------------
+
+	Scope& Datum::operator[](std::uint32_t index)
+	{
+		return get<Scope>(index);
+	}
+
+	//-----------------------------------------------------------------
+
+	const Scope& Datum::operator[](std::uint32_t index) const
+	{
+		return get<Scope>(index);
+	}
+
+#pragma endregion
+
+	//-----------------------------------------------------------------
+
+#pragma region To & From String
+
+	void Datum::pushBackFromString(const string& str)
+	{
+		if(mType == DatumType::Unknown)
+		{
+			throw exception("Error -- cannot set data from string on a Datum with no type!");
+		}
+
+		if(mType == DatumType::Pointer)
+		{
+			throw exception("Error -- cannot set data from string on a Datum with type Pointer!");
+		}
+
+		if(mType == DatumType::Table)
+		{
+			throw exception("Error -- cannot set data from string on a Datum with type Table!");
+		}
+
+		visit([this, &str](auto tag) { pushBackFromStringHelper<typename decltype(tag)::Type>(str); });
+	}
+
+	//-----------------------------------------------------------------
+
+	uint32_t Datum::pushBackArrayFromString(const string& str)
+	{
+		if(mType == DatumType::Unknown)
+		{
+			throw exception("Error -- cannot set data from string on a Datum with no type!");
+		}
+
+		if(mType == DatumType::Pointer)
+		{
+			throw exception("Error -- cannot set data from string on a Datum with type Pointer!");
+		}
+
+		if(mType == DatumType::Table)
+		{
+			throw exception("Error -- cannot set data from string on a Datum with type Table!");
+		}
+
+		return visit([this, &str](auto tag) { return pushBackArrayFromStringHelper<typename decltype(tag)::Type>(str); });
+	}
+
+	//-----------------------------------------------------------------
+
+	void Datum::setFromString(const string& str, const uint32_t index)
+	{
+		if(mType == DatumType::Unknown)
+		{
+			throw exception("Error -- cannot set data from string on a Datum with no type!");
+		}
+
+		if(mType == DatumType::Pointer)
+		{
+			throw exception("Error -- cannot set data from string on a Datum with type Pointer!");
+		}
+		
+		if(mType == DatumType::Table)
+		{
+			throw exception("Error -- cannot set data from string on a Datum with type Table!");
+		}
+
+		visit([this, &str, index](auto tag) { setFromStringHelper<typename decltype(tag)::Type>(str, index); });
+	}
+
+	//-----------------------------------------------------------------
+
+	string Datum::toString(const uint32_t index) const
 	{
 		if(mType == DatumType::Unknown)
 		{
 			throw exception("Error -- cannot get data as a string from a Datum with no type!");
 		}
 
-		return Datum::sToStringFuncs[static_cast<uint32_t>(mType)](*this, index);
+		return visit([this, index](auto tag) { return toStringHelper<typename decltype(tag)::Type>(index); });
 	}
 
 #pragma endregion
@@ -968,6 +1403,13 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
+	uint32_t Datum::stride() const
+	{
+		return mStride;
+	}
+
+	//-----------------------------------------------------------------
+
 	bool Datum::isEmpty() const
 	{
 		return mSize == 0;
@@ -981,13 +1423,155 @@ namespace DOGEngine
 
 #pragma region Private Templated Helper Functions
 
+#pragma region Storage Helpers
+
+	template <typename T>
+	bool Datum::fitsInline(const uint32_t capacity)
+	{
+		return capacity * sizeof(T) <= sizeof(mInline);
+	}
+
+	//-----------------------------------------------------------------
+
+	bool Datum::isInline() const
+	{
+		return mData.v == &mInline;
+	}
+
+	//-----------------------------------------------------------------
+
+	void Datum::freeStorage()
+	{
+		// the inline buffer is part of the Datum, only heap arrays are freed
+		if(!isInline() && mData.v != nullptr)
+		{
+			free(header());
+		}
+	}
+
+	//-----------------------------------------------------------------
+
+	void Datum::moveStorage(Datum& other)
+	{
+		if(other.isInline())
+		{
+			// inline values live inside other, so they are relocated bitwise the same way reserve relocates heap arrays
+			memcpy(&mInline, &other.mInline, sizeof(mInline));
+			mData.v = &mInline;
+		}
+		else
+		{
+			mData.v = other.mData.v;
+		}
+	}
+
+	//-----------------------------------------------------------------
+
+	void* Datum::allocateArray(const size_t size)
+	{
+		// the count sits in front of the values, and is padded so they stay aligned
+		SharedHeader* header = static_cast<SharedHeader*>(malloc(sizeof(SharedHeader) + size));
+		new(header) SharedHeader();
+		header->mRefCount = 1;
+
+		return header + 1;
+	}
+
+	//-----------------------------------------------------------------
+
+	Datum::SharedHeader* Datum::header() const
+	{
+		return static_cast<SharedHeader*>(mData.v) - 1;
+	}
+
+	//-----------------------------------------------------------------
+
+	bool Datum::isShared() const
+	{
+		return !mIsExternal && mData.v != nullptr && !isInline() && header()->mRefCount > 1;
+	}
+
+	//-----------------------------------------------------------------
+
+	bool Datum::canShare() const
+	{
+		// Scopes have a single parent, so only value arrays are shared
+		return !mIsExternal && !mIsAliased && mType != DatumType::Table && mData.v != nullptr && !isInline();
+	}
+
+	//-----------------------------------------------------------------
+
+	void Datum::shareStorage(const Datum& other)
+	{
+		// only a Datum already holding the array can raise the count, so it can't be on its way to 0
+		++other.header()->mRefCount;
+
+		mData.v = other.mData.v;
+		mSize = other.mSize;
+		mCapacity = other.mCapacity;
+		mIsAliased = false;
+	}
+
+	//-----------------------------------------------------------------
+
+	void Datum::releaseStorage()
+	{
+		// the values in a shared array are left to the Datums still sharing it
+		if(mData.v != nullptr && (isInline() || --header()->mRefCount == 0))
+		{
+			clear();
+			freeStorage();
+		}
+
+		mData.v = nullptr;
+		mSize = 0;
+		mCapacity = 0;
+		mIsAliased = false;
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename T>
+	void Datum::makeUnique()
+	{
+		if(isShared())
+		{
+			cloneStorage<T>(mCapacity);
+		}
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename T>
+	void Datum::cloneStorage(const uint32_t capacity)
+	{
+		// the other Datums still read the shared values, so they are copied rather than relocated
+		T* newArray = fitsInline<T>(capacity) ? reinterpret_cast<T*>(&mInline) : static_cast<T*>(allocateArray(capacity * sizeof(T)));
+		const T* sharedArray = reinterpret_cast<const T*>(mData.v);
+		for(uint32_t i = 0; i < mSize; ++i)
+		{
+			new(newArray + i)T(sharedArray[i]);
+		}
+
+		uint32_t size = mSize;
+		releaseStorage();
+
+		mData.v = newArray;
+		mSize = size;
+		mCapacity = capacity;
+	}
+
+#pragma endregion
+
+	//-----------------------------------------------------------------
+
 #pragma region Copy Helpers
 
 	void Datum::performDeepCopy(const Datum& other)
 	{
 		if(mType != DatumType::Unknown)
 		{
-			Datum::sCopyFuncs[static_cast<uint32_t>(mType)](*this, other);
+			visit([this, &other](auto tag) { performDeepCopyHelper<typename decltype(tag)::Type>(other); });
 		}
 	}
 
@@ -997,20 +1581,41 @@ namespace DOGEngine
 	void Datum::performDeepCopyHelper(const Datum& other)
 	{
 		reserveHelper<T>(other.mCapacity);
-		for(uint32_t i = 0; i < other.mSize; ++i)
+
+		// other's type is ours, so copy construct straight into place without per element checks
+		const T* otherArray = reinterpret_cast<const T*>(other.mData.v);
+		T* dataArray = reinterpret_cast<T*>(mData.v);
+		for(; mSize < other.mSize; ++mSize)
 		{
-			pushBackHelper<T>(other.get<T>(i), mType);
+			new(dataArray + mSize)T(otherArray[mSize]);
 		}
 	}
 
 	//-----------------------------------------------------------------
 
-	void Datum::performDeepCopyHelperRTTI(const Datum& other)
+	template <typename T>
+	void Datum::copyAssignHelper(const Datum& other)
 	{
-		reserveHelper<RTTI*>(other.mCapacity);
-		for(uint32_t i = 0; i < other.mSize; ++i)
+		const T* otherArray = reinterpret_cast<const T*>(other.mData.v);
+		T* dataArray = reinterpret_cast<T*>(mData.v);
+
+		// drop the values other doesn't have, then assign over the rest so their storage (string buffers included) is reused
+		while(mSize > other.mSize)
+		{
+			dataArray[--mSize].~T();
+		}
+
+		for(uint32_t i = 0; i < mSize; ++i)
 		{
-			pushBackHelper<RTTI*>(other.getHelper<RTTI*>(i, other.mType), mType);
+			dataArray[i] = otherArray[i];
+		}
+
+		// the array only moves if other has more values than fit
+		reserveHelper<T>(other.mSize);
+		dataArray = reinterpret_cast<T*>(mData.v);
+		for(; mSize < other.mSize; ++mSize)
+		{
+			new(dataArray + mSize)T(otherArray[mSize]);
 		}
 	}
 
@@ -1054,7 +1659,7 @@ namespace DOGEngine
 		for(uint32_t i = 0; i < mSize; ++i)
 		{
 			// return false if any elements don't match
-			if(getHelper<T>(i, mType) != other.getHelper<T>(i, other.mType))
+			if(!elementsEqual(*elementAt<T>(i), *other.elementAt<T>(i)))
 			{
 				result = false;
 				break;
@@ -1064,44 +1669,6 @@ namespace DOGEngine
 		return result;
 	}
 
-	//-----------------------------------------------------------------
-
-	bool Datum::comparisonHelperRTTI(const Datum& other) const
-	{
-		if(mType != other.mType || mSize != other.mSize)
-		{
-			return false;
-		}
-
-		// step through all stored pointers
-		bool result = true;
-		RTTI* currentPointer;
-		RTTI* otherCurrentPointer;
-		for(uint32_t i = 0; i < mSize; ++i)
-		{
-			currentPointer = getHelper<RTTI*>(i, mType);
-			otherCurrentPointer = other.getHelper<RTTI*>(i, other.mType);
-
-			// if current pointer is null, result is whether or not the other pointer is null
-			if(currentPointer == nullptr)
-			{
-				result = otherCurrentPointer == nullptr;
-			}
-
-			// otherwise, we need to run Equals on other
-			else
-			{
-				result = currentPointer->Equals(otherCurrentPointer);
-				if(!result)
-				{
-					break;
-				}
-			}
-		}
-
-		return result;
-	}
-
 #pragma endregion
 
 	//-----------------------------------------------------------------
@@ -1119,13 +1686,29 @@ namespace DOGEngine
 		// only reallocate if we're requesting more data than we have
 		if(reserveSize > mCapacity)
 		{
-			T* newArray = reinterpret_cast<T*>(malloc(reserveSize * sizeof(T)));
-			memcpy(newArray, mData.v, mCapacity * sizeof(T));
-
-			free(mData.v);
-			mData.v = newArray;
+			if(isShared())
+			{
+				// growing a shared array is a write, so we take a bigger copy of our own
+				cloneStorage<T>(reserveSize);
+			}
+			else
+			{
+				// growing within the inline buffer needs no reallocation at all
+				T* newArray = fitsInline<T>(reserveSize) ? reinterpret_cast<T*>(&mInline) : static_cast<T*>(allocateArray(reserveSize * sizeof(T)));
+				if(newArray != mData.v)
+				{
+					if(mSize > 0)
+					{
+						memcpy(newArray, mData.v, mSize * sizeof(T));
+					}
+
+					freeStorage();
+					mData.v = newArray;
+					mIsAliased = false;
+				}
 
-			mCapacity = reserveSize;
+				mCapacity = reserveSize;
+			}
 		}
 	}
 
@@ -1142,13 +1725,28 @@ namespace DOGEngine
 		// only need to shrink capacity if size is smaller than capacity
 		if(mSize < mCapacity)
 		{
-			T* newArray = reinterpret_cast<T*>(malloc(mSize * sizeof(T)));
-			memcpy(newArray, mData.v, mSize * sizeof(T));
-
-			free(mData.v);
+			if(isShared())
+			{
+				cloneStorage<T>(mSize);
+			}
+			else
+			{
+				// a heap array that now fits inline moves back into the Datum
+				T* newArray = fitsInline<T>(mSize) ? reinterpret_cast<T*>(&mInline) : static_cast<T*>(allocateArray(mSize * sizeof(T)));
+				if(newArray != mData.v)
+				{
+					if(mSize > 0)
+					{
+						memcpy(newArray, mData.v, mSize * sizeof(T));
+					}
+
+					freeStorage();
+					mData.v = newArray;
+					mIsAliased = false;
+				}
 
-			mData.v = newArray;
-			mCapacity = mSize;
+				mCapacity = mSize;
+			}
 		}
 	}
 
@@ -1159,24 +1757,31 @@ namespace DOGEngine
 #pragma region SetStorage
 
 	template <typename T>
-	void Datum::setStorageHelper(T* const& data, const uint32_t size, const DatumType type)
+	void Datum::setStorageHelper(T* const& data, const uint32_t size, const uint32_t stride, const DatumType type)
 	{
 		// if we own allocated space, we need to clear it and throw an exception
 		if(!mIsExternal && mCapacity > 0)
 		{
-			clear();
-			free(mData.v);
-			mData.v = nullptr;
+			releaseStorage();
 
 			throw exception("Error -- cannot make a Datum with an owned allocation external!");
 		}
 
+		// elements may be spaced apart, but never overlap
+		if(stride != 0 && stride < sizeof(T))
+		{
+			throw exception("Error -- external storage stride is smaller than an element!");
+		}
+
 		// set type, array, and size data
 		setType(type);
 		mData.v = data;
 		mSize = size;
 		mCapacity = size;
 
+		// a stride of exactly one element is just a packed array
+		mStride = (stride == sizeof(T)) ? 0 : stride;
+
 		// we no longer own our data
 		mIsExternal = true;
 	}
@@ -1200,11 +1805,15 @@ namespace DOGEngine
 		//		or our current type is known and mismatches the expected type (setType throws an overwrite exception)
 		setType(expectedType);
 
-		// allocate more space if needed
+		// allocate more space if needed (a shared array is copied as it grows)
 		if(mSize == mCapacity)
 		{
 			reserveHelper<T>(std::max<uint32_t>(1, mCapacity * 2));
 		}
+		else
+		{
+			makeUnique<T>();
+		}
 
 		// have to treat our void* array as the appropriate type
 		T* dataArray = reinterpret_cast<T*>(mData.v);
@@ -1223,6 +1832,8 @@ namespace DOGEngine
 
 		if(!isEmpty())
 		{
+			makeUnique<T>();
+
 			T* dataArray = reinterpret_cast<T*>(mData.v);
 			dataArray[--mSize].~T();
 		}
@@ -1276,6 +1887,7 @@ namespace DOGEngine
 			throw exception("Error -- index is out of bounds for the Datum array!");
 		}
 
+		makeUnique<T>();
 		T* dataArray = reinterpret_cast<T*>(mData.v);
 
 		// destruct the remove element
@@ -1299,10 +1911,19 @@ namespace DOGEngine
 			throw exception("Error -- cannot clear a Datum that stores external data!");
 		}
 
-		while(!isEmpty())
+		if(isShared())
 		{
-			// call the templated popback helper directly (don't need to switch check for type continuously)
-			popBackHelper<T>();
+			// the values stay with the other Datums sharing them
+			releaseStorage();
+		}
+		else
+		{
+			// destruct back to front, same as popping each element
+			T* dataArray = reinterpret_cast<T*>(mData.v);
+			while(mSize > 0)
+			{
+				dataArray[--mSize].~T();
+			}
 		}
 	}
 
@@ -1325,8 +1946,8 @@ namespace DOGEngine
 			throw exception("Error -- cannot set values outside the bounds of the Datum's data!");
 		}
 
-		T* dataArray = reinterpret_cast<T*>(mData.v);
-		dataArray[index] = data;
+		makeUnique<T>();
+		*elementAt<T>(index) = data;
 	}
 
 	//-----------------------------------------------------------------
@@ -1344,8 +1965,68 @@ namespace DOGEngine
 			throw exception("Error -- cannot return values outside the bounds of the Datum's data!");
 		}
 
-		T* dataArray = reinterpret_cast<T*>(mData.v);
-		return dataArray[index];
+		return *elementAt<T>(index);
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename T>
+	T& Datum::mutableGetHelper(const uint32_t index, const DatumType expectedType)
+	{
+		// checked before anything is copied
+		getHelper<T>(index, expectedType);
+
+		// the caller may write through the reference at any time, even after we are copied
+		makeUnique<T>();
+		mIsAliased = true;
+
+		return *elementAt<T>(index);
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename T>
+	T* Datum::elementAt(const uint32_t index) const
+	{
+		// only external views are ever strided, owned arrays are always packed
+		if(mStride == 0)
+		{
+			return reinterpret_cast<T*>(mData.v) + index;
+		}
+
+		return reinterpret_cast<T*>(reinterpret_cast<char*>(mData.v) + static_cast<size_t>(index) * mStride);
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename T>
+	T* Datum::dataHelper(const DatumType expectedType) const
+	{
+		if(expectedType != mType)
+		{
+			throw exception("Error -- mismatch between the Datum's type and the return type of the invoked data() template!");
+		}
+
+		if(mStride != 0)
+		{
+			throw exception("Error -- cannot get a contiguous array from a strided Datum!");
+		}
+
+		return reinterpret_cast<T*>(mData.v);
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename T>
+	T* Datum::mutableDataHelper(const DatumType expectedType)
+	{
+		dataHelper<T>(expectedType);
+
+		// as with get(), the pointer may be written through at any time
+		makeUnique<T>();
+		mIsAliased = true;
+
+		return reinterpret_cast<T*>(mData.v);
 	}
 
 #pragma endregion
@@ -1355,123 +2036,162 @@ namespace DOGEngine
 #pragma region From String
 
 	template <>
-	int32_t Datum::dataFromString<int32_t>(const string& str)
+	int32_t Datum::dataFromString<int32_t>(const char*& cursor)
 	{
-		int data;
-		sscanf_s(str.c_str(), "%d", &data);
+		int32_t data;
+		if(!parseInt(cursor, data))
+		{
+			throw exception("Error -- could not parse an Integer from the string!");
+		}
 		return data;
 	}
 
 	//-----------------------------------------------------------------
 
 	template <>
-	float Datum::dataFromString<float>(const string& str)
+	float Datum::dataFromString<float>(const char*& cursor)
 	{
 		float data;
-		sscanf_s(str.c_str(), "%f", &data);
+		if(!parseFloat(cursor, data))
+		{
+			throw exception("Error -- could not parse a Float from the string!");
+		}
 		return data;
 	}
 
 	//-----------------------------------------------------------------
 
 	template <>
-	string Datum::dataFromString<string>(const string& str)
+	string Datum::dataFromString<string>(const char*& cursor)
 	{
-		return str;
+		// a single string is the whole rest of the input
+		string data(cursor);
+		cursor += data.size();
+		return data;
 	}
 
 	//-----------------------------------------------------------------
 
 	template <>
-	vec4 Datum::dataFromString<vec4>(const string& str)
+	vec4 Datum::dataFromString<vec4>(const char*& cursor)
 	{
 		vec4 data;
-		sscanf_s(str.c_str(), "vec4(%f, %f, %f, %f)", &data.x, &data.y, &data.z, &data.w);
+		if(!parseVector(cursor, data))
+		{
+			throw exception("Error -- could not parse a Vector from the string!");
+		}
 		return data;
 	}
 
 	//-----------------------------------------------------------------
 
 	template <>
-	mat4x4 Datum::dataFromString<mat4x4>(const string& str)
+	mat4x4 Datum::dataFromString<mat4x4>(const char*& cursor)
 	{
 		mat4x4 data;
-		sscanf_s(str.c_str(), "mat4x4((%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f))",
-			&data[0].x, &data[0].y, &data[0].z, &data[0].w,
-			&data[1].x, &data[1].y, &data[1].z, &data[1].w,
-			&data[2].x, &data[2].y, &data[2].z, &data[2].w,
-			&data[3].x, &data[3].y, &data[3].z, &data[3].w);
+		if(!parseMatrix(cursor, data))
+		{
+			throw exception("Error -- could not parse a Matrix from the string!");
+		}
 		return data;
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	void Datum::pushBackFromStringHelper(const string& str)
+	template <>
+	RTTI* Datum::dataFromString<RTTI*>(const char*&)
 	{
-		pushBackHelper<T>(dataFromString<T>(str), mType);
+		// pointer types are rejected before dispatch, these only exist so every case compiles
+		throw exception("Error -- cannot set data from string on a Datum with type Pointer!");
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	void Datum::setFromStringHelper(const string& str, const uint32_t index)
+	template <>
+	Scope* Datum::dataFromString<Scope*>(const char*&)
 	{
-		setHelper<T>(dataFromString<T>(str), index, mType);
+		throw exception("Error -- cannot set data from string on a Datum with type Table!");
 	}
 
-#pragma endregion
-
 	//-----------------------------------------------------------------
 
-#pragma region ToString
-
-	string Datum::toStringInt(const uint32_t index) const
+	template <typename T>
+	void Datum::pushBackFromStringHelper(const string& str)
 	{
-		return std::to_string(getHelper<int32_t>(index, mType));
+		const char* cursor = str.c_str();
+		pushBackHelper<T>(dataFromString<T>(cursor), mType);
 	}
-	
+
 	//-----------------------------------------------------------------
 
-	string Datum::toStringFloat(const uint32_t index) const
+	template <typename T>
+	uint32_t Datum::pushBackArrayFromStringHelper(const string& str)
 	{
-		return std::to_string(getHelper<float>(index, mType));
-	}
+		const char* cursor = str.c_str();
+		skipSpace(cursor);
 
-	//-----------------------------------------------------------------
+		uint32_t count = 0;
+		while(*cursor != '\0')
+		{
+			if(count > 0 && !matchLiteral(cursor, ","))
+			{
+				throw exception("Error -- expected a comma between the values in the string!");
+			}
 
-	string Datum::toStringString(const uint32_t index) const
-	{
-		return getHelper<string>(index, mType);
+			pushBackHelper<T>(dataFromString<T>(cursor), mType);
+			++count;
+			skipSpace(cursor);
+		}
+
+		return count;
 	}
-	
+
 	//-----------------------------------------------------------------
 
-	string Datum::toStringVector(const uint32_t index) const
+	template <>
+	uint32_t Datum::pushBackArrayFromStringHelper<string>(const string& str)
 	{
-		return glm::to_string(getHelper<vec4>(index, mType));
+		// strings have no closing delimiter, so every comma separates two of them
+		const char* cursor = str.c_str();
+		skipSpace(cursor);
+		if(*cursor == '\0')
+		{
+			return 0;
+		}
+
+		uint32_t count = 1;
+		for(const char* end = strchr(cursor, ','); end != nullptr; end = strchr(cursor, ','))
+		{
+			pushBackHelper<string>(string(cursor, end), mType);
+			++count;
+
+			cursor = end + 1;
+			skipSpace(cursor);
+		}
+		pushBackHelper<string>(string(cursor), mType);
+
+		return count;
 	}
-	
+
 	//-----------------------------------------------------------------
 
-	string Datum::toStringMatrix(const uint32_t index) const
+	template <typename T>
+	void Datum::setFromStringHelper(const string& str, const uint32_t index)
 	{
-		return glm::to_string(getHelper<mat4x4>(index, mType));
+		const char* cursor = str.c_str();
+		setHelper<T>(dataFromString<T>(cursor), index, mType);
 	}
-	
-	//-----------------------------------------------------------------
 
-	string Datum::toStringRTTI(const uint32_t index) const
-	{
-		string dataAsString = "";
+#pragma endregion
 
-		RTTI* data = getHelper<RTTI*>(index, mType);
-		if(data != nullptr)
-		{
-			dataAsString = data->ToString();
-		}
+	//-----------------------------------------------------------------
+
+#pragma region ToString
 
-		return dataAsString;
+	template <typename T>
+	string Datum::toStringHelper(const uint32_t index) const
+	{
+		return elementToString(getHelper<T>(index, mType));
 	}
 
 #pragma endregion
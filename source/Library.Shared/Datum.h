@@ -11,6 +11,19 @@ namespace DOGEngine
 	 * A class that stores an array of values.
 	 * The values are of a single type, chosen
 	 * at runtime.
+	 *
+	 * Small arrays (up to one mat4x4's worth of
+	 * bytes) are stored inside the Datum itself,
+	 * and only spill to the heap once they grow
+	 * past that.
+	 *
+	 * Heap arrays are reference counted. Copying
+	 * a Datum shares its array with the copy, and
+	 * whichever of them is written to first gets
+	 * an array of its own (copy-on-write). Reads
+	 * through a const Datum never copy. Tables
+	 * are never shared, since each Scope has only
+	 * one parent.
 	 */
 	class Datum final
 	{
@@ -42,8 +55,10 @@ namespace DOGEngine
 		explicit Datum(DatumType type = DatumType::Unknown);
 
 		/**
-		 * @brief Copy constructor. Deep copies if
-		 *		  'other' owns its memory.
+		 * @brief Copy constructor. Shares 'other's
+		 *		  heap array until either Datum writes
+		 *		  to it, and deep copies values 'other'
+		 *		  stores inline.
 		 *
 		 * @param other The Datum from which we are
 		 *				copying.
@@ -53,7 +68,9 @@ namespace DOGEngine
 		/**
 		 * @brief Move constructor. Moves the data from
 		 *		  one Datum to a new Datum. The original
-		 *		  becomes empty.
+		 *		  becomes empty. Values stored inline move
+		 *		  to the new Datum's own buffer, so
+		 *		  references to them do not survive.
 		 *
 		 * @param other The Datum being moved.
 		 */
@@ -79,11 +96,19 @@ namespace DOGEngine
 		/**
 		 * @brief Assignment operator. Assigns this
 		 *		  Datum the values from 'other'.
-		 *		  Deep copies if 'other' owns its
-		 *		  memory.
+		 *		  Shares 'other's heap array, as the
+		 *		  copy constructor does.
 		 *
 		 * @param other The Datum from which we are
 		 *				copying.
+		 *
+		 * @note If 'other' stores its values inline
+		 *		 and this Datum already owns values of
+		 *		 the same type, they are assigned over
+		 *		 in place and the array is only grown
+		 *		 if it is too small, so repeatedly
+		 *		 copying into the same Datum does not
+		 *		 reallocate.
 		 */
 		Datum& operator=(const Datum& other);
 
@@ -514,19 +539,26 @@ namespace DOGEngine
 		 *
 		 * @param data The external memory we will reference.
 		 * @param size The size of the external memory block.
+		 * @param stride The number of bytes from one element
+		 *				 to the next. Defaulted to 0, meaning
+		 *				 the elements are tightly packed.
 		 *
 		 * @note Size and capacity will be set to 'size'.
 		 * @note Size may not be the full size of the external
 		 *		 block of memory. It just refers to the size of
 		 *		 the block to which we have access.
+		 * @note A stride larger than the element lets the
+		 *		 Datum view one field of an array of structs.
 		 *
 		 * @exception Throws exception if the Datum previously
 		 *			  owned its own allocated memory.
 		 * @exception Throws exception if the Datum's type
 		 *			  does not match the type of the external
 		 *			  memory.
+		 * @exception Throws exception if the stride is
+		 *			  nonzero and smaller than an element.
 		 */
-		void setStorage(std::int32_t* const& data, const std::uint32_t size);
+		void setStorage(std::int32_t* const& data, const std::uint32_t size, const std::uint32_t stride = 0);
 
 		/**
 		 * @brief Makes the Datum point to memory owned by
@@ -534,19 +566,26 @@ namespace DOGEngine
 		 *
 		 * @param data The external memory we will reference.
 		 * @param size The size of the external memory block.
+		 * @param stride The number of bytes from one element
+		 *				 to the next. Defaulted to 0, meaning
+		 *				 the elements are tightly packed.
 		 *
 		 * @note Size and capacity will be set to 'size'.
 		 * @note Size may not be the full size of the external
 		 *		 block of memory. It just refers to the size of
 		 *		 the block to which we have access.
+		 * @note A stride larger than the element lets the
+		 *		 Datum view one field of an array of structs.
 		 *
 		 * @exception Throws exception if the Datum previously
 		 *			  owned its own allocated memory.
 		 * @exception Throws exception if the Datum's type
 		 *			  does not match the type of the external
 		 *			  memory.
+		 * @exception Throws exception if the stride is
+		 *			  nonzero and smaller than an element.
 		 */
-		void setStorage(float* const& data, const std::uint32_t size);
+		void setStorage(float* const& data, const std::uint32_t size, const std::uint32_t stride = 0);
 
 		/**
 		 * @brief Makes the Datum point to memory owned by
@@ -554,19 +593,26 @@ namespace DOGEngine
 		 *
 		 * @param data The external memory we will reference.
 		 * @param size The size of the external memory block.
+		 * @param stride The number of bytes from one element
+		 *				 to the next. Defaulted to 0, meaning
+		 *				 the elements are tightly packed.
 		 *
 		 * @note Size and capacity will be set to 'size'.
 		 * @note Size may not be the full size of the external
 		 *		 block of memory. It just refers to the size of
 		 *		 the block to which we have access.
+		 * @note A stride larger than the element lets the
+		 *		 Datum view one field of an array of structs.
 		 *
 		 * @exception Throws exception if the Datum previously
 		 *			  owned its own allocated memory.
 		 * @exception Throws exception if the Datum's type
 		 *			  does not match the type of the external
 		 *			  memory.
+		 * @exception Throws exception if the stride is
+		 *			  nonzero and smaller than an element.
 		 */
-		void setStorage(std::string* const& data, const std::uint32_t size);
+		void setStorage(std::string* const& data, const std::uint32_t size, const std::uint32_t stride = 0);
 
 		/**
 		 * @brief Makes the Datum point to memory owned by
@@ -574,19 +620,26 @@ namespace DOGEngine
 		 *
 		 * @param data The external memory we will reference.
 		 * @param size The size of the external memory block.
+		 * @param stride The number of bytes from one element
+		 *				 to the next. Defaulted to 0, meaning
+		 *				 the elements are tightly packed.
 		 *
 		 * @note Size and capacity will be set to 'size'.
 		 * @note Size may not be the full size of the external
 		 *		 block of memory. It just refers to the size of
 		 *		 the block to which we have access.
+		 * @note A stride larger than the element lets the
+		 *		 Datum view one field of an array of structs.
 		 *
 		 * @exception Throws exception if the Datum previously
 		 *			  owned its own allocated memory.
 		 * @exception Throws exception if the Datum's type
 		 *			  does not match the type of the external
 		 *			  memory.
+		 * @exception Throws exception if the stride is
+		 *			  nonzero and smaller than an element.
 		 */
-		void setStorage(RTTI** const& data, const std::uint32_t size);
+		void setStorage(RTTI** const& data, const std::uint32_t size, const std::uint32_t stride = 0);
 
 		/**
 		 * @brief Makes the Datum point to memory owned by
@@ -594,19 +647,26 @@ namespace DOGEngine
 		 *
 		 * @param data The external memory we will reference.
 		 * @param size The size of the external memory block.
+		 * @param stride The number of bytes from one element
+		 *				 to the next. Defaulted to 0, meaning
+		 *				 the elements are tightly packed.
 		 *
 		 * @note Size and capacity will be set to 'size'.
 		 * @note Size may not be the full size of the external
 		 *		 block of memory. It just refers to the size of
 		 *		 the block to which we have access.
+		 * @note A stride larger than the element lets the
+		 *		 Datum view one field of an array of structs.
 		 *
 		 * @exception Throws exception if the Datum previously
 		 *			  owned its own allocated memory.
 		 * @exception Throws exception if the Datum's type
 		 *			  does not match the type of the external
 		 *			  memory.
+		 * @exception Throws exception if the stride is
+		 *			  nonzero and smaller than an element.
 		 */
-		void setStorage(glm::vec4* const& data, const std::uint32_t size);
+		void setStorage(glm::vec4* const& data, const std::uint32_t size, const std::uint32_t stride = 0);
 
 		/**
 		 * @brief Makes the Datum point to memory owned by
@@ -614,19 +674,41 @@ namespace DOGEngine
 		 *
 		 * @param data The external memory we will reference.
 		 * @param size The size of the external memory block.
+		 * @param stride The number of bytes from one element
+		 *				 to the next. Defaulted to 0, meaning
+		 *				 the elements are tightly packed.
 		 *
 		 * @note Size and capacity will be set to 'size'.
 		 * @note Size may not be the full size of the external
 		 *		 block of memory. It just refers to the size of
 		 *		 the block to which we have access.
+		 * @note A stride larger than the element lets the
+		 *		 Datum view one field of an array of structs.
 		 *
 		 * @exception Throws exception if the Datum previously
 		 *			  owned its own allocated memory.
 		 * @exception Throws exception if the Datum's type
 		 *			  does not match the type of the external
 		 *			  memory.
+		 * @exception Throws exception if the stride is
+		 *			  nonzero and smaller than an element.
+		 */
+		void setStorage(glm::mat4x4* const& data, const std::uint32_t size, const std::uint32_t stride = 0);
+
+		/**
+		 * @brief Points an external Datum at a new block of
+		 *		  memory laid out like the old one. Type, size
+		 *		  and stride are kept, so this is a single
+		 *		  pointer store.
+		 *
+		 * @param data The external memory we will reference.
+		 *			   It must hold elements of the Datum's
+		 *			   type at the Datum's stride.
+		 *
+		 * @exception Throws exception if the Datum does not
+		 *			  store external data.
 		 */
-		void setStorage(glm::mat4x4* const& data, const std::uint32_t size);
+		void rebindStorage(void* const data);
 
 		/**
 		 * @brief Adds a new int to the end of the Datum array.
@@ -839,7 +921,9 @@ namespace DOGEngine
 		/**
 		 * @brief Removes all elements from the Datum array.
 		 *
-		 * @note Capacity is unchanged.
+		 * @note Capacity is unchanged, unless the array was
+		 *		 shared with a copy. Then this Datum just
+		 *		 lets go of it, and has no capacity left.
 		 *
 		 * @exception Throws exception if called against a
 		 *			  Datum referencing external memory.
@@ -964,6 +1048,12 @@ namespace DOGEngine
 		 *			  does not match the return type.
 		 * @exception Throws exception if 'index' is out of
 		 *			  bounds for the Datum's array.
+		 *
+		 * @note The reference may be written through, so
+		 *		 an array shared with a copy is copied
+		 *		 first, and the array is not shared again
+		 *		 until it is replaced. Read through a const
+		 *		 Datum to avoid both.
 		 */
 		template<typename T> T& get(const std::uint32_t index = 0);
 
@@ -983,6 +1073,50 @@ namespace DOGEngine
 		 */
 		template<typename T> const T& get(const std::uint32_t index = 0) const;
 
+		/**
+		 * @brief Getter for the Datum's whole array, for
+		 *		  bulk work that would otherwise go through
+		 *		  get() and set() one element at a time.
+		 *		  The type is checked once here; elements
+		 *		  [0, size()) are then accessed directly.
+		 *		  Only the value types (int32_t, float,
+		 *		  string, vec4, mat4x4) are supported.
+		 *
+		 * @return Returns a pointer to the first element.
+		 *		   Invalidated by anything that changes the
+		 *		   Datum's capacity, or by moving the Datum.
+		 *
+		 * @exception Throws exception if the Datum's type
+		 *			  does not match the requested type.
+		 * @exception Throws exception if the Datum is a
+		 *			  strided view, whose elements are not
+		 *			  contiguous.
+		 *
+		 * @note As with get(), an array shared with a
+		 *		 copy is copied first.
+		 */
+		template<typename T> T* data();
+
+		/**
+		 * @brief Getter for the Datum's whole array, for
+		 *		  bulk work that would otherwise go through
+		 *		  get() one element at a time. The type is
+		 *		  checked once here; elements [0, size())
+		 *		  are then accessed directly. Only the value
+		 *		  types (int32_t, float, string, vec4,
+		 *		  mat4x4) are supported.
+		 *
+		 * @return Returns a const pointer to the first
+		 *		   element.
+		 *
+		 * @exception Throws exception if the Datum's type
+		 *			  does not match the requested type.
+		 * @exception Throws exception if the Datum is a
+		 *			  strided view, whose elements are not
+		 *			  contiguous.
+		 */
+		template<typename T> const T* data() const;
+
 		/**
 		 * @brief Retreives the Datum with the given name at the
 		 *		  0th Scope.
@@ -1039,9 +1173,32 @@ namespace DOGEngine
 		 *
 		 * @exception The Datum type is Pointer, Table,
 		 *			  or Unknown.
+		 * @exception The string does not start with a
+		 *			  value of the Datum's type.
 		 */
 		void pushBackFromString(const std::string& str);
 
+		/**
+		 * @brief Pushes back every value in a comma
+		 *		  separated list, such as "1, 2, 3" or
+		 *		  "vec4(0, 1, 2, 3), vec4(4, 5, 6, 7)".
+		 *		  String lists are split at every comma.
+		 *		  Requires that the Datum's type has been
+		 *		  set previously.
+		 *
+		 * @param str The list to parse. An empty or
+		 *			  all-whitespace string pushes nothing.
+		 *
+		 * @return Returns the number of values pushed.
+		 *
+		 * @exception The Datum type is Pointer, Table,
+		 *			  or Unknown.
+		 * @exception The list contains something that is
+		 *			  not a value of the Datum's type.
+		 *			  Values before it stay pushed.
+		 */
+		std::uint32_t pushBackArrayFromString(const std::string& str);
+
 		/**
 		 * @brief Converts the given string to a value of
 		 *		  the Datum's type and inserts it at the
@@ -1057,6 +1214,9 @@ namespace DOGEngine
 		 *			  does not match the incoming data's.
 		 * @exception Throws exception if 'index' is out of
 		 *			  bounds for the Datum's array.
+		 * @exception Throws exception if the string does
+		 *			  not start with a value of the
+		 *			  Datum's type.
 		 */
 		void setFromString(const std::string& str, const std::uint32_t index = 0);
 
@@ -1122,6 +1282,16 @@ namespace DOGEngine
 		 */
 		bool isExternal() const;
 
+		/**
+		 * @brief Gets the distance between elements of an
+		 *		  external view.
+		 *
+		 * @return Returns the number of bytes from one
+		 *		   element to the next, or 0 if the elements
+		 *		   are tightly packed.
+		 */
+		std::uint32_t stride() const;
+
 		/**
 		 * @brief Says whether the Datum is empty.
 		 *
@@ -1157,18 +1327,50 @@ namespace DOGEngine
 			Scope** scope;
 		};
 
+		/**
+		 * Empty type carrying one of the stored types, so a
+		 * generic lambda handed to visit can recover the
+		 * type it was instantiated for.
+		 */
+		template <typename T> struct TypeTag { typedef T Type; };
+
+		/**
+		 * Stored in front of every heap array. Counts the
+		 * Datums sharing the array; the last one to let go
+		 * destroys the values and frees it.
+		 */
+		struct alignas(16) SharedHeader
+		{
+			std::atomic<std::uint32_t> mRefCount;
+		};
+
+		template <typename TVisitor> auto visit(TVisitor visitor) const -> decltype(visitor(TypeTag<std::int32_t>()));
+
+		template <typename T> static bool fitsInline(const std::uint32_t capacity);
+		bool isInline() const;
+		void freeStorage();
+		void moveStorage(Datum& other);
+
+		static void* allocateArray(const std::size_t size);
+		SharedHeader* header() const;
+		bool isShared() const;
+		bool canShare() const;
+		void shareStorage(const Datum& other);
+		void releaseStorage();
+		template <typename T> void makeUnique();
+		template <typename T> void cloneStorage(const std::uint32_t capacity);
+
 		void performDeepCopy(const Datum& other);
 		template <typename T> void performDeepCopyHelper(const Datum& other);
-		void performDeepCopyHelperRTTI(const Datum& other);
+		template <typename T> void copyAssignHelper(const Datum& other);
 
 		template <typename T> void assignmentHelper(const T& rhs, const DatumType expectedType);
 		template <typename T> bool comparisonHelper(const Datum& other) const;
-		bool comparisonHelperRTTI(const Datum& other) const;
 
 		template <typename T> void reserveHelper(const std::uint32_t reserveSize);
 		template <typename T> void shrinkToFitHelper();
 
-		template <typename T> void setStorageHelper(T* const& data, const std::uint32_t size, const DatumType type);
+		template <typename T> void setStorageHelper(T* const& data, const std::uint32_t size, const std::uint32_t stride, const DatumType type);
 
 		template <typename T> void pushBackHelper(const T& data, const DatumType expectedType);
 		template <typename T> bool removeHelper(const T& data, const DatumType expectedType);
@@ -1178,47 +1380,33 @@ namespace DOGEngine
 
 		template <typename T> void setHelper(const T& data, const std::uint32_t index, const DatumType expectedType);
 		template <typename T> T& getHelper(const std::uint32_t index, const DatumType expectedType) const;
+		template <typename T> T& mutableGetHelper(const std::uint32_t index, const DatumType expectedType);
+		template <typename T> T* elementAt(const std::uint32_t index) const;
+		template <typename T> T* dataHelper(const DatumType expectedType) const;
+		template <typename T> T* mutableDataHelper(const DatumType expectedType);
 
-		template <typename T> T dataFromString(const std::string& str);
+		template <typename T> static T dataFromString(const char*& cursor);
 		template <typename T> void pushBackFromStringHelper(const std::string& str);
+		template <typename T> std::uint32_t pushBackArrayFromStringHelper(const std::string& str);
 		template <typename T> void setFromStringHelper(const std::string& str, const std::uint32_t index = 0);
 
-		std::string toStringInt(const std::uint32_t index = 0) const;
-		std::string toStringFloat(const std::uint32_t index = 0) const;
-		std::string toStringString(const std::uint32_t index = 0) const;
-		std::string toStringVector(const std::uint32_t index = 0) const;
-		std::string toStringMatrix(const std::uint32_t index = 0) const;
-		std::string toStringRTTI(const std::uint32_t index = 0) const;
+		template <typename T> std::string toStringHelper(const std::uint32_t index = 0) const;
 
 		DataPointers mData;
 		DatumType mType;
 
+		// storage for arrays small enough to skip the heap -- mData points here when in use
+		std::aligned_storage<sizeof(glm::mat4x4)>::type mInline;
+
 		std::uint32_t mSize;
 		std::uint32_t mCapacity;
 
+		// bytes between elements of an external view, 0 when they are packed
+		std::uint32_t mStride;
+
 		bool mIsExternal;
 
-		// static members storing function pointers
-		typedef std::function<bool(const Datum&, const Datum&)> ComparisonFuncs;
-		typedef std::function<void(Datum&, const std::uint32_t)> ReserveFuncs;
-		typedef std::function<void(Datum&)> ShrinkToFitFuncs;
-		typedef std::function<void(Datum&, std::uint32_t)> RemoveAtFuncs;
-		typedef std::function<void(Datum&)> PopBackFuncs;
-		typedef std::function<void(Datum&)> ClearFuncs;
-		typedef std::function<void(Datum&, const std::string&)> PushFromStringFuncs;
-		typedef std::function<void(Datum&, const std::string&, const std::uint32_t)> SetFromStringFuncs;
-		typedef std::function<std::string(const Datum&, const std::uint32_t)> ToStringFuncs;
-		typedef std::function<void(Datum&, const Datum&)> CopyFuncs;
-
-		static ComparisonFuncs		sComparisonFuncs	[(std::uint32_t)DatumType::Unknown];
-		static ReserveFuncs			sReserveFuncs		[(std::uint32_t)DatumType::Unknown];
-		static ShrinkToFitFuncs		sShrinkToFitFuncs	[(std::uint32_t)DatumType::Unknown];
-		static RemoveAtFuncs		sRemoveAtFuncs		[(std::uint32_t)DatumType::Unknown];
-		static PopBackFuncs			sPopBackFuncs		[(std::uint32_t)DatumType::Unknown];
-		static ClearFuncs			sClearFuncs			[(std::uint32_t)DatumType::Unknown];
-		static PushFromStringFuncs	sPushFromStringFuncs[(std::uint32_t)DatumType::Unknown];
-		static SetFromStringFuncs	sSetFromStringFuncs	[(std::uint32_t)DatumType::Unknown];
-		static ToStringFuncs		sToStringFuncs		[(std::uint32_t)DatumType::Unknown];
-		static CopyFuncs			sCopyFuncs			[(std::uint32_t)DatumType::Unknown];
+		// a mutable reference into the array was handed out, so copies can't share it
+		bool mIsAliased;
 	};
 }
@@ -0,0 +1,330 @@
+#include "pch.h"
+#include "DatumMath.h"
+
+#include <xmmintrin.h>
+
+using namespace DOGEngine;
+using namespace std;
+using namespace glm;
+
+#pragma region Kernels
+
+namespace
+{
+	// glm's vec4 and mat4x4 are tightly packed floats with no alignment guarantee, hence the unaligned loads
+	//		and matrices are column major, so a matrix is four consecutive column vectors
+
+	inline __m128 transformVector(const __m128 columns[4], const __m128 vector)
+	{
+		__m128 result = _mm_mul_ps(columns[0], _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(0, 0, 0, 0)));
+		result = _mm_add_ps(result, _mm_mul_ps(columns[1], _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(1, 1, 1, 1))));
+		result = _mm_add_ps(result, _mm_mul_ps(columns[2], _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(2, 2, 2, 2))));
+		return _mm_add_ps(result, _mm_mul_ps(columns[3], _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(3, 3, 3, 3))));
+	}
+
+	//-----------------------------------------------------------------
+
+	inline void loadColumns(const mat4x4& matrix, __m128 columns[4])
+	{
+		const float* data = &matrix[0].x;
+		columns[0] = _mm_loadu_ps(data);
+		columns[1] = _mm_loadu_ps(data + 4);
+		columns[2] = _mm_loadu_ps(data + 8);
+		columns[3] = _mm_loadu_ps(data + 12);
+	}
+
+	//-----------------------------------------------------------------
+
+	void addKernel(float* target, const float* source, const uint32_t numFloats)
+	{
+		uint32_t i = 0;
+		for(; i + 4 <= numFloats; i += 4)
+		{
+			_mm_storeu_ps(target + i, _mm_add_ps(_mm_loadu_ps(target + i), _mm_loadu_ps(source + i)));
+		}
+		for(; i < numFloats; ++i)
+		{
+			target[i] += source[i];
+		}
+	}
+
+	//-----------------------------------------------------------------
+
+	void scaleKernel(float* target, const float scalar, const uint32_t numFloats)
+	{
+		__m128 factor = _mm_set1_ps(scalar);
+
+		uint32_t i = 0;
+		for(; i + 4 <= numFloats; i += 4)
+		{
+			_mm_storeu_ps(target + i, _mm_mul_ps(_mm_loadu_ps(target + i), factor));
+		}
+		for(; i < numFloats; ++i)
+		{
+			target[i] *= scalar;
+		}
+	}
+
+	//-----------------------------------------------------------------
+
+	void multiplyAddKernel(float* target, const float* source, const float scalar, const uint32_t numFloats)
+	{
+		__m128 factor = _mm_set1_ps(scalar);
+
+		uint32_t i = 0;
+		for(; i + 4 <= numFloats; i += 4)
+		{
+			__m128 product = _mm_mul_ps(_mm_loadu_ps(source + i), factor);
+			_mm_storeu_ps(target + i, _mm_add_ps(_mm_loadu_ps(target + i), product));
+		}
+		for(; i < numFloats; ++i)
+		{
+			target[i] += source[i] * scalar;
+		}
+	}
+
+	//-----------------------------------------------------------------
+
+	void normalizeKernel(vec4* target, const uint32_t numVectors)
+	{
+		for(uint32_t i = 0; i < numVectors; ++i)
+		{
+			float* data = &target[i].x;
+			__m128 vector = _mm_loadu_ps(data);
+
+			// horizontal dot product, leaving the sum in every lane
+			__m128 squares = _mm_mul_ps(vector, vector);
+			__m128 sums = _mm_add_ps(squares, _mm_shuffle_ps(squares, squares, _MM_SHUFFLE(2, 3, 0, 1)));
+			sums = _mm_add_ps(sums, _mm_shuffle_ps(sums, sums, _MM_SHUFFLE(1, 0, 3, 2)));
+
+			_mm_storeu_ps(data, _mm_div_ps(vector, _mm_sqrt_ps(sums)));
+		}
+	}
+
+	//-----------------------------------------------------------------
+
+	void transformKernel(vec4* target, const mat4x4* matrices, const uint32_t matrixStride, const uint32_t numVectors)
+	{
+		__m128 columns[4];
+		loadColumns(matrices[0], columns);
+
+		for(uint32_t i = 0; i < numVectors; ++i)
+		{
+			if(matrixStride != 0)
+			{
+				loadColumns(matrices[i], columns);
+			}
+
+			float* data = &target[i].x;
+			_mm_storeu_ps(data, transformVector(columns, _mm_loadu_ps(data)));
+		}
+	}
+
+	//-----------------------------------------------------------------
+
+	void multiplyKernel(mat4x4* target, const mat4x4* matrices, const uint32_t matrixStride, const uint32_t numMatrices)
+	{
+		__m128 columns[4];
+		loadColumns(matrices[0], columns);
+
+		for(uint32_t i = 0; i < numMatrices; ++i)
+		{
+			if(matrixStride != 0)
+			{
+				loadColumns(matrices[i], columns);
+			}
+
+			// each column of the product is the left matrix applied to that column of the right one
+			//		all four are loaded before storing, in case target and matrices are the same Datum
+			float* data = &target[i][0].x;
+			__m128 right[4] = { _mm_loadu_ps(data), _mm_loadu_ps(data + 4), _mm_loadu_ps(data + 8), _mm_loadu_ps(data + 12) };
+			for(uint32_t column = 0; column < 4; ++column)
+			{
+				_mm_storeu_ps(data + column * 4, transformVector(columns, right[column]));
+			}
+		}
+	}
+}
+
+#pragma endregion
+
+//=================================================================
+
+#pragma region Operations
+
+void DatumMath::add(Datum& target, const Datum& source, const uint32_t start, const uint32_t count)
+{
+	uint32_t numElements = resolveRange(target, start, count);
+	checkSource(target, source, start + numElements);
+
+	uint32_t stride = floatsPerElement(target);
+	addKernel(floats(target) + start * stride, floats(source) + start * stride, numElements * stride);
+}
+
+//-----------------------------------------------------------------
+
+void DatumMath::scale(Datum& target, const float scalar, const uint32_t start, const uint32_t count)
+{
+	uint32_t numElements = resolveRange(target, start, count);
+
+	uint32_t stride = floatsPerElement(target);
+	scaleKernel(floats(target) + start * stride, scalar, numElements * stride);
+}
+
+//-----------------------------------------------------------------
+
+void DatumMath::multiplyAdd(Datum& target, const Datum& source, const float scalar, const uint32_t start, const uint32_t count)
+{
+	uint32_t numElements = resolveRange(target, start, count);
+	checkSource(target, source, start + numElements);
+
+	uint32_t stride = floatsPerElement(target);
+	multiplyAddKernel(floats(target) + start * stride, floats(source) + start * stride, scalar, numElements * stride);
+}
+
+//-----------------------------------------------------------------
+
+void DatumMath::normalize(Datum& target, const uint32_t start, const uint32_t count)
+{
+	vec4* vectors = target.data<vec4>();
+	uint32_t numElements = resolveRange(target, start, count);
+
+	normalizeKernel(vectors + start, numElements);
+}
+
+//-----------------------------------------------------------------
+
+void DatumMath::transform(Datum& target, const Datum& matrices, const uint32_t start, const uint32_t count)
+{
+	vec4* vectors = target.data<vec4>();
+	uint32_t numElements = resolveRange(target, start, count);
+	uint32_t stride = matrixStride(matrices, start + numElements);
+
+	if(numElements > 0)
+	{
+		transformKernel(vectors + start, matrices.data<mat4x4>() + start * stride, stride, numElements);
+	}
+}
+
+//-----------------------------------------------------------------
+
+void DatumMath::multiply(Datum& target, const Datum& matrices, const uint32_t start, const uint32_t count)
+{
+	mat4x4* targetMatrices = target.data<mat4x4>();
+	uint32_t numElements = resolveRange(target, start, count);
+	uint32_t stride = matrixStride(matrices, start + numElements);
+
+	if(numElements > 0)
+	{
+		multiplyKernel(targetMatrices + start, matrices.data<mat4x4>() + start * stride, stride, numElements);
+	}
+}
+
+#pragma endregion
+
+//=================================================================
+
+#pragma region Validation
+
+uint32_t DatumMath::resolveRange(const Datum& target, const uint32_t start, const uint32_t count)
+{
+	if(start > target.size())
+	{
+		throw exception("Error -- range start is out of bounds for the target Datum!");
+	}
+
+	uint32_t numElements = (count == sAllElements) ? target.size() - start : count;
+	if(numElements > target.size() - start)
+	{
+		throw exception("Error -- range is out of bounds for the target Datum!");
+	}
+
+	return numElements;
+}
+
+//-----------------------------------------------------------------
+
+void DatumMath::checkSource(const Datum& target, const Datum& source, const uint32_t end)
+{
+	if(source.type() != target.type())
+	{
+		throw exception("Error -- source Datum's type does not match the target Datum's!");
+	}
+
+	if(end > source.size())
+	{
+		throw exception("Error -- range is out of bounds for the source Datum!");
+	}
+}
+
+//-----------------------------------------------------------------
+
+uint32_t DatumMath::matrixStride(const Datum& matrices, const uint32_t end)
+{
+	if(matrices.type() != Datum::DatumType::Matrix)
+	{
+		throw exception("Error -- matrices Datum must have type Matrix!");
+	}
+
+	// a single matrix is shared by the whole range
+	if(matrices.size() == 1)
+	{
+		return 0;
+	}
+
+	if(end > matrices.size())
+	{
+		throw exception("Error -- range is out of bounds for the matrices Datum!");
+	}
+
+	return 1;
+}
+
+//-----------------------------------------------------------------
+
+uint32_t DatumMath::floatsPerElement(const Datum& datum)
+{
+	uint32_t result = 0;
+	switch(datum.type())
+	{
+		case Datum::DatumType::Float:	result = 1;		break;
+		case Datum::DatumType::Vector:	result = 4;		break;
+		case Datum::DatumType::Matrix:	result = 16;	break;
+		default:						throw exception("Error -- bulk arithmetic needs a Float, Vector or Matrix Datum!");
+	}
+
+	return result;
+}
+
+//-----------------------------------------------------------------
+
+float* DatumMath::floats(Datum& datum)
+{
+	// callers have already checked the type with floatsPerElement
+	float* result = nullptr;
+	switch(datum.type())
+	{
+		case Datum::DatumType::Float:	result = datum.data<float>();								break;
+		case Datum::DatumType::Vector:	result = reinterpret_cast<float*>(datum.data<vec4>());		break;
+		default:						result = reinterpret_cast<float*>(datum.data<mat4x4>());	break;
+	}
+
+	return result;
+}
+
+//-----------------------------------------------------------------
+
+const float* DatumMath::floats(const Datum& datum)
+{
+	const float* result = nullptr;
+	switch(datum.type())
+	{
+		case Datum::DatumType::Float:	result = datum.data<float>();									break;
+		case Datum::DatumType::Vector:	result = reinterpret_cast<const float*>(datum.data<vec4>());		break;
+		default:						result = reinterpret_cast<const float*>(datum.data<mat4x4>());	break;
+	}
+
+	return result;
+}
+
+#pragma endregion
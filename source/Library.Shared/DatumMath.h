@@ -0,0 +1,146 @@
+#pragma once
+
+#include "Datum.h"
+
+namespace DOGEngine
+{
+	/**
+	 * Static class of bulk arithmetic over Float, Vector
+	 * and Matrix Datums. Each operation checks types and
+	 * bounds once, then runs an SSE kernel over the whole
+	 * range instead of going through get() and set() per
+	 * element.
+	 *
+	 * Every operation works on the elements [start,
+	 * start + count) of its target, in place. Source
+	 * Datums are read at the same indices, except that a
+	 * Matrix source holding a single element is applied to
+	 * the whole range.
+	 */
+	class DatumMath final
+	{
+	public:
+
+		/**
+		 * Count meaning "through the end of the target".
+		 */
+		static const std::uint32_t sAllElements = 0xFFFFFFFF;
+
+		DatumMath() = delete;
+
+		/**
+		 * @brief Adds source to target, element by
+		 *		  element.
+		 *
+		 * @param target The Float, Vector or Matrix Datum
+		 *				 being added to.
+		 * @param source A Datum of the same type as target.
+		 * @param start The first element. Defaulted to 0.
+		 * @param count The number of elements. Defaulted
+		 *				to the rest of the target.
+		 *
+		 * @exception Throws exception if the types are not
+		 *			  a matching Float, Vector or Matrix
+		 *			  pair, or the range is out of bounds
+		 *			  for either Datum.
+		 */
+		static void add(Datum& target, const Datum& source, const std::uint32_t start = 0, const std::uint32_t count = sAllElements);
+
+		/**
+		 * @brief Multiplies every component of target by a
+		 *		  scalar.
+		 *
+		 * @param target The Float, Vector or Matrix Datum
+		 *				 being scaled.
+		 * @param scalar The scale factor.
+		 * @param start The first element. Defaulted to 0.
+		 * @param count The number of elements. Defaulted
+		 *				to the rest of the target.
+		 *
+		 * @exception Throws exception if target is not a
+		 *			  Float, Vector or Matrix Datum, or the
+		 *			  range is out of bounds.
+		 */
+		static void scale(Datum& target, const float scalar, const std::uint32_t start = 0, const std::uint32_t count = sAllElements);
+
+		/**
+		 * @brief Adds source times a scalar to target,
+		 *		  element by element -- the usual
+		 *		  "position += velocity * dt" step.
+		 *
+		 * @param target The Float, Vector or Matrix Datum
+		 *				 being added to.
+		 * @param source A Datum of the same type as target.
+		 * @param scalar The factor source is multiplied by.
+		 * @param start The first element. Defaulted to 0.
+		 * @param count The number of elements. Defaulted
+		 *				to the rest of the target.
+		 *
+		 * @exception Throws exception if the types are not
+		 *			  a matching Float, Vector or Matrix
+		 *			  pair, or the range is out of bounds
+		 *			  for either Datum.
+		 */
+		static void multiplyAdd(Datum& target, const Datum& source, const float scalar, const std::uint32_t start = 0, const std::uint32_t count = sAllElements);
+
+		/**
+		 * @brief Normalizes every vec4 in target, the same
+		 *		  as glm::normalize.
+		 *
+		 * @param target The Vector Datum being normalized.
+		 * @param start The first element. Defaulted to 0.
+		 * @param count The number of elements. Defaulted
+		 *				to the rest of the target.
+		 *
+		 * @exception Throws exception if target is not a
+		 *			  Vector Datum, or the range is out of
+		 *			  bounds.
+		 */
+		static void normalize(Datum& target, const std::uint32_t start = 0, const std::uint32_t count = sAllElements);
+
+		/**
+		 * @brief Transforms every vec4 in target by a
+		 *		  matrix: target[i] = matrices[i] * target[i].
+		 *
+		 * @param target The Vector Datum being transformed.
+		 * @param matrices A Matrix Datum. A single matrix is
+		 *				   applied to every vector.
+		 * @param start The first element. Defaulted to 0.
+		 * @param count The number of elements. Defaulted
+		 *				to the rest of the target.
+		 *
+		 * @exception Throws exception if target is not a
+		 *			  Vector Datum or matrices is not a
+		 *			  Matrix Datum, or the range is out of
+		 *			  bounds for either Datum.
+		 */
+		static void transform(Datum& target, const Datum& matrices, const std::uint32_t start = 0, const std::uint32_t count = sAllElements);
+
+		/**
+		 * @brief Multiplies every mat4x4 in target on the
+		 *		  left by a matrix: target[i] = matrices[i]
+		 *		  * target[i].
+		 *
+		 * @param target The Matrix Datum being multiplied.
+		 * @param matrices A Matrix Datum. A single matrix is
+		 *				   applied to every element.
+		 * @param start The first element. Defaulted to 0.
+		 * @param count The number of elements. Defaulted
+		 *				to the rest of the target.
+		 *
+		 * @exception Throws exception if either Datum is not
+		 *			  a Matrix Datum, or the range is out of
+		 *			  bounds for either Datum.
+		 */
+		static void multiply(Datum& target, const Datum& matrices, const std::uint32_t start = 0, const std::uint32_t count = sAllElements);
+
+	private:
+
+		static std::uint32_t resolveRange(const Datum& target, const std::uint32_t start, const std::uint32_t count);
+		static void checkSource(const Datum& target, const Datum& source, const std::uint32_t end);
+		static std::uint32_t matrixStride(const Datum& matrices, const std::uint32_t end);
+		static std::uint32_t floatsPerElement(const Datum& datum);
+		static float* floats(Datum& datum);
+		static const float* floats(const Datum& datum);
+	};
+}
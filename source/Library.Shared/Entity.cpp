@@ -13,13 +13,14 @@ const string Entity::sNameAttribute = "name";
 const string Entity::sActionsAttribute = "actions";
 const string Entity::sReactionsAttribute = "reactions";
 
+const Symbol Entity::sNameSymbol(Entity::sNameAttribute);
+const Symbol Entity::sActionsSymbol(Entity::sActionsAttribute);
+const Symbol Entity::sReactionsSymbol(Entity::sReactionsAttribute);
+
 Entity::Entity(const string& name) :
 	Attributed()
 {
-	if(!areSignaturesInitialized())
-	{
-		initSignatures();
-	}
+	initSignaturesOnce();
 	populate();
 
 	// set name to the argument if we were given one (populate sets name to some default value)
@@ -156,14 +157,14 @@ Sector* Entity::getSector() const
 
 Datum& Entity::getActions() const
 {
-	return *find(sActionsAttribute);
+	return *mActions;
 }
 
 //-----------------------------------------------------------------
 
 Datum& Entity::getReactions() const
 {
-	return *find(sReactionsAttribute);
+	return *mReactions;
 }
 
 //-----------------------------------------------------------------
@@ -187,6 +188,9 @@ void Entity::populate()
 	addExternalAttribute(sNameAttribute, &mName, "Entity");
 	addTableEntry(sActionsAttribute);
 	addTableEntry(sReactionsAttribute);
+
+	mActions = find(sActionsSymbol);
+	mReactions = find(sReactionsSymbol);
 }
 
 //-----------------------------------------------------------------
@@ -194,5 +198,7 @@ void Entity::populate()
 void Entity::updateExternalStorage()
 {
 	Attributed::updateExternalStorage();
-	(*this)[sNameAttribute].setStorage(&mName, 1);
+
+	mActions = find(sActionsSymbol);
+	mReactions = find(sReactionsSymbol);
 }
@@ -174,8 +174,8 @@ namespace DOGEngine
 		virtual void populate() override;
 
 		/**
-		 * @brief Updates this class' table's pointers
-		 *		  to external storage.
+		 * @brief Re-resolves the cached child-collection
+		 *		  Datums.
 		 */
 		virtual void updateExternalStorage() override;
 
@@ -183,10 +183,17 @@ namespace DOGEngine
 
 		std::string mName;
 
+		Datum* mActions;
+		Datum* mReactions;
+
 	public:
 
 		const static std::string sNameAttribute;
 		const static std::string sActionsAttribute;
 		const static std::string sReactionsAttribute;
+
+		const static Symbol sNameSymbol;
+		const static Symbol sActionsSymbol;
+		const static Symbol sReactionsSymbol;
 	};
 }
@@ -6,6 +6,20 @@
 
 namespace DOGEngine
 {
+	/**
+	 * Templated functor that gives the subtype an Event
+	 * is routed by. By default, payloads have no subtype.
+	 *
+	 * You can specialize this template for payload types
+	 * that carry a subtype. Event expects that its subtype
+	 * functor implements a const operator().
+	 */
+	template <typename T>
+	struct EventSubtypeFunc
+	{
+		std::string operator()(const T& message) const;
+	};
+
 	/**
 	 * Templated Event class that defines an Event
 	 * capable of delivering some data-payload (the
@@ -14,6 +28,11 @@ namespace DOGEngine
 	 * Each templated Event has its own static list
 	 * of subscriber objects that are called when
 	 * the event is delivered.
+	 *
+	 * Subscribers may instead subscribe to single
+	 * subtypes. Those are kept in a static index from
+	 * subtype to subscribers, and are only called for
+	 * events whose message has a matching subtype.
 	 */
 	template <typename T>
 	class Event final : public EventPublisher
@@ -30,6 +49,16 @@ namespace DOGEngine
 		 */
 		explicit Event(const T& message);
 
+		/**
+		 * @brief Constructor. Takes over the payload
+		 *		  instead of copying it.
+		 *
+		 * @param message The object that this Event
+		 *				  delivers. Left in a moved-from
+		 *				  state.
+		 */
+		explicit Event(T&& message);
+
 		
 		/**
 		 * @brief Copy constructor.
@@ -79,18 +108,43 @@ namespace DOGEngine
 		 */
 		static void subscribe(IEventSubscriber& subscriber);
 
+		/**
+		 * @brief Adds an EventSubscriber to the static
+		 *		  subscriber index for a single subtype. It
+		 *		  is only notified of events with that
+		 *		  subtype. Does nothing if it is already
+		 *		  subscribed to the subtype.
+		 *
+		 * @param subscriber Reference to a subscriber
+		 *					 object.
+		 * @param subtype The subtype being subscribed to.
+		 */
+		static void subscribe(IEventSubscriber& subscriber, const std::string& subtype);
+
 		/**
 		 * @brief Removes an EventSubscriber from the static
-		 *		  list of subscribers.
+		 *		  list of subscribers, and from every subtype
+		 *		  it subscribed to.
 		 *
 		 * @param subscriber Reference to a subscriber
 		 *					 object.
 		 */
 		static void unsubscribe(IEventSubscriber& subscriber);
 
+		/**
+		 * @brief Removes an EventSubscriber from the static
+		 *		  subscriber index for a single subtype.
+		 *
+		 * @param subscriber Reference to a subscriber
+		 *					 object.
+		 * @param subtype The subtype being unsubscribed from.
+		 */
+		static void unsubscribe(IEventSubscriber& subscriber, const std::string& subtype);
+
 		/**
 		 * @brief Removes all subscriber objects from the
-		 *		  static list of subscribers.
+		 *		  static list of subscribers and the static
+		 *		  subtype index, and frees their storage.
 		 */
 		static void unsubscribeAll();
 
@@ -99,7 +153,8 @@ namespace DOGEngine
 		 *		  event.
 		 *
 		 * @return Returns the size of this type's static
-		 *		   subscriber list.
+		 *		   subscriber list plus the number of objects
+		 *		   subscribed to at least one subtype.
 		 */
 		static std::uint32_t numSubscribers();
 
@@ -113,14 +168,27 @@ namespace DOGEngine
 
 	private:
 
+		typedef HashMap<IEventSubscriber*, Vector<std::string>> SubscriberRoutes;
+
+		/**
+		 * @brief Removes a subscriber from one subtype's
+		 *		  list, dropping the list if it empties.
+		 *		  Expects sMutex to be held.
+		 */
+		static void removeRoute(IEventSubscriber& subscriber, const std::string& subtype);
+
 		T mMessage;
 
 		static Subscribers sSubscribers;
+		static SubtypeSubscribers sSubtypeSubscribers;
+		static SubscriberRoutes sRoutes;
 		static std::mutex sMutex;
 	};
 
 	template <typename T> RTTI_DEFINITIONS(Event<T>)
 	template <typename T> EventPublisher::Subscribers Event<T>::sSubscribers;
+	template <typename T> EventPublisher::SubtypeSubscribers Event<T>::sSubtypeSubscribers;
+	template <typename T> typename Event<T>::SubscriberRoutes Event<T>::sRoutes;
 	template <typename T> std::mutex Event<T>::sMutex;
 }
 
@@ -1,15 +1,38 @@
 
 namespace DOGEngine
 {
+
+#pragma region EventSubtypeFunc
+
+	template <typename T>
+	std::string EventSubtypeFunc<T>::operator()(const T& message) const
+	{
+		UNREFERENCED_PARAMETER(message);
+		return std::string();
+	}
+
+#pragma endregion
+
+#pragma region Event
+
 	template <typename T>
 	Event<T>::Event(const T& message) :
-		EventPublisher(sSubscribers, sMutex),
+		EventPublisher(sSubscribers, sSubtypeSubscribers, sMutex, EventSubtypeFunc<T>()(message)),
 		mMessage(message)
 	{
 	}
 
 	//-----------------------------------------------------------------
 
+	template <typename T>
+	Event<T>::Event(T&& message) :
+		EventPublisher(sSubscribers, sSubtypeSubscribers, sMutex, EventSubtypeFunc<T>()(message)),
+		mMessage(std::move(message))
+	{
+	}
+
+	//-----------------------------------------------------------------
+
 	template <typename T>
 	Event<T>::Event(const Event& other) :
 		EventPublisher(other),
@@ -72,11 +95,63 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
+	template <typename T>
+	void Event<T>::subscribe(IEventSubscriber& subscriber, const std::string& subtype)
+	{
+		std::lock_guard<std::mutex> lock(sMutex);
+
+		// each subscriber remembers its own subtypes, so unsubscribing never scans the whole index
+		typename SubscriberRoutes::Iterator routeIter = sRoutes.find(&subscriber);
+		if(routeIter == sRoutes.end())
+		{
+			routeIter = sRoutes.insert(std::make_pair(&subscriber, Vector<std::string>(1)));
+		}
+		else if(routeIter->second.find(subtype) != routeIter->second.end())
+		{
+			return;
+		}
+
+		routeIter->second.pushBack(subtype);
+		sSubtypeSubscribers[subtype].pushBack(&subscriber);
+	}
+
+	//-----------------------------------------------------------------
+
 	template <typename T>
 	void Event<T>::unsubscribe(IEventSubscriber& subscriber)
 	{
 		std::lock_guard<std::mutex> lock(sMutex);
 		sSubscribers.remove(&subscriber);
+
+		typename SubscriberRoutes::Iterator routeIter = sRoutes.find(&subscriber);
+		if(routeIter != sRoutes.end())
+		{
+			for(const std::string& subtype : routeIter->second)
+			{
+				removeRoute(subscriber, subtype);
+			}
+
+			sRoutes.remove(&subscriber);
+		}
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename T>
+	void Event<T>::unsubscribe(IEventSubscriber& subscriber, const std::string& subtype)
+	{
+		std::lock_guard<std::mutex> lock(sMutex);
+
+		typename SubscriberRoutes::Iterator routeIter = sRoutes.find(&subscriber);
+		if(routeIter != sRoutes.end() && routeIter->second.remove(subtype))
+		{
+			removeRoute(subscriber, subtype);
+
+			if(routeIter->second.isEmpty())
+			{
+				sRoutes.remove(&subscriber);
+			}
+		}
 	}
 
 	//-----------------------------------------------------------------
@@ -86,6 +161,11 @@ namespace DOGEngine
 	{
 		std::lock_guard<std::mutex> lock(sMutex);
 		sSubscribers.clear();
+		sSubscribers.shrinkToFit();
+		sSubtypeSubscribers.clear();
+		sSubtypeSubscribers.shrinkToFit();
+		sRoutes.clear();
+		sRoutes.shrinkToFit();
 	}
 
 	//-----------------------------------------------------------------
@@ -94,7 +174,7 @@ namespace DOGEngine
 	std::uint32_t Event<T>::numSubscribers()
 	{
 		std::lock_guard<std::mutex> lock(sMutex);
-		return sSubscribers.size();
+		return sSubscribers.size() + sRoutes.size();
 	}
 
 	//-----------------------------------------------------------------
@@ -104,4 +184,23 @@ namespace DOGEngine
 	{
 		return mMessage;
 	}
+
+	//-----------------------------------------------------------------
+
+	template <typename T>
+	void Event<T>::removeRoute(IEventSubscriber& subscriber, const std::string& subtype)
+	{
+		typename SubtypeSubscribers::Iterator subtypeIter = sSubtypeSubscribers.find(subtype);
+		assert(subtypeIter != sSubtypeSubscribers.end());
+
+		subtypeIter->second.remove(&subscriber);
+		if(subtypeIter->second.isEmpty())
+		{
+			sSubtypeSubscribers.remove(subtype);
+		}
+	}
+
+
+#pragma endregion
+
 }
@@ -102,3 +102,10 @@ WorldState* EventArgs::getWorldState() const
 {
 	return mWorldState;
 }
+
+//-----------------------------------------------------------------
+
+string EventSubtypeFunc<EventArgs>::operator()(const EventArgs& message) const
+{
+	return message.getSubtype();
+}
@@ -2,6 +2,7 @@
 #pragma once
 
 #include "Attributed.h"
+#include "Event.h"
 
 namespace DOGEngine
 {
@@ -107,4 +108,14 @@ namespace DOGEngine
 		std::string mSubtype;
 		WorldState* mWorldState;
 	};
+
+	/**
+	 * Specialized template of EventSubtypeFunc that
+	 * routes Event<EventArgs> by the args' subtype.
+	 */
+	template <>
+	struct EventSubtypeFunc<EventArgs>
+	{
+		std::string operator()(const EventArgs& message) const;
+	};
 }
@@ -8,11 +8,13 @@ using namespace std;
 
 RTTI_DEFINITIONS(EventPublisher)
 
-EventPublisher::EventPublisher(Subscribers& subscribers, mutex& mutex) :
+EventPublisher::EventPublisher(Subscribers& subscribers, SubtypeSubscribers& subtypeSubscribers, mutex& mutex, const string& subtype) :
 	mSubscribers(&subscribers),
+	mSubtypeSubscribers(&subtypeSubscribers),
 	mTimeEnqueued(),
 	mMutex(&mutex),
-	mDelay()
+	mDelay(),
+	mSubtype(subtype)
 {
 }
 
@@ -20,8 +22,11 @@ EventPublisher::EventPublisher(Subscribers& subscribers, mutex& mutex) :
 
 EventPublisher::EventPublisher(const EventPublisher& other) :
 	mSubscribers(other.mSubscribers),
+	mSubtypeSubscribers(other.mSubtypeSubscribers),
 	mTimeEnqueued(other.mTimeEnqueued),
-	mDelay(other.mDelay)
+	mMutex(other.mMutex),
+	mDelay(other.mDelay),
+	mSubtype(other.mSubtype)
 {
 }
 
@@ -32,8 +37,11 @@ EventPublisher& EventPublisher::operator=(const EventPublisher& other)
 	if(this != &other)
 	{
 		mSubscribers = other.mSubscribers;
+		mSubtypeSubscribers = other.mSubtypeSubscribers;
 		mTimeEnqueued = other.mTimeEnqueued;
+		mMutex = other.mMutex;
 		mDelay = other.mDelay;
+		mSubtype = other.mSubtype;
 	}
 
 	return *this;
@@ -43,8 +51,11 @@ EventPublisher& EventPublisher::operator=(const EventPublisher& other)
 
 EventPublisher::EventPublisher(EventPublisher&& other) :
 	mSubscribers(other.mSubscribers),
+	mSubtypeSubscribers(other.mSubtypeSubscribers),
 	mTimeEnqueued(other.mTimeEnqueued),
-	mDelay(other.mDelay)
+	mMutex(other.mMutex),
+	mDelay(other.mDelay),
+	mSubtype(std::move(other.mSubtype))
 {
 	// we don't reset other's subscribers pointer, since it points to the same static memory
 	other.mTimeEnqueued = high_resolution_clock::time_point();
@@ -58,8 +69,11 @@ EventPublisher& EventPublisher::operator=(EventPublisher&& other)
 	if(this != &other)
 	{
 		mSubscribers = other.mSubscribers;
+		mSubtypeSubscribers = other.mSubtypeSubscribers;
 		mTimeEnqueued = other.mTimeEnqueued;
+		mMutex = other.mMutex;
 		mDelay = other.mDelay;
+		mSubtype = std::move(other.mSubtype);
 
 		// we don't reset other's subscribers pointer, since it points to the same static memory
 		other.mTimeEnqueued = high_resolution_clock::time_point();
@@ -78,30 +92,49 @@ EventPublisher::~EventPublisher()
 //-----------------------------------------------------------------
 
 void EventPublisher::deliver()
+{
+	JobSystem::JobGroup group;
+	deliver(group);
+	group.wait();
+}
+
+//-----------------------------------------------------------------
+
+void EventPublisher::deliver(JobSystem::JobGroup& group)
 {
 	assert(mSubscribers != nullptr);
+	assert(mSubtypeSubscribers != nullptr);
 	assert(mMutex != nullptr);
 
-	// don't want to trash the list in the middle of processing, so iterating over a copy
+	// don't want to trash the lists in the middle of processing, so iterating over copies
 	//		locking during copy
+	//		routed subscribers for other subtypes are never touched
 	Subscribers subscribers;
+	Subscribers routedSubscribers;
 	{
 		lock_guard<mutex> lock(*mMutex);
 		subscribers = *mSubscribers;
+
+		SubtypeSubscribers::Iterator routedIter = mSubtypeSubscribers->find(mSubtype);
+		if(routedIter != mSubtypeSubscribers->end())
+		{
+			routedSubscribers = routedIter->second;
+		}
 	}
 
-	// spin up async calls for each subscriber in our list
-	vector<future<void>> futures;
+	// one notify job per subscriber, handed to the job system as a single batch
+	vector<JobSystem::Job> jobs;
+	jobs.reserve(subscribers.size() + routedSubscribers.size());
 	for(IEventSubscriber* subscriber : subscribers)
 	{
-		futures.emplace_back(async(&IEventSubscriber::notify, subscriber, cref(*this)));
+		jobs.emplace_back([subscriber, this]{ subscriber->notify(*this); });
 	}
-
-	// wait for all threads to return
-	for(future<void>& future : futures)
+	for(IEventSubscriber* subscriber : routedSubscribers)
 	{
-		future.wait();
+		jobs.emplace_back([subscriber, this]{ subscriber->notify(*this); });
 	}
+
+	group.submit(jobs);
 }
 
 //-----------------------------------------------------------------
@@ -128,13 +161,29 @@ const milliseconds& EventPublisher::delay() const
 
 //-----------------------------------------------------------------
 
+const string& EventPublisher::subtype() const
+{
+	return mSubtype;
+}
+
+//-----------------------------------------------------------------
+
 uint32_t EventPublisher::numSubscribers() const
 {
 	assert(mSubscribers != nullptr);
+	assert(mSubtypeSubscribers != nullptr);
 	assert(mMutex != nullptr);
 
 	lock_guard<mutex> lock(*mMutex);
-	return mSubscribers->size();
+	uint32_t result = mSubscribers->size();
+
+	SubtypeSubscribers::Iterator routedIter = mSubtypeSubscribers->find(mSubtype);
+	if(routedIter != mSubtypeSubscribers->end())
+	{
+		result += routedIter->second.size();
+	}
+
+	return result;
 }
 
 //-----------------------------------------------------------------
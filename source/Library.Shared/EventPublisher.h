@@ -3,9 +3,11 @@
 
 #include "RTTI.h"
 #include "Vector.h"
+#include "HashMap.h"
 
 #include "IEventSubscriber.h"
 #include "GameTime.h"
+#include "JobSystem.h"
 
 namespace DOGEngine
 {
@@ -16,6 +18,12 @@ namespace DOGEngine
 	 *
 	 * Events can be time-delayed, and will wait
 	 * for the designated time to be delivered.
+	 *
+	 * Subscribers either receive every event of
+	 * the derived type, or only events whose
+	 * subtype they subscribed to. Routed subscribers
+	 * are looked up by subtype when delivering, so
+	 * the cost scales with matches.
 	 */
 	class IEventSubscriber;
 	class EventPublisher abstract : public RTTI
@@ -25,6 +33,7 @@ namespace DOGEngine
 	protected:
 
 		typedef Vector<IEventSubscriber*> Subscribers;
+		typedef HashMap<std::string, Subscribers> SubtypeSubscribers;
 
 	public:
 
@@ -33,8 +42,15 @@ namespace DOGEngine
 		 *
 		 * @param subscribers Reference to the derived class'
 		 *					  static subscriber list.
+		 * @param subtypeSubscribers Reference to the derived
+		 *							 class' static subscribers,
+		 *							 indexed by subtype.
+		 * @param mutex Reference to the derived class' static
+		 *				mutex guarding both lists.
+		 * @param subtype The subtype this object is routed
+		 *				  by. Defaults to no subtype.
 		 */
-		explicit EventPublisher(Subscribers& subscribers, std::mutex& mutex);
+		EventPublisher(Subscribers& subscribers, SubtypeSubscribers& subtypeSubscribers, std::mutex& mutex, const std::string& subtype = "");
 
 		/**
 		 * @brief Copy constructor.
@@ -77,10 +93,25 @@ namespace DOGEngine
 
 		/**
 		 * @brief Delivers this object to its 
-		 *		  subscribers.
+		 *		  subscribers. Blocks until every
+		 *		  subscriber has been notified.
 		 */
 		void deliver();
 
+		/**
+		 * @brief Queues one notify job per current
+		 *		  subscriber on the given group, and
+		 *		  returns without waiting. Only the
+		 *		  unrouted subscribers and those
+		 *		  subscribed to this object's subtype
+		 *		  are notified.
+		 *
+		 * @param group The JobGroup that the notify
+		 *				jobs join. This object must
+		 *				outlive the group's wait.
+		 */
+		void deliver(JobSystem::JobGroup& group);
+
 		/**
 		 * @brief Sets time-related member variables.
 		 *
@@ -110,10 +141,20 @@ namespace DOGEngine
 		const std::chrono::milliseconds& delay() const;
 
 		/**
-		 * @brief Retrieves the number of objects subscribed
-		 *		  to this type of event.
+		 * @brief Retrieves the subtype this object is
+		 *		  routed by.
 		 *
-		 * @return Returns the size of the mSubscribers Vector.
+		 * @return Returns mSubtype
+		 */
+		const std::string& subtype() const;
+
+		/**
+		 * @brief Retrieves the number of objects this
+		 *		  object is delivered to.
+		 *
+		 * @return Returns the number of unrouted subscribers
+		 *		   plus the number subscribed to this
+		 *		   object's subtype.
 		 */
 		std::uint32_t numSubscribers() const;
 
@@ -132,11 +173,14 @@ namespace DOGEngine
 	protected:
 
 		Subscribers* mSubscribers;
+		SubtypeSubscribers* mSubtypeSubscribers;
 		std::mutex* mMutex;
 
 	private:
 
 		std::chrono::high_resolution_clock::time_point mTimeEnqueued;
 		std::chrono::milliseconds mDelay;
+
+		std::string mSubtype;
 	};
 }
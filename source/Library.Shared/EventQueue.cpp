@@ -7,15 +7,22 @@ using namespace DOGEngine;
 using namespace std;
 
 EventQueue::EventQueue() :
-	mEvents()
+	mEvents(),
+	mNextSequence(0),
+	mStaged(nullptr),
+	mNumStaged(0)
 {
 }
 
 //-----------------------------------------------------------------
 
 EventQueue::EventQueue(const EventQueue& other) :
-	mEvents(other.mEvents)
+	mEvents(),
+	mNextSequence(0),
+	mStaged(nullptr),
+	mNumStaged(0)
 {
+	operator=(other);
 }
 
 //-----------------------------------------------------------------
@@ -24,7 +31,21 @@ EventQueue& EventQueue::operator=(const EventQueue& other)
 {
 	if(this != &other)
 	{
+		discardStaged();
 		mEvents = other.mEvents;
+		mNextSequence = other.mNextSequence;
+
+		// other's staged events aren't ordered yet, so they are copied straight into our heap
+		//		the staging list is newest-first, so it is replayed back to front to keep enqueue order
+		Vector<const StagedEvent*> staged;
+		for(const StagedEvent* node = other.mStaged.load(memory_order_acquire); node != nullptr; node = node->mNext)
+		{
+			staged.pushBack(node);
+		}
+		for(uint32_t i = staged.size(); i > 0; --i)
+		{
+			push(staged[i - 1]->mEvent, staged[i - 1]->mDueTime);
+		}
 	}
 
 	return *this;
@@ -33,8 +54,12 @@ EventQueue& EventQueue::operator=(const EventQueue& other)
 //-----------------------------------------------------------------
 
 EventQueue::EventQueue(EventQueue&& other) :
-	mEvents(std::move(other.mEvents))
+	mEvents(std::move(other.mEvents)),
+	mNextSequence(other.mNextSequence),
+	mStaged(other.mStaged.exchange(nullptr)),
+	mNumStaged(other.mNumStaged.exchange(0))
 {
+	other.mNextSequence = 0;
 }
 
 //-----------------------------------------------------------------
@@ -43,7 +68,13 @@ EventQueue& EventQueue::operator=(EventQueue&& other)
 {
 	if(this != &other)
 	{
+		discardStaged();
 		mEvents = std::move(other.mEvents);
+		mNextSequence = other.mNextSequence;
+		mStaged = other.mStaged.exchange(nullptr);
+		mNumStaged = other.mNumStaged.exchange(0);
+
+		other.mNextSequence = 0;
 	}
 
 	return *this;
@@ -53,6 +84,7 @@ EventQueue& EventQueue::operator=(EventQueue&& other)
 
 EventQueue::~EventQueue()
 {
+	discardStaged();
 }
 
 //-----------------------------------------------------------------
@@ -60,45 +92,50 @@ EventQueue::~EventQueue()
 void EventQueue::update(const GameTime& gameTime)
 {
 	// move all expired events to a temporary queue
-	Events tempEvents;
+	Vector<shared_ptr<EventPublisher>> tempEvents;
 
 	{
-		// temporarily lock the queue while we partition it
+		// temporarily lock the queue while we pop the due events off the top of the heap
+		//		they come off in due order, which keeps delivery order deterministic
 		lock_guard<mutex> lock(mMutex);
 
-		uint32_t last = mEvents.size();
-		for(uint32_t start = 0; start < last; ++start)
+		// everything enqueued since the last update joins the heap first
+		drainStaged();
+
+		while(!mEvents.isEmpty() && mEvents.front().mDueTime < gameTime.CurrentTime())
 		{
-			while(start != last && mEvents[start]->isExpired(gameTime))
-			{
-				mEvents[start].swap(mEvents[--last]);
-				tempEvents.pushBack(mEvents[last]);
-				mEvents.popBack();
-			}
+			tempEvents.pushBack(pop());
 		}
 	}
 
-	// spin up async calls for each expired event in our list
-	vector<future<void>> futures;
-	for(auto& publisher : tempEvents)
+	if(tempEvents.isEmpty())
 	{
-		futures.emplace_back(async(&EventPublisher::deliver, publisher));
+		return;
 	}
 
-	// wait for all threads to return
-	for(future<void>& future : futures)
+	// each expired event fans its subscribers out into the same group when it runs
+	//		so the whole frame's delivery shares one join barrier
+	JobSystem::JobGroup group;
+
+	vector<JobSystem::Job> jobs;
+	jobs.reserve(tempEvents.size());
+	for(auto& publisher : tempEvents)
 	{
-		future.wait();
+		EventPublisher* publisherPtr = publisher.get();
+		jobs.emplace_back([publisherPtr, &group]{ publisherPtr->deliver(group); });
 	}
+
+	// tempEvents keeps every publisher alive until the group has finished with them
+	group.submit(jobs);
+	group.wait();
 }
 
 //-----------------------------------------------------------------
 
 void EventQueue::enqueue(EventPublisher& publisher, const GameTime& gameTime, milliseconds delay)
 {
-	lock_guard<mutex> lock(mMutex);
 	publisher.setTime(gameTime.CurrentTime(), delay);
-	mEvents.pushBack(shared_ptr<EventPublisher>(&publisher));
+	stage(shared_ptr<EventPublisher>(&publisher));
 }
 
 //-----------------------------------------------------------------
@@ -107,10 +144,8 @@ void EventQueue::enqueue(const shared_ptr<EventPublisher>& publisher, const Game
 {
 	assert(publisher.get() != nullptr);
 
-	lock_guard<mutex> lock(mMutex);
-
 	publisher->setTime(gameTime.CurrentTime(), delay);
-	mEvents.pushBack(publisher);
+	stage(publisher);
 }
 
 //-----------------------------------------------------------------
@@ -133,6 +168,7 @@ void EventQueue::send(const shared_ptr<EventPublisher>& publisher)
 void EventQueue::clear()
 {
 	lock_guard<mutex> lock(mMutex);
+	discardStaged();
 	mEvents.clear();
 }
 
@@ -141,7 +177,7 @@ void EventQueue::clear()
 uint32_t EventQueue::size() const
 {
 	lock_guard<mutex> lock(mMutex);
-	return mEvents.size();
+	return mEvents.size() + mNumStaged;
 }
 
 //-----------------------------------------------------------------
@@ -149,5 +185,137 @@ uint32_t EventQueue::size() const
 bool EventQueue::isEmpty() const
 {
 	lock_guard<mutex> lock(mMutex);
-	return mEvents.isEmpty();
+	return mEvents.isEmpty() && mNumStaged == 0;
+}
+
+//-----------------------------------------------------------------
+
+void EventQueue::stage(const shared_ptr<EventPublisher>& publisher)
+{
+	// counted before it is visible, so a concurrent drain can never take the count below zero
+	++mNumStaged;
+
+	// push onto the front of the staging list -- producers only ever contend on this one CAS
+	StagedEvent* staged = new StagedEvent{ publisher, publisher->timeEnqueued() + publisher->delay(), mStaged.load(memory_order_relaxed) };
+	while(!mStaged.compare_exchange_weak(staged->mNext, staged, memory_order_release, memory_order_relaxed))
+	{
+	}
+}
+
+//-----------------------------------------------------------------
+
+void EventQueue::drainStaged()
+{
+	// take the whole list in one swap, then reverse it back into enqueue order
+	StagedEvent* node = mStaged.exchange(nullptr, memory_order_acquire);
+
+	StagedEvent* ordered = nullptr;
+	while(node != nullptr)
+	{
+		StagedEvent* next = node->mNext;
+		node->mNext = ordered;
+		ordered = node;
+		node = next;
+	}
+
+	uint32_t numDrained = 0;
+	while(ordered != nullptr)
+	{
+		StagedEvent* next = ordered->mNext;
+		push(ordered->mEvent, ordered->mDueTime);
+		delete ordered;
+
+		ordered = next;
+		++numDrained;
+	}
+
+	mNumStaged -= numDrained;
+}
+
+//-----------------------------------------------------------------
+
+void EventQueue::discardStaged()
+{
+	StagedEvent* node = mStaged.exchange(nullptr, memory_order_acquire);
+
+	uint32_t numDiscarded = 0;
+	while(node != nullptr)
+	{
+		StagedEvent* next = node->mNext;
+		delete node;
+
+		node = next;
+		++numDiscarded;
+	}
+
+	mNumStaged -= numDiscarded;
+}
+
+//-----------------------------------------------------------------
+
+void EventQueue::push(const shared_ptr<EventPublisher>& publisher, const high_resolution_clock::time_point& dueTime)
+{
+	QueuedEvent queued{ publisher, dueTime, mNextSequence++ };
+	mEvents.pushBack(queued);
+
+	// sift the new entry up to its place
+	uint32_t index = mEvents.size() - 1;
+	while(index > 0)
+	{
+		uint32_t parent = (index - 1) / 2;
+		if(!isBefore(mEvents[index], mEvents[parent]))
+		{
+			break;
+		}
+
+		std::swap(mEvents[index], mEvents[parent]);
+		index = parent;
+	}
+}
+
+//-----------------------------------------------------------------
+
+shared_ptr<EventPublisher> EventQueue::pop()
+{
+	assert(!mEvents.isEmpty());
+
+	shared_ptr<EventPublisher> result = std::move(mEvents.front().mEvent);
+
+	// the last entry fills the hole at the top, then sifts down to its place
+	std::swap(mEvents.front(), mEvents.back());
+	mEvents.popBack();
+
+	uint32_t size = mEvents.size();
+	uint32_t index = 0;
+	while(true)
+	{
+		uint32_t earliest = index;
+		uint32_t left = index * 2 + 1;
+		uint32_t right = left + 1;
+
+		if(left < size && isBefore(mEvents[left], mEvents[earliest]))
+		{
+			earliest = left;
+		}
+		if(right < size && isBefore(mEvents[right], mEvents[earliest]))
+		{
+			earliest = right;
+		}
+		if(earliest == index)
+		{
+			break;
+		}
+
+		std::swap(mEvents[index], mEvents[earliest]);
+		index = earliest;
+	}
+
+	return result;
+}
+
+//-----------------------------------------------------------------
+
+bool EventQueue::isBefore(const QueuedEvent& lhs, const QueuedEvent& rhs)
+{
+	return lhs.mDueTime < rhs.mDueTime || (lhs.mDueTime == rhs.mDueTime && lhs.mSequence < rhs.mSequence);
 }
@@ -15,6 +15,18 @@ namespace DOGEngine
 	 * Enqueued events must be heap-allocated, and
 	 * are consumed by the EventQueue, so no action
 	 * to delete the created Events is necessary.
+	 *
+	 * Pending events are kept in a binary min-heap
+	 * ordered by due time, so an update only visits
+	 * the events that are due. Events due at the same
+	 * time are delivered in the order they were
+	 * enqueued.
+	 *
+	 * Enqueuing never takes the queue's lock. New
+	 * events are pushed onto a lock-free staging list,
+	 * which update drains into the heap once per call.
+	 * Any number of threads may enqueue while a single
+	 * thread updates.
 	 */
 	class EventQueue final
 	{
@@ -65,7 +77,8 @@ namespace DOGEngine
 		virtual ~EventQueue();
 
 		/**
-		 * @brief Delivers any expired events.
+		 * @brief Delivers any expired events. Costs
+		 *		  O(k log n) for k expired events.
 		 *
 		 * @param gameTime Reference to the game's
 		 *				   time keeper.
@@ -73,7 +86,9 @@ namespace DOGEngine
 		void update(const GameTime& gameTime);
 
 		/**
-		 * @brief Adds an event to the queue.
+		 * @brief Adds an event to the queue. Never
+		 *		  blocks, and is safe to call from any
+		 *		  thread, including during delivery.
 		 *
 		 * @param publisher The event being added.
 		 * @param gameTime Reference to the game's
@@ -137,8 +152,82 @@ namespace DOGEngine
 
 	private:
 
-		typedef Vector<std::shared_ptr<EventPublisher>> Events;
+		/**
+		 * Node in the staging list of events enqueued
+		 * since the last update. Newest first.
+		 */
+		struct StagedEvent
+		{
+			std::shared_ptr<EventPublisher> mEvent;
+			std::chrono::high_resolution_clock::time_point mDueTime;
+			StagedEvent* mNext;
+		};
+
+		/**
+		 * Heap entry for a pending event. The due time is
+		 * captured on enqueue so the heap stays ordered
+		 * even if the event's time is reset while queued.
+		 */
+		struct QueuedEvent
+		{
+			std::shared_ptr<EventPublisher> mEvent;
+			std::chrono::high_resolution_clock::time_point mDueTime;
+			std::uint64_t mSequence;
+		};
+
+		typedef Vector<QueuedEvent> Events;
+
+		/**
+		 * @brief Pushes an event onto the staging list
+		 *		  without locking. Safe to call from any
+		 *		  number of threads.
+		 *
+		 * @param publisher The event being added. Its time
+		 *					must already be set.
+		 */
+		void stage(const std::shared_ptr<EventPublisher>& publisher);
+
+		/**
+		 * @brief Moves every staged event into the heap, in
+		 *		  the order they were enqueued. Expects
+		 *		  mMutex to be held.
+		 */
+		void drainStaged();
+
+		/**
+		 * @brief Deletes every staged event without
+		 *		  queuing it.
+		 */
+		void discardStaged();
+
+		/**
+		 * @brief Adds an event to the heap. Expects mMutex
+		 *		  to be held.
+		 *
+		 * @param publisher The event being added.
+		 * @param dueTime The time the event is due.
+		 */
+		void push(const std::shared_ptr<EventPublisher>& publisher, const std::chrono::high_resolution_clock::time_point& dueTime);
+
+		/**
+		 * @brief Removes the earliest event from the heap.
+		 *		  Expects mMutex to be held.
+		 *
+		 * @return Returns the removed event.
+		 */
+		std::shared_ptr<EventPublisher> pop();
+
+		/**
+		 * @brief Says whether one heap entry is due before
+		 *		  another. Ties go to the first enqueued.
+		 */
+		static bool isBefore(const QueuedEvent& lhs, const QueuedEvent& rhs);
+
 		Events mEvents;
+		std::uint64_t mNextSequence;
+
+		std::atomic<StagedEvent*> mStaged;
+		std::atomic<std::uint32_t> mNumStaged;
 
 		mutable std::mutex mMutex;
 	};
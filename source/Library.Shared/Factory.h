@@ -36,6 +36,14 @@ namespace DOGEngine
 	 * way, Factories can persist outside of the stack frames
 	 * in which they were declared. It is up to some outside
 	 * caller to delete the registered Factories in this case.
+	 *
+	 * find, create, isFactoryRegistered, numFactories and
+	 * registration are guarded by a per-family mutex, so
+	 * products may be created from worker threads (the Xml
+	 * subfile loader does). The Iterators returned by begin
+	 * and end and the map returned by getFactories are not
+	 * guarded; do not walk them while Factories are being
+	 * added or removed on another thread.
 	 */
 	template <typename TBaseProduct>
 	class Factory
@@ -191,7 +199,8 @@ namespace DOGEngine
 		/**
 		 * @brief Attempts to unregister the concrete Factory
 		 *		  from this object's HashMap. Called from
-		 *		  concrete Factory destructors.
+		 *		  concrete Factory destructors. The HashMap's
+		 *		  storage is freed along with the last Factory.
 		 *
 		 * @param factory A reference to the outgoing concrete
 		 *				  Factory.
@@ -203,6 +212,7 @@ namespace DOGEngine
 	private:
 
 		static ConcreteFactories sFactories;
+		static std::mutex sFactoriesMutex;
 	};
 
 	/**
@@ -266,6 +276,7 @@ namespace DOGEngine
 	 * Definition for abstract Factory Hashmaps.
 	 */
 	template <typename TBaseProduct> HashMap<std::string, Factory<TBaseProduct>*> Factory<TBaseProduct>::sFactories;
+	template <typename TBaseProduct> std::mutex Factory<TBaseProduct>::sFactoriesMutex;
 }
 
 #include "Factory.inl"
@@ -12,6 +12,7 @@ namespace DOGEngine
 	Factory<TBaseProduct>* Factory<TBaseProduct>::find(const std::string& productName)
 	{
 		// try to find factory with given name and return a pointer to it (null if not found)
+		std::lock_guard<std::mutex> lock(sFactoriesMutex);
 		FactoriesIterator iter = sFactories.find(productName);
 		return iter != sFactories.end() ? iter->second : nullptr;
 	}
@@ -21,7 +22,9 @@ namespace DOGEngine
 	template <typename TBaseProduct>
 	TBaseProduct* Factory<TBaseProduct>::create(const std::string& productName)
 	{
-		return sFactories.containsKey(productName) ? sFactories[productName]->create() : nullptr;
+		// only the lookup is locked; construction of the product runs unguarded
+		Factory<TBaseProduct>* factory = find(productName);
+		return factory != nullptr ? factory->create() : nullptr;
 	}
 
 	//-----------------------------------------------------------------
@@ -45,6 +48,7 @@ namespace DOGEngine
 	template <typename TBaseProduct>
 	bool Factory<TBaseProduct>::isFactoryRegistered(const std::string& productName)
 	{
+		std::lock_guard<std::mutex> lock(sFactoriesMutex);
 		return sFactories.containsKey(productName);
 	}
 
@@ -61,6 +65,7 @@ namespace DOGEngine
 	template <typename TBaseProduct>
 	std::uint32_t Factory<TBaseProduct>::numFactories()
 	{
+		std::lock_guard<std::mutex> lock(sFactoriesMutex);
 		return sFactories.size();
 	}
 
@@ -73,6 +78,7 @@ namespace DOGEngine
 		//		return sets a flag on the factory that says if it's registered
 		//		it is up to the caller to handle what to do with unregistered factories
 		bool didInsert = false;
+		std::lock_guard<std::mutex> lock(sFactoriesMutex);
 		sFactories.insert(PairType(factory.getProductName(), &factory), &didInsert);
 
 		return didInsert;
@@ -86,7 +92,14 @@ namespace DOGEngine
 		// we only remove the registered factory since that is the inserted one
 		if(factory.isRegistered())
 		{
+			std::lock_guard<std::mutex> lock(sFactoriesMutex);
 			sFactories.remove(factory.getProductName());
+
+			// the map is static, so its storage goes with the last factory
+			if(sFactories.isEmpty())
+			{
+				sFactories.shrinkToFit();
+			}
 		}
 	}
 }
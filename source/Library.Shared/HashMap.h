@@ -2,9 +2,9 @@
 #pragma once
 
 #include "pch.h"
+#include "SlabAllocator.h"
+#include "HeapAllocator.h"
 
-#include "SList.h"
-#include "Vector.h"
 
 namespace DOGEngine
 {
@@ -13,7 +13,7 @@ namespace DOGEngine
 
 	/**
 	 * Templated functor that provides a default hash for
-	 * non-pointer key types.
+	 * non-pointer key types. Hashes the key's bytes.
 	 *
 	 * You can specialize this template to provide custom
 	 * hash functions for HashMap. HashMap expects that
@@ -37,7 +37,8 @@ namespace DOGEngine
 
 	/**
 	 * Specialized template of HashFunc that implements a
-	 * hash function for std::string key types.
+	 * hash function for std::string key types. Uses FNV-1a,
+	 * so anagrams like "ab" and "ba" hash differently.
 	 */
 	template <>
 	struct HashFunc<std::string>
@@ -79,18 +80,35 @@ namespace DOGEngine
 	 * Templated container class. Stores a hash map of
 	 * unordered, unique key-value pairs.
 	 *
-	 * Implemented with chaining as a Vector of SLists.
+	 * Implemented with Robin Hood open addressing over a
+	 * flat power-of-two slot array. Each slot caches the
+	 * full hash of its key, so probes compare integers
+	 * before ever touching a key. Removal uses backward
+	 * shifting, so there are no tombstones.
+	 *
+	 * Key-value pairs come from the TAllocator policy (by
+	 * default, blocks owned by the map -- see SlabAllocator)
+	 * and the slots only hold their addresses. References
+	 * and pointers to stored pairs therefore stay valid
+	 * across a rehash (Scope depends on this).
 	 */
-	template <typename TKey, typename TValue, typename THash = HashFunc<TKey>, typename TComp = CompareFunc<TKey>>
+	template <typename TKey, typename TValue, typename THash = HashFunc<TKey>, typename TComp = CompareFunc<TKey>, template <typename> class TAllocator = SlabAllocator>
 	class HashMap final
 	{
 
 	private:
 
 		typedef std::pair<TKey, TValue> PairType;
-		typedef SList<PairType> ChainType;
-		typedef  Vector<ChainType> Buckets;
-		typedef typename ChainType::Iterator ChainIter;
+
+		/**
+		 * One entry of the open-addressed table. An empty
+		 * slot has a null pair pointer.
+		 */
+		struct Slot
+		{
+			PairType* mPair;
+			std::uint32_t mHash;
+		};
 
 	public:
 		
@@ -144,7 +162,7 @@ namespace DOGEngine
 			 *
 			 * @return Returns true if the two Iterators have
 			 *		   the same owners and point to the same
-			 *		   location in the same HashMap chain.
+			 *		   slot in the HashMap.
 			 *		   Otherwise, returns false.
 			 */
 			bool operator==(const Iterator& other) const;
@@ -158,7 +176,7 @@ namespace DOGEngine
 			 *
 			 * @return Returns true if the two Iterators do
 			 *		   not have the same owners or if they
-			 *		   point to different chain locations.
+			 *		   point to different slots.
 			 *		   Otherwise, returns false.
 			 */
 			bool operator!=(const Iterator& other) const;
@@ -238,34 +256,34 @@ namespace DOGEngine
 
 			/**
 			 * @brief Constructor. Creates a HashMap Iterator
-			 *		  with the given owner, bucket index, and
-			 *		  chain position.
+			 *		  with the given owner and slot index.
 			 *
 			 * @param owner The HashMap to which this Iterator
 			 *				belongs.
-			 * @param index The index of the chain to which
+			 * @param index The index of the slot to which
 			 *				this Iterator points.
-			 * @param chainIter The SList Iterator that points
-			 *		  to this Iterator's position in a chain.
 			 */
-			Iterator(const HashMap* owner, std::uint32_t index, ChainIter chainIter);
+			Iterator(const HashMap* owner, std::uint32_t index);
 
 			const HashMap* mOwner;	
 			std::uint32_t mIndex;
-			ChainIter mChainIter;
 		};
 
 		/**
 		 * @brief Constructor. Creates an empty HashMap.
-		 *		  If no argument is provided, the number
-		 *		  of chains in the HashMap is defaulted
-		 *		  to 13.
+		 *		  If no argument is provided, the HashMap
+		 *		  is sized to hold 13 elements before its
+		 *		  first rehash.
 		 *
-		 * @param numBuckets The number of array elements
-		 *					 (chains) this HashMap has.
+		 * @param numBuckets The number of elements the
+		 *					 HashMap can hold before it
+		 *					 has to rehash.
 		 *
 		 * @note Throws an exception if the number of
-		 *		 chains is 0.
+		 *		 buckets is 0.
+		 *
+		 * @note No slots are allocated until the first
+		 *		 insertion.
 		 */
 		explicit HashMap(std::uint32_t numBuckets = 13);
 
@@ -446,9 +464,48 @@ namespace DOGEngine
 
 		/**
 		 * @brief Clears the HashMap of all stored elements.
+		 *		  The slot array and pair blocks are kept
+		 *		  for reuse.
 		 */
 		void clear();
 
+		/**
+		 * @brief Shrinks the slot array to the smallest
+		 *		  size the current contents need. An empty
+		 *		  HashMap frees its slot array and pair
+		 *		  blocks, and holds no memory until its
+		 *		  next insertion.
+		 *
+		 * @note Invalidates Iterators, but not references
+		 *		 to stored key-value pairs.
+		 */
+		void shrinkToFit();
+
+		/**
+		 * @brief Ensures the HashMap can hold the given
+		 *		  number of elements without rehashing.
+		 *
+		 * @param numElements The number of elements the
+		 *					  HashMap should be able to
+		 *					  hold.
+		 */
+		void reserve(std::uint32_t numElements);
+
+		/**
+		 * @brief Rebuilds the slot array with at least the
+		 *		  given number of slots and reinserts every
+		 *		  stored element.
+		 *
+		 * @param numSlots The requested number of slots.
+		 *				   Rounded up to a power of two and
+		 *				   to whatever the current size
+		 *				   needs under the max load factor.
+		 *
+		 * @note Invalidates Iterators, but not references
+		 *		 to stored key-value pairs.
+		 */
+		void rehash(std::uint32_t numSlots);
+
 		/**
 		 * @brief Says whether the HashMap contains a 
 		 *		  key-value pair with the given key.
@@ -481,6 +538,32 @@ namespace DOGEngine
 		 */
 		bool isEmpty() const;
 
+		/**
+		 * @brief Getter for how many heap allocations this
+		 *		  map's allocator has made for its pairs.
+		 *
+		 * @return Returns the allocator's lifetime count.
+		 */
+		std::uint32_t numHeapAllocations() const;
+
+		/**
+		 * @brief Getter for the number of slots in the
+		 *		  HashMap's table.
+		 *
+		 * @return Returns the number of allocated slots.
+		 *		   This is 0 until the first insertion.
+		 */
+		std::uint32_t capacity() const;
+
+		/**
+		 * @brief Getter for the fraction of slots that
+		 *		  are occupied.
+		 *
+		 * @return Returns size() / capacity(), or 0 if no
+		 *		   slots have been allocated.
+		 */
+		float loadFactor() const;
+
 		/**
 		 * @brief Getter for a HashMap Iterator that points
 		 *		  to the first key-value pair stored in the
@@ -521,11 +604,8 @@ namespace DOGEngine
 		 * @return Returns an Iterator pointing to no
 		 *		   key-value pair in the HashMap.
 		 *
-		 * @note This Iterator is considered to be the end
-		 *		 of the last chain in the HashMap. Note that
-		 *		 the last chain is considered to be the last
-		 *		 chain in the HashMap array, and not the last
-		 *		 chain with inserted items.
+		 * @note This Iterator is considered to be one past
+		 *		 the last slot in the HashMap's table.
 		 */
 		Iterator end();
 
@@ -537,39 +617,126 @@ namespace DOGEngine
 		 * @return Returns a const Iterator pointing to no
 		 *		   key-value pair in the HashMap.
 	 	 *
-		 * @note This Iterator is considered to be the end
-		 *		 of the last chain in the HashMap. Note that
-		 *		 the last chain is considered to be the last
-		 *		 chain in the HashMap array, and not the last
-		 *		 chain with inserted items.
+		 * @note This Iterator is considered to be one past
+		 *		 the last slot in the HashMap's table.
 		 */
 		const Iterator end() const;
 
 	private:
 
 		/**
-		 * @brief Getter for the start of the next non-empty
-		 *		  SList, starting from the given array index.
+		 * @brief Getter for the index of the next occupied
+		 *		  slot, starting from the given index.
+		 *
+		 * @param index The starting point for the search.
+		 *				This index is inclusive.
+		 *
+		 * @return Returns the index of the first occupied
+		 *		   slot at or beyond 'index', or capacity()
+		 *		   if there is none.
+		 */
+		std::uint32_t getNextOccupied(std::uint32_t index) const;
+
+		/**
+		 * @brief Getter for the slot index holding the given
+		 *		  key.
 		 *
-		 * @param index The starting point for the search for
-		 *				the next non-empty SList. This index
-		 *				is inclusive.
+		 * @param key The key for which we are searching.
+		 * @param hash The mixed hash of 'key'.
+		 *
+		 * @return Returns the index of the slot holding
+		 *		   'key', or capacity() if it is not stored.
+		 */
+		std::uint32_t findSlot(const TKey& key, std::uint32_t hash) const;
+
+		/**
+		 * @brief Places an already-allocated pair into the
+		 *		  table, displacing richer entries along the
+		 *		  probe sequence. Assumes the key is not in
+		 *		  the table and that there is a free slot.
+		 *
+		 * @param pair The heap-allocated key-value pair.
+		 * @param hash The mixed hash of the pair's key.
+		 *
+		 * @return Returns the slot index where 'pair' ended up.
+		 */
+		std::uint32_t placeSlot(PairType* pair, std::uint32_t hash);
+
+		/**
+		 * @brief Getter for how far the entry in the given
+		 *		  slot sits from its home slot.
+		 *
+		 * @param index The slot index.
+		 * @param hash The mixed hash stored in that slot.
+		 *
+		 * @return Returns the probe distance of the entry.
+		 */
+		std::uint32_t probeDistance(std::uint32_t index, std::uint32_t hash) const;
+
+		/**
+		 * @brief Getter for the mixed hash of a key. The user
+		 *		  hash functor's output goes through a final
+		 *		  avalanche step, so weak hashes still spread
+		 *		  over a power-of-two table.
+		 *
+		 * @param key The key to hash.
+		 *
+		 * @return Returns the mixed hash value.
+		 */
+		std::uint32_t hashKey(const TKey& key) const;
+
+		/**
+		 * @brief Allocates the slot array on first insertion,
+		 *		  or doubles it when one more element would
+		 *		  pass the max load factor.
+		 */
+		void growForInsert();
+
+		/**
+		 * @brief Destroys every pair, then frees the slot
+		 *		  array and the pair blocks.
+		 */
+		void destroy();
+
+		/**
+		 * @brief Frees the slot array and the pair blocks.
+		 *		  Expects every pair to have been destroyed
+		 *		  already.
+		 */
+		void releaseSlots();
+
+		/**
+		 * @brief Constructs a key-value pair in storage
+		 *		  from the allocator.
+		 *
+		 * @param args The arguments for the pair's
+		 *			   constructor.
 		 *
-		 * @return Returns an SList Iterator pointing to the
-		 *		   beginning of the first non-empty SList
-		 *		   if there was a non-empty SList in the
-		 *		   HashMap's array at or beyond the given
-		 *		   index. If all SLists at or beyond the index
-		 *		   are empty, the returned SList Iterator points
-		 *		   to the end of the last bucket.
+		 * @return Returns the new pair.
 		 */
-		ChainIter getNextChainBegin(std::uint32_t& index) const;
+		template <typename... TArgs>
+		PairType* createPair(TArgs&&... args);
 
-		Buckets mBuckets;
+		/**
+		 * @brief Destroys a key-value pair and hands its
+		 *		  storage back to the allocator.
+		 *
+		 * @param pair The pair being destroyed.
+		 */
+		void destroyPair(PairType* pair);
+
+		static const std::uint32_t sMaxLoadNumerator = 7;
+		static const std::uint32_t sMaxLoadDenominator = 8;
+
+		Slot* mSlots;
+		std::uint32_t mCapacity;
 		std::uint32_t mSize;
+		std::uint32_t mInitialCapacity;
 
 		THash mHashFunc;
 		TComp mCompFunc;
+
+		TAllocator<PairType> mPairs;
 	};
 }
 
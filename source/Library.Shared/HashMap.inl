@@ -4,42 +4,56 @@ namespace DOGEngine
 
 #pragma region HashMap
 	
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	HashMap<TKey, TValue, THash, TComp>::HashMap(std::uint32_t numBuckets) :
-		mBuckets(numBuckets),
-		mSize(0)
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	HashMap<TKey, TValue, THash, TComp, TAllocator>::HashMap(std::uint32_t numBuckets) :
+		mSlots(nullptr),
+		mCapacity(0),
+		mSize(0),
+		mInitialCapacity(numBuckets)
 	{
 		if(numBuckets == 0)
 		{
 			throw std::exception("Error -- cannot create a HashMap with 0 buckets!");
 		}
-
-		// start a new empty chain for each bucket in the hashmap
-		for(std::uint32_t i = 0; i < numBuckets; ++i)
-		{
-			mBuckets.pushBack(ChainType());
-		}
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	HashMap<TKey, TValue, THash, TComp>::HashMap(const HashMap& other) :
-		mBuckets(other.mBuckets),
-		mSize(other.mSize)
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	HashMap<TKey, TValue, THash, TComp, TAllocator>::HashMap(const HashMap& other) :
+		mSlots(nullptr),
+		mCapacity(0),
+		mSize(0),
+		mInitialCapacity(other.mInitialCapacity)
 	{
+		operator=(other);
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	HashMap<TKey, TValue, THash, TComp>& HashMap<TKey, TValue, THash, TComp>::operator=(const HashMap& other)
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	HashMap<TKey, TValue, THash, TComp, TAllocator>& HashMap<TKey, TValue, THash, TComp, TAllocator>::operator=(const HashMap& other)
 	{
 		if(this != &other)
 		{
-			// assignment operator for Vector handles deep copy of data
-			mBuckets = other.mBuckets;
-			mSize = other.mSize;
+			destroy();
+			mInitialCapacity = other.mInitialCapacity;
+
+			if(other.mCapacity > 0)
+			{
+				// same capacity and same hashes means every entry can be copied into the same slot it has in other
+				mSlots = new Slot[other.mCapacity];
+				mCapacity = other.mCapacity;
+
+				for(std::uint32_t i = 0; i < mCapacity; ++i)
+				{
+					const Slot& otherSlot = other.mSlots[i];
+					mSlots[i].mPair = (otherSlot.mPair != nullptr) ? createPair(*otherSlot.mPair) : nullptr;
+					mSlots[i].mHash = otherSlot.mHash;
+				}
+
+				mSize = other.mSize;
+			}
 		}
 
 		return *this;
@@ -47,32 +61,34 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	HashMap<TKey, TValue, THash, TComp>::HashMap(HashMap&& other)
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	HashMap<TKey, TValue, THash, TComp, TAllocator>::HashMap(HashMap&& other) :
+		mSlots(nullptr),
+		mCapacity(0),
+		mSize(0),
+		mInitialCapacity(other.mInitialCapacity)
 	{
 		operator=(std::move(other));
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	HashMap<TKey, TValue, THash, TComp>& HashMap<TKey, TValue, THash, TComp>::operator=(HashMap&& other)
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	HashMap<TKey, TValue, THash, TComp, TAllocator>& HashMap<TKey, TValue, THash, TComp, TAllocator>::operator=(HashMap&& other)
 	{
 		if(&other != this)
 		{
-			// blow away all data in this object, then reserve space in this vector using other's size
-			mBuckets.clear();
-			mBuckets.shrinkToFit();
-			mBuckets.reserve(other.mBuckets.size());
+			destroy();
 
-			// create new chains and move other's chains to them
+			// steal other's slot array and pair allocator -- the pairs themselves never move, so pointers into them stay valid
+			mSlots = other.mSlots;
+			mCapacity = other.mCapacity;
 			mSize = other.mSize;
-			for(std::uint32_t i = 0; i < mBuckets.capacity(); ++i)
-			{
-				mBuckets.pushBack(ChainType());
-				mBuckets[i] = std::move(other.mBuckets[i]);
-			}
+			mInitialCapacity = other.mInitialCapacity;
+			mPairs = std::move(other.mPairs);
 
+			other.mSlots = nullptr;
+			other.mCapacity = 0;
 			other.mSize = 0;
 		}
 
@@ -81,15 +97,16 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	HashMap<TKey, TValue, THash, TComp>::~HashMap()
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	HashMap<TKey, TValue, THash, TComp, TAllocator>::~HashMap()
 	{
+		destroy();
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	bool HashMap<TKey, TValue, THash, TComp>::operator==(const HashMap& other) const
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	bool HashMap<TKey, TValue, THash, TComp, TAllocator>::operator==(const HashMap& other) const
 	{
 		// we assume the hashmaps are equal, and may be proven false
 		bool result = true;
@@ -131,38 +148,43 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	bool HashMap<TKey, TValue, THash, TComp>::operator!=(const HashMap& other) const
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	bool HashMap<TKey, TValue, THash, TComp, TAllocator>::operator!=(const HashMap& other) const
 	{
 		return !operator==(other);
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	TValue& HashMap<TKey, TValue, THash, TComp>::operator[](const TKey& key)
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	TValue& HashMap<TKey, TValue, THash, TComp, TAllocator>::operator[](const TKey& key)
 	{
-		// attempt to insert a default PairType to the list
-		//		if key is already in the list, insert() returns an Iterator to the data that's there and the Hashmap is unchanged
-		//		if key is not in the list, then the default PairType is inserted
-		Iterator dataIter = insert(PairType(key, TValue()));
+		// look the key up first so that hits don't have to construct a default PairType
+		std::uint32_t hash = hashKey(key);
+		std::uint32_t index = findSlot(key, hash);
+		if(index == mCapacity)
+		{
+			growForInsert();
+
+			index = placeSlot(createPair(key, TValue()), hash);
+			++mSize;
+		}
 
-		// either way, we return a reference to the TData from insert's returned Iterator
-		return dataIter->second;
+		return mSlots[index].mPair->second;
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	const TValue& HashMap<TKey, TValue, THash, TComp>::operator[](const TKey& key) const
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	const TValue& HashMap<TKey, TValue, THash, TComp, TAllocator>::operator[](const TKey& key) const
 	{
 		return at(key).second;
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	typename HashMap<TKey, TValue, THash, TComp>::PairType& HashMap<TKey, TValue, THash, TComp>::at(const TKey& key)
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	typename HashMap<TKey, TValue, THash, TComp, TAllocator>::PairType& HashMap<TKey, TValue, THash, TComp, TAllocator>::at(const TKey& key)
 	{
 		Iterator dataIter = find(key);
 		if(dataIter == end())
@@ -175,8 +197,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	typename const HashMap<TKey, TValue, THash, TComp>::PairType& HashMap<TKey, TValue, THash, TComp>::at(const TKey& key) const
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	typename const HashMap<TKey, TValue, THash, TComp, TAllocator>::PairType& HashMap<TKey, TValue, THash, TComp, TAllocator>::at(const TKey& key) const
 	{
 		Iterator dataIter = find(key);
 		if(dataIter == end())
@@ -189,34 +211,16 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	typename HashMap<TKey, TValue, THash, TComp>::Iterator HashMap<TKey, TValue, THash, TComp>::find(const TKey& key) const
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	typename HashMap<TKey, TValue, THash, TComp, TAllocator>::Iterator HashMap<TKey, TValue, THash, TComp, TAllocator>::find(const TKey& key) const
 	{
-		// init our return value to the Hashmap end() (overwritten if the data is found in the expected chain)
-		Iterator returnIter = end();
-
-		// we need to get the bucket index in which we expect to find the requested data
-		std::uint32_t index = mHashFunc(key) % mBuckets.size();
-
-		ChainIter iter;
-		ChainIter endIter = mBuckets[index].end();
-		for(iter = mBuckets[index].begin(); iter != endIter; ++iter)
-		{
-			// go through the expected chain, and reset our return value if we find the data
-			if(mCompFunc(key, (*iter).first))
-			{
-				returnIter = Iterator(this, index, iter);
-				break;
-			}
-		}
-
-		return returnIter;
+		return Iterator(this, findSlot(key, hashKey(key)));
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	typename HashMap<TKey, TValue, THash, TComp>::Iterator HashMap<TKey, TValue, THash, TComp>::insert(const PairType& data, bool* outDidInsert)
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	typename HashMap<TKey, TValue, THash, TComp, TAllocator>::Iterator HashMap<TKey, TValue, THash, TComp, TAllocator>::insert(const PairType& data, bool* outDidInsert)
 	{
 		if(outDidInsert != nullptr)
 		{
@@ -224,15 +228,15 @@ namespace DOGEngine
 		}
 
 		// insert the data to the Hashmap only if the key is not found
-		//		if the data is found, we return the Iterator that find() returns
-		Iterator dataIter = find(data.first);
-		if(dataIter == end())
+		//		if the data is found, we return an Iterator to what's already there
+		std::uint32_t hash = hashKey(data.first);
+		std::uint32_t index = findSlot(data.first, hash);
+		if(index == mCapacity)
 		{
-			// we need to get the bucket to which we are inserting
-			std::uint32_t index = mHashFunc(data.first) % mBuckets.size();
+			// grow before placing so that the table never goes past its max load factor
+			growForInsert();
 
-			// we return an Iterator pointing to the inserted element
-			dataIter = Iterator(this, index, mBuckets[index].pushBack(data));
+			index = placeSlot(createPair(data), hash);
 			++mSize;
 
 			if(outDidInsert != nullptr)
@@ -241,126 +245,395 @@ namespace DOGEngine
 			}
 		}
 
-		return dataIter;
+		return Iterator(this, index);
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	void HashMap<TKey, TValue, THash, TComp>::remove(const TKey& key)
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	void HashMap<TKey, TValue, THash, TComp, TAllocator>::remove(const TKey& key)
 	{
-		Iterator removeIter = find(key);
-		if(removeIter != end())
+		std::uint32_t index = findSlot(key, hashKey(key));
+		if(index != mCapacity)
 		{
-			mBuckets[removeIter.mIndex].remove(removeIter.mChainIter);
+			destroyPair(mSlots[index].mPair);
 			--mSize;
+
+			// backward-shift deletion -- pull each following displaced entry one slot closer to home
+			//		stops at an empty slot or an entry already in its home slot, so no tombstones are needed
+			std::uint32_t mask = mCapacity - 1;
+			std::uint32_t next = (index + 1) & mask;
+			while(mSlots[next].mPair != nullptr && probeDistance(next, mSlots[next].mHash) != 0)
+			{
+				mSlots[index] = mSlots[next];
+				index = next;
+				next = (next + 1) & mask;
+			}
+
+			mSlots[index].mPair = nullptr;
+			mSlots[index].mHash = 0;
 		}
 	}
 	
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	void HashMap<TKey, TValue, THash, TComp>::clear()
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	void HashMap<TKey, TValue, THash, TComp, TAllocator>::clear()
 	{
-		// clear each bucket
+		for(std::uint32_t i = 0; i < mCapacity; ++i)
+		{
+			if(mSlots[i].mPair != nullptr)
+			{
+				destroyPair(mSlots[i].mPair);
+				mSlots[i].mPair = nullptr;
+				mSlots[i].mHash = 0;
+			}
+		}
+
 		mSize = 0;
-		for(ChainType& chain : mBuckets)
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	void HashMap<TKey, TValue, THash, TComp, TAllocator>::shrinkToFit()
+	{
+		if(mSize == 0)
+		{
+			releaseSlots();
+		}
+		else
+		{
+			rehash(0);
+		}
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	void HashMap<TKey, TValue, THash, TComp, TAllocator>::reserve(std::uint32_t numElements)
+	{
+		if(numElements == 0)
+		{
+			return;
+		}
+
+		// smallest power of two that keeps numElements under the max load factor
+		std::uint32_t numSlots = 8;
+		while(numSlots * sMaxLoadNumerator < numElements * sMaxLoadDenominator)
+		{
+			numSlots <<= 1;
+		}
+
+		if(numSlots > mCapacity)
 		{
-			chain.clear();
+			rehash(numSlots);
 		}
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	bool HashMap<TKey, TValue, THash, TComp>::containsKey(const TKey& key) const
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	void HashMap<TKey, TValue, THash, TComp, TAllocator>::rehash(std::uint32_t numSlots)
+	{
+		// never shrink below what the current contents need
+		std::uint32_t newCapacity = 8;
+		while(newCapacity < numSlots || newCapacity * sMaxLoadNumerator < mSize * sMaxLoadDenominator)
+		{
+			newCapacity <<= 1;
+		}
+
+		if(newCapacity == mCapacity)
+		{
+			return;
+		}
+
+		Slot* oldSlots = mSlots;
+		std::uint32_t oldCapacity = mCapacity;
+
+		mSlots = new Slot[newCapacity];
+		mCapacity = newCapacity;
+		for(std::uint32_t i = 0; i < mCapacity; ++i)
+		{
+			mSlots[i].mPair = nullptr;
+			mSlots[i].mHash = 0;
+		}
+
+		// the cached hashes mean nothing gets rehashed -- the pairs just get new slots
+		for(std::uint32_t i = 0; i < oldCapacity; ++i)
+		{
+			if(oldSlots[i].mPair != nullptr)
+			{
+				placeSlot(oldSlots[i].mPair, oldSlots[i].mHash);
+			}
+		}
+
+		delete[] oldSlots;
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	bool HashMap<TKey, TValue, THash, TComp, TAllocator>::containsKey(const TKey& key) const
 	{
 		// Hashmap contains key if find result is not end()
-		return find(key) != end();
+		return findSlot(key, hashKey(key)) != mCapacity;
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	std::uint32_t HashMap<TKey, TValue, THash, TComp>::size() const
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	std::uint32_t HashMap<TKey, TValue, THash, TComp, TAllocator>::size() const
 	{
 		return mSize;
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	bool HashMap<TKey, TValue, THash, TComp>::isEmpty() const
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	bool HashMap<TKey, TValue, THash, TComp, TAllocator>::isEmpty() const
 	{
 		return mSize == 0;
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	typename HashMap<TKey, TValue, THash, TComp>::Iterator HashMap<TKey, TValue, THash, TComp>::begin()
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	std::uint32_t HashMap<TKey, TValue, THash, TComp, TAllocator>::numHeapAllocations() const
 	{
-		std::uint32_t startIndex = 0;
-		ChainIter chainBegin = getNextChainBegin(startIndex);
+		return mPairs.numHeapAllocations();
+	}
+
+	//-----------------------------------------------------------------
 
-		return Iterator(this, startIndex, chainBegin);
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	std::uint32_t HashMap<TKey, TValue, THash, TComp, TAllocator>::capacity() const
+	{
+		return mCapacity;
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	typename const HashMap<TKey, TValue, THash, TComp>::Iterator HashMap<TKey, TValue, THash, TComp>::begin() const
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	float HashMap<TKey, TValue, THash, TComp, TAllocator>::loadFactor() const
 	{
-		std::uint32_t startIndex = 0;
-		ChainIter chainBegin = getNextChainBegin(startIndex);
+		return (mCapacity == 0) ? 0.0f : static_cast<float>(mSize) / mCapacity;
+	}
 
-		return Iterator(this, startIndex, chainBegin);
+	//-----------------------------------------------------------------
+
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	typename HashMap<TKey, TValue, THash, TComp, TAllocator>::Iterator HashMap<TKey, TValue, THash, TComp, TAllocator>::begin()
+	{
+		return Iterator(this, getNextOccupied(0));
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	typename HashMap<TKey, TValue, THash, TComp>::Iterator HashMap<TKey, TValue, THash, TComp>::end()
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	typename const HashMap<TKey, TValue, THash, TComp, TAllocator>::Iterator HashMap<TKey, TValue, THash, TComp, TAllocator>::begin() const
 	{
-		// the end Iterator points to the end of the last chain
-		std::uint32_t numBuckets = mBuckets.size();
-		return Iterator(this, numBuckets - 1, mBuckets[numBuckets - 1].end());
+		return Iterator(this, getNextOccupied(0));
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	typename HashMap<TKey, TValue, THash, TComp, TAllocator>::Iterator HashMap<TKey, TValue, THash, TComp, TAllocator>::end()
+	{
+		// the end Iterator points one past the last slot
+		return Iterator(this, mCapacity);
 	}
 	
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	typename const HashMap<TKey, TValue, THash, TComp>::Iterator HashMap<TKey, TValue, THash, TComp>::end() const
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	typename const HashMap<TKey, TValue, THash, TComp, TAllocator>::Iterator HashMap<TKey, TValue, THash, TComp, TAllocator>::end() const
+	{
+		// the end Iterator points one past the last slot
+		return Iterator(this, mCapacity);
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	std::uint32_t HashMap<TKey, TValue, THash, TComp, TAllocator>::getNextOccupied(std::uint32_t index) const
+	{
+		for(; index < mCapacity; ++index)
+		{
+			if(mSlots[index].mPair != nullptr)
+			{
+				break;
+			}
+		}
+
+		return index;
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	std::uint32_t HashMap<TKey, TValue, THash, TComp, TAllocator>::findSlot(const TKey& key, std::uint32_t hash) const
 	{
-		// the end Iterator points to the end of the last chain
-		std::uint32_t numBuckets = mBuckets.size();
-		return Iterator(this, numBuckets - 1, mBuckets[numBuckets - 1].end());
+		if(mSize == 0)
+		{
+			return mCapacity;
+		}
+
+		std::uint32_t mask = mCapacity - 1;
+		std::uint32_t index = hash & mask;
+		for(std::uint32_t distance = 0; ; ++distance)
+		{
+			const Slot& slot = mSlots[index];
+
+			// an empty slot, or an entry closer to its home than we are to ours, means the key would have been placed before here
+			if(slot.mPair == nullptr || probeDistance(index, slot.mHash) < distance)
+			{
+				break;
+			}
+
+			// only compare keys when the cached hashes agree
+			if(slot.mHash == hash && mCompFunc(key, slot.mPair->first))
+			{
+				return index;
+			}
+
+			index = (index + 1) & mask;
+		}
+
+		return mCapacity;
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	typename HashMap<TKey, TValue, THash, TComp>::ChainIter HashMap<TKey, TValue, THash, TComp>::getNextChainBegin(std::uint32_t& index) const
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	std::uint32_t HashMap<TKey, TValue, THash, TComp, TAllocator>::placeSlot(PairType* pair, std::uint32_t hash)
 	{
-		std::uint32_t numBuckets = mBuckets.size();
-		for(; index < numBuckets; ++index)
+		std::uint32_t mask = mCapacity - 1;
+		std::uint32_t index = hash & mask;
+		std::uint32_t distance = 0;
+
+		// the slot where the new pair lands is the first one it takes, even if it later displaces others
+		std::uint32_t placedIndex = mCapacity;
+		Slot carried = { pair, hash };
+
+		for(;;)
 		{
-			// check chains' isEmpty while the index is within range of the buckets Vector
-			//		'index' is passed byref, so it value is changed
-			if(!mBuckets[index].isEmpty())
+			Slot& slot = mSlots[index];
+			if(slot.mPair == nullptr)
 			{
+				slot = carried;
+				if(placedIndex == mCapacity)
+				{
+					placedIndex = index;
+				}
 				break;
 			}
+
+			// Robin Hood -- take the slot from any entry that is closer to its home than we are
+			std::uint32_t slotDistance = probeDistance(index, slot.mHash);
+			if(slotDistance < distance)
+			{
+				std::swap(slot, carried);
+				if(placedIndex == mCapacity)
+				{
+					placedIndex = index;
+				}
+				distance = slotDistance;
+			}
+
+			index = (index + 1) & mask;
+			++distance;
 		}
 
-		if(index >= numBuckets)
+		return placedIndex;
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	void HashMap<TKey, TValue, THash, TComp, TAllocator>::growForInsert()
+	{
+		if(mCapacity == 0)
+		{
+			// first insertion -- the slot array is sized from the constructor argument
+			reserve(mInitialCapacity);
+		}
+		else if((mSize + 1) * sMaxLoadDenominator > mCapacity * sMaxLoadNumerator)
+		{
+			reserve(mSize + 1);
+		}
+	}
+	//-----------------------------------------------------------------
+
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	std::uint32_t HashMap<TKey, TValue, THash, TComp, TAllocator>::probeDistance(std::uint32_t index, std::uint32_t hash) const
+	{
+		return (index - hash) & (mCapacity - 1);
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	std::uint32_t HashMap<TKey, TValue, THash, TComp, TAllocator>::hashKey(const TKey& key) const
+	{
+		// murmur3 finalizer
+		std::uint32_t hash = mHashFunc(key);
+		hash ^= hash >> 16;
+		hash *= 0x85ebca6b;
+		hash ^= hash >> 13;
+		hash *= 0xc2b2ae35;
+		hash ^= hash >> 16;
+
+		return hash;
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	void HashMap<TKey, TValue, THash, TComp, TAllocator>::destroy()
+	{
+		clear();
+		releaseSlots();
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	void HashMap<TKey, TValue, THash, TComp, TAllocator>::releaseSlots()
+	{
+		delete[] mSlots;
+		mSlots = nullptr;
+		mCapacity = 0;
+
+		mPairs.release();
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	template <typename... TArgs>
+	typename HashMap<TKey, TValue, THash, TComp, TAllocator>::PairType* HashMap<TKey, TValue, THash, TComp, TAllocator>::createPair(TArgs&&... args)
+	{
+		void* memory = mPairs.allocate();
+		try
+		{
+			return new(memory) PairType(std::forward<TArgs>(args)...);
+		}
+		catch(...)
 		{
-			// no non-empty bucekts were found, so we have to bring index back in range
-			//		in this case, begin() and end() for the chain are the same
-			index = numBuckets - 1;
+			mPairs.deallocate(memory);
+			throw;
 		}
+	}
+
+	//-----------------------------------------------------------------
 
-		return mBuckets[index].begin();
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	void HashMap<TKey, TValue, THash, TComp, TAllocator>::destroyPair(PairType* pair)
+	{
+		pair->~PairType();
+		mPairs.deallocate(pair);
 	}
 
 #pragma endregion
@@ -369,51 +642,47 @@ namespace DOGEngine
 
 #pragma region HashMapIterator
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	HashMap<TKey, TValue, THash, TComp>::Iterator::Iterator() :
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	HashMap<TKey, TValue, THash, TComp, TAllocator>::Iterator::Iterator() :
 		mOwner(nullptr),
-		mIndex(0),
-		mChainIter(ChainIter())
+		mIndex(0)
 	{
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	HashMap<TKey, TValue, THash, TComp>::Iterator::Iterator(const HashMap* owner, std::uint32_t index, ChainIter chainIter) :
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	HashMap<TKey, TValue, THash, TComp, TAllocator>::Iterator::Iterator(const HashMap* owner, std::uint32_t index) :
 		mOwner(owner),
-		mIndex(index),
-		mChainIter(chainIter)
+		mIndex(index)
 	{
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	HashMap<TKey, TValue, THash, TComp>::Iterator::Iterator(const Iterator& other) :
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	HashMap<TKey, TValue, THash, TComp, TAllocator>::Iterator::Iterator(const Iterator& other) :
 		mOwner(other.mOwner),
-		mIndex(other.mIndex),
-		mChainIter(other.mChainIter)
+		mIndex(other.mIndex)
 	{
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	HashMap<TKey, TValue, THash, TComp>::Iterator::~Iterator()
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	HashMap<TKey, TValue, THash, TComp, TAllocator>::Iterator::~Iterator()
 	{
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	typename HashMap<TKey, TValue, THash, TComp>::Iterator& HashMap<TKey, TValue, THash, TComp>::Iterator::operator=(const Iterator& other)
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	typename HashMap<TKey, TValue, THash, TComp, TAllocator>::Iterator& HashMap<TKey, TValue, THash, TComp, TAllocator>::Iterator::operator=(const Iterator& other)
 	{
 		if(this != &other)
 		{
 			mOwner = other.mOwner;
 			mIndex = other.mIndex;
-			mChainIter = other.mChainIter;
 		}
 
 		return *this;
@@ -421,42 +690,34 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	bool HashMap<TKey, TValue, THash, TComp>::Iterator::operator==(const Iterator& other) const
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	bool HashMap<TKey, TValue, THash, TComp, TAllocator>::Iterator::operator==(const Iterator& other) const
 	{
-		// mChainIter equivalency depends on which chain each Iterator points to (or place in the Buckets)
-		//		so checking the mIndex equivalency is irrelevant
-		return mOwner == other.mOwner && mChainIter == other.mChainIter;
+		return mOwner == other.mOwner && mIndex == other.mIndex;
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	bool HashMap<TKey, TValue, THash, TComp>::Iterator::operator!=(const Iterator& other) const
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	bool HashMap<TKey, TValue, THash, TComp, TAllocator>::Iterator::operator!=(const Iterator& other) const
 	{
 		return !operator==(other);
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	typename HashMap<TKey, TValue, THash, TComp>::Iterator& HashMap<TKey, TValue, THash, TComp>::Iterator::operator++()
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	typename HashMap<TKey, TValue, THash, TComp, TAllocator>::Iterator& HashMap<TKey, TValue, THash, TComp, TAllocator>::Iterator::operator++()
 	{
 		if(mOwner == nullptr)
 		{
 			throw std::exception("Error -- cannot increment an unowned Iterator!");
 		}
 
-		// increment the current chain Iterator
-		if(++mChainIter == mOwner->mBuckets[mIndex].end())
+		// step to the next occupied slot -- incrementing end() leaves it at end()
+		if(mIndex < mOwner->mCapacity)
 		{
-			// if we're at the current chain's end(), we have to check if the current chain is the last one in the map
-			if(mIndex != mOwner->mBuckets.size() - 1)
-			{
-				// if the current chain is not the last one in the map, we get the begin() of the next non-empty chain
-				// this way, the Iterator only points to a chain's end() if it is also pointing to the HashMap's end()
-				mChainIter = mOwner->getNextChainBegin(++mIndex);
-			}
+			mIndex = mOwner->getNextOccupied(mIndex + 1);
 		}
 
 		return *this;
@@ -464,8 +725,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	typename HashMap<TKey, TValue, THash, TComp>::Iterator HashMap<TKey, TValue, THash, TComp>::Iterator::operator++(int)
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	typename HashMap<TKey, TValue, THash, TComp, TAllocator>::Iterator HashMap<TKey, TValue, THash, TComp, TAllocator>::Iterator::operator++(int)
 	{
 		Iterator savedIter = *this;
 		operator++();
@@ -475,52 +736,52 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	typename HashMap<TKey, TValue, THash, TComp>::PairType& HashMap<TKey, TValue, THash, TComp>::Iterator::operator*()
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	typename HashMap<TKey, TValue, THash, TComp, TAllocator>::PairType& HashMap<TKey, TValue, THash, TComp, TAllocator>::Iterator::operator*()
 	{
 		if(mOwner == nullptr)
 		{
 			throw std::exception("Error -- cannot dereference an Iterator that does not belong to a HashMap!");
 		}
 
-		if(*this == mOwner->end())
+		if(mIndex >= mOwner->mCapacity || mOwner->mSlots[mIndex].mPair == nullptr)
 		{
 			throw std::exception("Error -- cannot dereference an Iterator that does not point to data!");
 		}
 
-		return *mChainIter;
+		return *mOwner->mSlots[mIndex].mPair;
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	typename const HashMap<TKey, TValue, THash, TComp>::PairType& HashMap<TKey, TValue, THash, TComp>::Iterator::operator*() const
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	typename const HashMap<TKey, TValue, THash, TComp, TAllocator>::PairType& HashMap<TKey, TValue, THash, TComp, TAllocator>::Iterator::operator*() const
 	{
 		if(mOwner == nullptr)
 		{
 			throw std::exception("Error -- cannot dereference an Iterator that does not belong to a HashMap!");
 		}
 
-		if(*this == mOwner->end())
+		if(mIndex >= mOwner->mCapacity || mOwner->mSlots[mIndex].mPair == nullptr)
 		{
 			throw std::exception("Error -- cannot dereference an Iterator that does not point to data!");
 		}
 
-		return *mChainIter;
+		return *mOwner->mSlots[mIndex].mPair;
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	typename HashMap<TKey, TValue, THash, TComp>::PairType* HashMap<TKey, TValue, THash, TComp>::Iterator::operator->()
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	typename HashMap<TKey, TValue, THash, TComp, TAllocator>::PairType* HashMap<TKey, TValue, THash, TComp, TAllocator>::Iterator::operator->()
 	{
 		return &(operator*());
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename TKey, typename TValue, typename THash, typename TComp>
-	typename const HashMap<TKey, TValue, THash, TComp>::PairType* HashMap<TKey, TValue, THash, TComp>::Iterator::operator->() const
+	template <typename TKey, typename TValue, typename THash, typename TComp, template <typename> class TAllocator>
+	typename const HashMap<TKey, TValue, THash, TComp, TAllocator>::PairType* HashMap<TKey, TValue, THash, TComp, TAllocator>::Iterator::operator->() const
 	{
 		return &(operator*());
 	}
@@ -531,15 +792,17 @@ namespace DOGEngine
 
 #pragma region Hash Functors
 
-	template <typename TKey>
-	inline std::uint32_t HashFunc<TKey>::operator()(const TKey& key) const
+	/**
+	 * 32-bit FNV-1a over a run of bytes. Shared by the
+	 * HashFunc specializations below.
+	 */
+	inline std::uint32_t fnv1aHash(const char* bytes, std::size_t length)
 	{
-		std::uint32_t hashValue = 0;
-
-		const char* byteArray = reinterpret_cast<const char*>(&key);
-		for(std::uint32_t i = 0; i < sizeof(key); ++i)
+		std::uint32_t hashValue = 2166136261u;
+		for(std::size_t i = 0; i < length; ++i)
 		{
-			hashValue += 13 + byteArray[i];
+			hashValue ^= static_cast<std::uint8_t>(bytes[i]);
+			hashValue *= 16777619u;
 		}
 
 		return hashValue;
@@ -547,30 +810,24 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	inline std::uint32_t HashFunc<char*>::operator()(char* const& key) const
+	template <typename TKey>
+	inline std::uint32_t HashFunc<TKey>::operator()(const TKey& key) const
 	{
-		std::uint32_t hashValue = 0;
+		return fnv1aHash(reinterpret_cast<const char*>(&key), sizeof(key));
+	}
 
-		size_t keyLength = strlen(key);
-		for(std::uint32_t i = 0; i < keyLength; ++i)
-		{
-			hashValue += 13 + key[i];
-		}
+	//-----------------------------------------------------------------
 
-		return hashValue;
+	inline std::uint32_t HashFunc<char*>::operator()(char* const& key) const
+	{
+		return fnv1aHash(key, strlen(key));
 	}
 
 	//-----------------------------------------------------------------
 
 	inline std::uint32_t HashFunc<std::string>::operator()(const std::string& key) const
 	{
-		std::uint32_t hashValue = 0;
-		for(char character : key)
-		{
-			hashValue += 13 + character;
-		}
-
-		return hashValue;
+		return fnv1aHash(key.data(), key.size());
 	}
 
 #pragma endregion
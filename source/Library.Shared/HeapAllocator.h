@@ -0,0 +1,86 @@
+#pragma once
+
+#include "pch.h"
+
+namespace DOGEngine
+{
+	/**
+	 * Node allocator that goes straight to the heap for
+	 * every element. Fits the same policy slot as
+	 * SlabAllocator, for containers whose elements come
+	 * and go one at a time over a long life, where holding
+	 * on to whole blocks isn't worth it.
+	 */
+	template <typename T>
+	class HeapAllocator final
+	{
+	public:
+
+		/**
+		 * @brief Constructor.
+		 */
+		HeapAllocator();
+
+		HeapAllocator(const HeapAllocator& other) = delete;
+		HeapAllocator& operator=(const HeapAllocator& other) = delete;
+
+		/**
+		 * @brief Move constructor.
+		 *
+		 * @param other The allocator being moved. Its
+		 *				allocation count is reset.
+		 */
+		HeapAllocator(HeapAllocator&& other);
+
+		/**
+		 * @brief Move assignment.
+		 *
+		 * @param other The allocator being moved. Its
+		 *				allocation count is reset.
+		 *
+		 * @return Returns a reference to this.
+		 */
+		HeapAllocator& operator=(HeapAllocator&& other);
+
+		/**
+		 * @brief Destructor.
+		 */
+		~HeapAllocator();
+
+		/**
+		 * @brief Allocates uninitialized storage for one
+		 *		  T.
+		 *
+		 * @return Returns a pointer to the storage.
+		 */
+		void* allocate();
+
+		/**
+		 * @brief Frees storage. The T in it must already
+		 *		  be destroyed.
+		 *
+		 * @param memory Storage from this allocator.
+		 */
+		void deallocate(void* memory);
+
+		/**
+		 * @brief Does nothing -- every element's storage
+		 *		  was freed when it was deallocated.
+		 */
+		void release();
+
+		/**
+		 * @brief Getter for how many heap allocations this
+		 *		  allocator has made over its lifetime.
+		 *
+		 * @return Returns the number of elements allocated.
+		 */
+		std::uint32_t numHeapAllocations() const;
+
+	private:
+
+		std::uint32_t mNumHeapAllocations;
+	};
+}
+
+#include "HeapAllocator.inl"
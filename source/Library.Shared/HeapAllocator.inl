@@ -0,0 +1,71 @@
+
+namespace DOGEngine
+{
+	template <typename T>
+	HeapAllocator<T>::HeapAllocator() :
+		mNumHeapAllocations(0)
+	{
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename T>
+	HeapAllocator<T>::HeapAllocator(HeapAllocator&& other) :
+		mNumHeapAllocations(other.mNumHeapAllocations)
+	{
+		other.mNumHeapAllocations = 0;
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename T>
+	HeapAllocator<T>& HeapAllocator<T>::operator=(HeapAllocator&& other)
+	{
+		if(this != &other)
+		{
+			mNumHeapAllocations = other.mNumHeapAllocations;
+			other.mNumHeapAllocations = 0;
+		}
+
+		return *this;
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename T>
+	HeapAllocator<T>::~HeapAllocator()
+	{
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename T>
+	void* HeapAllocator<T>::allocate()
+	{
+		++mNumHeapAllocations;
+		return ::operator new(sizeof(T));
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename T>
+	void HeapAllocator<T>::deallocate(void* memory)
+	{
+		::operator delete(memory);
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename T>
+	void HeapAllocator<T>::release()
+	{
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename T>
+	std::uint32_t HeapAllocator<T>::numHeapAllocations() const
+	{
+		return mNumHeapAllocations;
+	}
+}
@@ -13,6 +13,21 @@ void IXmlParseHelper::initialize()
 
 //-----------------------------------------------------------------
 
+void IXmlParseHelper::getElementNames(Vector<Symbol>& names) const
+{
+	UNREFERENCED_PARAMETER(names);
+}
+
+//-----------------------------------------------------------------
+
+bool IXmlParseHelper::acceptsSharedData(const SharedData& sharedData) const
+{
+	UNREFERENCED_PARAMETER(sharedData);
+	return true;
+}
+
+//-----------------------------------------------------------------
+
 bool IXmlParseHelper::charDataHandler(SharedData& sharedData, const char* buffer, int32_t length)
 {
 	UNREFERENCED_PARAMETER(sharedData);
@@ -23,7 +38,7 @@ bool IXmlParseHelper::charDataHandler(SharedData& sharedData, const char* buffer
 
 //-----------------------------------------------------------------
 
-void IXmlParseHelper::requiresAttribute(const AttributeMap& attributes, const string& attributeName, const string& elementName, const string& fileName, bool requiresValue)
+void IXmlParseHelper::requiresAttribute(const XmlAttributes& attributes, const string& attributeName, const string& elementName, const string& fileName, bool requiresValue)
 {
 	// attributes does not have expected attribute name -- throw exception
 	if(!attributes.containsKey(attributeName))
@@ -36,7 +51,7 @@ void IXmlParseHelper::requiresAttribute(const AttributeMap& attributes, const st
 	// if the attribute requires a value (non-empty string) and there is none -- throw exception
 	if(requiresValue)
 	{
-		if(attributes[attributeName] == "")
+		if(attributes[attributeName][0] == '\0')
 		{
 			stringstream exceptionStr;
 			exceptionStr << "Error -- Element " << elementName << " in file " << fileName << " does not set value on required attribute " << attributeName;
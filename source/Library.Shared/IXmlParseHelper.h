@@ -3,6 +3,10 @@
 
 #include "RTTI.h"
 #include "HashMap.h"
+#include "Vector.h"
+#include "Symbol.h"
+#include "XmlAttributes.h"
+#include "XmlElement.h"
 
 namespace DOGEngine
 {
@@ -19,10 +23,6 @@ namespace DOGEngine
 	{
 		RTTI_DECLARATIONS(IXmlParseHelper, RTTI)
 
-	protected:
-
-		typedef DOGEngine::HashMap<std::string, std::string> AttributeMap;
-
 	public:
 
 		IXmlParseHelper(const IXmlParseHelper& other) = delete;
@@ -51,6 +51,36 @@ namespace DOGEngine
 		 */
 		virtual void initialize();
 
+		/**
+		 * @brief Implement to declare the element names this
+		 *		  helper handles. The XmlParseMaster routes each
+		 *		  element's callbacks only to the helpers that
+		 *		  declared its name, and hands each one the
+		 *		  position of the name in this list.
+		 *
+		 * @param names The list the element names are appended to.
+		 *
+		 * @note A helper that declares no names is offered every
+		 *		 element. This is the default.
+		 * @note The master keeps the Symbols' ids for as long as
+		 *		 it lives. Interned names are never released, so
+		 *		 any Symbol will do.
+		 */
+		virtual void getElementNames(Vector<Symbol>& names) const;
+
+		/**
+		 * @brief Implement to say whether this helper works with
+		 *		  the given SharedData. The XmlParseMaster leaves
+		 *		  helpers that don't out of its routing, so the
+		 *		  handlers may cast the SharedData they are given
+		 *		  without checking its type.
+		 *
+		 * @param sharedData The SharedData of the XmlParseMaster.
+		 *
+		 * @return Returns true by default.
+		 */
+		virtual bool acceptsSharedData(const SharedData& sharedData) const;
+
 		/**
 		 * @brief Abstract method. Implement to receive requests
 		 *		  by the XmlParseMaster to handle Xml start-element
@@ -58,14 +88,15 @@ namespace DOGEngine
 		 *
 		 * @param userData Reference to the SharedData (or derived type)
 		 *				   of the XmlParseMaster that started the parse.
-		 * @param name The name of the tag.
-		 * @param attributes Map of attribute key-value pairs as unparsed
+		 * @param element The tag, with the position of its name in
+		 *				  this helper's declared names.
+		 * @param attributes View of attribute key-value pairs as unparsed
 		 *					 strings.
 		 *
 		 * @return Should return true if the parse request is handled.
 		 *		   Otherwise, should return false.
 		 */
-		virtual bool startElementHandler(SharedData& sharedData, const std::string& name, const AttributeMap& attributes) = 0;
+		virtual bool startElementHandler(SharedData& sharedData, const XmlElement& element, const XmlAttributes& attributes) = 0;
 
 		/**
 		 * @brief Abstract method. Implement to receive requests
@@ -74,12 +105,13 @@ namespace DOGEngine
 		 *
 		 * @param userData Reference to the SharedData (or derived tyep)
 		 *				   of the XmlParseMaster that started the parse.
-		 * @param name The name of the tag.
+		 * @param element The tag, with the position of its name in
+		 *				  this helper's declared names.
 		 *
 		 * @return Should return true if the parse request is handled.
 		 *		   Otherwise, should return false.
 		 */
-		virtual bool endElementHandler(SharedData& sharedData, const std::string& name) = 0;
+		virtual bool endElementHandler(SharedData& sharedData, const XmlElement& element) = 0;
 
 		/**
 		 * @brief Implement to receive requests by the XmlParseMaster to hadnle 
@@ -122,6 +154,6 @@ namespace DOGEngine
 		 *			  (requiresValue is 'true'), but the attribute 
 		 *			  value is an empty string ("").
 		 */
-		void requiresAttribute(const AttributeMap& attributes, const std::string& attributeName, const std::string& elementName, const std::string& fileName, bool requiresValue = false);
+		void requiresAttribute(const XmlAttributes& attributes, const std::string& attributeName, const std::string& elementName, const std::string& fileName, bool requiresValue = false);
 	};
 }
@@ -0,0 +1,354 @@
+#include "pch.h"
+#include "JobSystem.h"
+
+#include "ScopeArena.h"
+
+using namespace DOGEngine;
+using namespace std;
+
+const uint32_t JobSystem::sInitialQueueCapacity = 1024;
+
+thread_local JobSystem* JobSystem::sCurrentSystem = nullptr;
+thread_local uint32_t JobSystem::sCurrentWorker = 0;
+
+#pragma region JobGroup
+
+JobSystem::JobGroup::JobGroup(JobSystem& jobSystem) :
+	mJobSystem(&jobSystem),
+	mNumPending(0),
+	mException(),
+	mExceptionMutex()
+{
+}
+
+//-----------------------------------------------------------------
+
+JobSystem::JobGroup::~JobGroup()
+{
+	// queued jobs point back at this group, so they all have to finish first
+	runUntilDone();
+}
+
+//-----------------------------------------------------------------
+
+void JobSystem::JobGroup::submit(const Job& job)
+{
+	++mNumPending;
+	mJobSystem->mNumQueued += 1;
+
+	Worker& worker = *mJobSystem->mWorkers[mJobSystem->pickWorker()];
+	{
+		lock_guard<mutex> lock(worker.mMutex);
+		mJobSystem->push(worker, QueuedJob{ job, this, ScopeArena::current() });
+	}
+
+	mJobSystem->wake(1);
+}
+
+//-----------------------------------------------------------------
+
+void JobSystem::JobGroup::submit(vector<Job>& jobs)
+{
+	uint32_t numJobs = static_cast<uint32_t>(jobs.size());
+	if(numJobs == 0)
+	{
+		return;
+	}
+
+	mNumPending += numJobs;
+	mJobSystem->mNumQueued += numJobs;
+
+	ScopeArena* arena = ScopeArena::current();
+
+	// deal the batch out in contiguous chunks, one lock per worker
+	//		the submitting worker (if any) gets the first chunk so it can start on it right away
+	uint32_t numWorkers = mJobSystem->numWorkers();
+	uint32_t firstWorker = mJobSystem->pickWorker();
+	uint32_t chunkSize = (numJobs + numWorkers - 1) / numWorkers;
+
+	uint32_t jobIndex = 0;
+	for(uint32_t i = 0; i < numWorkers && jobIndex < numJobs; ++i)
+	{
+		Worker& worker = *mJobSystem->mWorkers[(firstWorker + i) % numWorkers];
+		uint32_t chunkEnd = min(jobIndex + chunkSize, numJobs);
+
+		lock_guard<mutex> lock(worker.mMutex);
+		for(; jobIndex < chunkEnd; ++jobIndex)
+		{
+			mJobSystem->push(worker, QueuedJob{ std::move(jobs[jobIndex]), this, arena });
+		}
+	}
+
+	jobs.clear();
+	mJobSystem->wake(numJobs);
+}
+
+//-----------------------------------------------------------------
+
+void JobSystem::JobGroup::wait()
+{
+	runUntilDone();
+
+	exception_ptr exception;
+	{
+		lock_guard<mutex> lock(mExceptionMutex);
+		exception = mException;
+		mException = nullptr;
+	}
+
+	if(exception != nullptr)
+	{
+		rethrow_exception(exception);
+	}
+}
+
+//-----------------------------------------------------------------
+
+bool JobSystem::JobGroup::isDone() const
+{
+	return mNumPending == 0;
+}
+
+//-----------------------------------------------------------------
+
+void JobSystem::JobGroup::runUntilDone()
+{
+	// help out instead of sleeping -- this is what makes waiting from inside a job safe
+	while(!isDone())
+	{
+		if(!mJobSystem->tryRunJob())
+		{
+			this_thread::yield();
+		}
+	}
+}
+
+#pragma endregion
+
+//=================================================================
+
+#pragma region JobSystem
+
+JobSystem::JobSystem(uint32_t numWorkers) :
+	mWorkers(),
+	mNumQueued(0),
+	mNextWorker(0),
+	mIsRunning(true)
+{
+	if(numWorkers == 0)
+	{
+		numWorkers = max(thread::hardware_concurrency(), 1u);
+	}
+
+	// every queue exists before any thread starts, since workers steal from each other
+	for(uint32_t i = 0; i < numWorkers; ++i)
+	{
+		unique_ptr<Worker> worker = make_unique<Worker>();
+		worker->mJobs.resize(sInitialQueueCapacity);
+		worker->mHead = 0;
+		worker->mCount = 0;
+
+		mWorkers.push_back(std::move(worker));
+	}
+
+	for(uint32_t i = 0; i < numWorkers; ++i)
+	{
+		mWorkers[i]->mThread = thread(&JobSystem::workerLoop, this, i);
+	}
+}
+
+//-----------------------------------------------------------------
+
+JobSystem::~JobSystem()
+{
+	{
+		lock_guard<mutex> lock(mSleepMutex);
+		mIsRunning = false;
+	}
+	mSleepCondition.notify_all();
+
+	for(auto& worker : mWorkers)
+	{
+		worker->mThread.join();
+	}
+}
+
+//-----------------------------------------------------------------
+
+JobSystem& JobSystem::instance()
+{
+	static JobSystem sInstance;
+	return sInstance;
+}
+
+//-----------------------------------------------------------------
+
+uint32_t JobSystem::numWorkers() const
+{
+	return static_cast<uint32_t>(mWorkers.size());
+}
+
+//-----------------------------------------------------------------
+
+void JobSystem::workerLoop(uint32_t index)
+{
+	sCurrentSystem = this;
+	sCurrentWorker = index;
+
+	while(mIsRunning)
+	{
+		if(!tryRunJob())
+		{
+			unique_lock<mutex> lock(mSleepMutex);
+			mSleepCondition.wait(lock, [this]{ return mNumQueued > 0 || !mIsRunning; });
+		}
+	}
+}
+
+//-----------------------------------------------------------------
+
+void JobSystem::push(Worker& worker, QueuedJob&& job)
+{
+	uint32_t capacity = static_cast<uint32_t>(worker.mJobs.size());
+	if(worker.mCount == capacity)
+	{
+		// full -- unroll the ring into a buffer twice the size
+		vector<QueuedJob> grownJobs(capacity * 2);
+		for(uint32_t i = 0; i < worker.mCount; ++i)
+		{
+			grownJobs[i] = std::move(worker.mJobs[(worker.mHead + i) % capacity]);
+		}
+
+		worker.mJobs.swap(grownJobs);
+		worker.mHead = 0;
+		capacity *= 2;
+	}
+
+	worker.mJobs[(worker.mHead + worker.mCount) % capacity] = std::move(job);
+	++worker.mCount;
+}
+
+//-----------------------------------------------------------------
+
+bool JobSystem::pop(Worker& worker, QueuedJob& outJob, bool isSteal)
+{
+	if(worker.mCount == 0)
+	{
+		return false;
+	}
+
+	uint32_t capacity = static_cast<uint32_t>(worker.mJobs.size());
+	uint32_t index = isSteal ? worker.mHead : (worker.mHead + worker.mCount - 1) % capacity;
+
+	// moved-from functions are explicitly reset so that captured state is released now
+	outJob = std::move(worker.mJobs[index]);
+	worker.mJobs[index].mJob = nullptr;
+
+	if(isSteal)
+	{
+		worker.mHead = (worker.mHead + 1) % capacity;
+	}
+	--worker.mCount;
+
+	if(worker.mCount == 0)
+	{
+		// a big burst shouldn't pin a big buffer forever
+		worker.mHead = 0;
+		if(capacity > sInitialQueueCapacity)
+		{
+			vector<QueuedJob>(sInitialQueueCapacity).swap(worker.mJobs);
+		}
+	}
+
+	--mNumQueued;
+	return true;
+}
+
+//-----------------------------------------------------------------
+
+bool JobSystem::tryRunJob()
+{
+	uint32_t numWorkers = this->numWorkers();
+	bool isWorker = (sCurrentSystem == this);
+	uint32_t start = isWorker ? sCurrentWorker : mNextWorker.load() % numWorkers;
+
+	QueuedJob job;
+	bool found = false;
+
+	for(uint32_t i = 0; i < numWorkers && !found; ++i)
+	{
+		// a worker takes the newest job from its own queue, and the oldest from anyone else's
+		Worker& worker = *mWorkers[(start + i) % numWorkers];
+		bool isSteal = !isWorker || i != 0;
+
+		lock_guard<mutex> lock(worker.mMutex);
+		found = pop(worker, job, isSteal);
+	}
+
+	if(found)
+	{
+		runJob(job);
+	}
+
+	return found;
+}
+
+//-----------------------------------------------------------------
+
+void JobSystem::runJob(QueuedJob& job)
+{
+	JobGroup* group = job.mGroup;
+
+	// Scopes the job creates come from wherever the submitter's would have
+	ScopeArena::Activation activation(job.mArena);
+
+	try
+	{
+		job.mJob();
+	}
+	catch(...)
+	{
+		lock_guard<mutex> lock(group->mExceptionMutex);
+		if(group->mException == nullptr)
+		{
+			group->mException = current_exception();
+		}
+	}
+
+	// release the job's captures before the group can see it as finished
+	job.mJob = nullptr;
+	--group->mNumPending;
+}
+
+//-----------------------------------------------------------------
+
+void JobSystem::wake(uint32_t numJobs)
+{
+	{
+		// taking the sleep lock orders this with a worker checking the count and going to sleep
+		lock_guard<mutex> lock(mSleepMutex);
+	}
+
+	if(numJobs == 1)
+	{
+		mSleepCondition.notify_one();
+	}
+	else
+	{
+		mSleepCondition.notify_all();
+	}
+}
+
+//-----------------------------------------------------------------
+
+uint32_t JobSystem::pickWorker()
+{
+	if(sCurrentSystem == this)
+	{
+		return sCurrentWorker;
+	}
+
+	return mNextWorker++ % numWorkers();
+}
+
+#pragma endregion
@@ -0,0 +1,237 @@
+#pragma once
+
+#include "pch.h"
+
+namespace DOGEngine
+{
+	class ScopeArena;
+
+	/**
+	 * Persistent pool of worker threads that runs short
+	 * jobs. Sized to the hardware by default.
+	 *
+	 * Each worker owns a job queue. A worker runs its own
+	 * newest job first and, when its queue is empty, steals
+	 * the oldest job from another worker.
+	 *
+	 * Jobs are submitted through a JobGroup, which is the
+	 * join barrier for everything submitted to it. A thread
+	 * waiting on a group runs queued jobs instead of going
+	 * to sleep, so groups may be waited on from inside jobs.
+	 *
+	 * Each job runs with the ScopeArena that was active on
+	 * the thread that submitted it, so the Scopes it creates
+	 * end up in the same place the submitter's would.
+	 */
+	class JobSystem final
+	{
+	public:
+
+		typedef std::function<void()> Job;
+
+		/**
+		 * Set of jobs that can be waited on together. Jobs
+		 * may add more jobs to the group they belong to.
+		 */
+		class JobGroup final
+		{
+			friend class JobSystem;
+		public:
+
+			/**
+			 * @brief Constructor.
+			 *
+			 * @param jobSystem The JobSystem that runs this
+			 *					group's jobs. Defaults to the
+			 *					shared instance.
+			 */
+			explicit JobGroup(JobSystem& jobSystem = JobSystem::instance());
+
+			JobGroup(const JobGroup& other) = delete;
+			JobGroup& operator=(const JobGroup& other) = delete;
+
+			/**
+			 * @brief Destructor. Waits for any outstanding
+			 *		  jobs so none outlive the group.
+			 */
+			~JobGroup();
+
+			/**
+			 * @brief Queues a job on this group.
+			 *
+			 * @param job The job to run.
+			 */
+			void submit(const Job& job);
+
+			/**
+			 * @brief Queues a batch of jobs on this group. The
+			 *		  batch is spread over the workers, taking
+			 *		  each worker's queue lock only once.
+			 *
+			 * @param jobs The jobs to run. The vector is left
+			 *			   empty.
+			 */
+			void submit(std::vector<Job>& jobs);
+
+			/**
+			 * @brief Blocks until every job submitted to this
+			 *		  group has run. The calling thread runs
+			 *		  queued jobs while it waits.
+			 *
+			 * @note If a job threw, the first exception is
+			 *		 rethrown here.
+			 */
+			void wait();
+
+			/**
+			 * @brief Says whether all submitted jobs have run.
+			 *
+			 * @return Returns true if no jobs are pending.
+			 */
+			bool isDone() const;
+
+		private:
+
+			void runUntilDone();
+
+			JobSystem* mJobSystem;
+			std::atomic<std::uint32_t> mNumPending;
+
+			std::exception_ptr mException;
+			std::mutex mExceptionMutex;
+		};
+
+		/**
+		 * @brief Constructor. Starts the worker threads.
+		 *
+		 * @param numWorkers The number of worker threads.
+		 *					 If 0, uses the hardware thread
+		 *					 count.
+		 */
+		explicit JobSystem(std::uint32_t numWorkers = 0);
+
+		JobSystem(const JobSystem& other) = delete;
+		JobSystem& operator=(const JobSystem& other) = delete;
+
+		/**
+		 * @brief Destructor. Joins the worker threads. Any
+		 *		  jobs still queued are dropped.
+		 */
+		~JobSystem();
+
+		/**
+		 * @brief Getter for the shared JobSystem that the
+		 *		  engine submits to. Created on first use.
+		 *
+		 * @return Returns a reference to the shared instance.
+		 */
+		static JobSystem& instance();
+
+		/**
+		 * @brief Getter for the number of worker threads.
+		 *
+		 * @return Returns the worker count.
+		 */
+		std::uint32_t numWorkers() const;
+
+	private:
+
+		struct QueuedJob
+		{
+			Job mJob;
+			JobGroup* mGroup;
+			ScopeArena* mArena;
+		};
+
+		/**
+		 * Ring buffer of jobs guarded by its own lock. The
+		 * owner pops from the back; thieves pop from the front.
+		 */
+		struct Worker
+		{
+			std::mutex mMutex;
+			std::vector<QueuedJob> mJobs;
+			std::uint32_t mHead;
+			std::uint32_t mCount;
+
+			std::thread mThread;
+		};
+
+		/**
+		 * @brief Body of each worker thread. Runs jobs until
+		 *		  the JobSystem shuts down, sleeping whenever
+		 *		  nothing is queued.
+		 *
+		 * @param index The worker's index in mWorkers.
+		 */
+		void workerLoop(std::uint32_t index);
+
+		/**
+		 * @brief Appends a job to the back of a worker's
+		 *		  ring buffer, growing it if it is full.
+		 *		  Expects the worker's lock to be held.
+		 */
+		void push(Worker& worker, QueuedJob&& job);
+
+		/**
+		 * @brief Takes a job from a worker's ring buffer.
+		 *		  Expects the worker's lock to be held.
+		 *
+		 * @param worker The worker whose queue we take from.
+		 * @param outJob Output variable for the job.
+		 * @param isSteal If true, takes the oldest job
+		 *				  (front). Otherwise, takes the
+		 *				  newest job (back).
+		 *
+		 * @return Returns true if a job was taken.
+		 */
+		bool pop(Worker& worker, QueuedJob& outJob, bool isSteal);
+
+		/**
+		 * @brief Runs one queued job on the calling thread.
+		 *		  A worker checks its own queue first, then
+		 *		  steals from the others.
+		 *
+		 * @return Returns true if a job was run.
+		 */
+		bool tryRunJob();
+
+		/**
+		 * @brief Runs a job, records any exception on its
+		 *		  group, then marks it finished.
+		 */
+		void runJob(QueuedJob& job);
+
+		/**
+		 * @brief Wakes enough sleeping workers to take the
+		 *		  jobs that were just queued.
+		 *
+		 * @param numJobs The number of jobs just queued.
+		 */
+		void wake(std::uint32_t numJobs);
+
+		/**
+		 * @brief Getter for the worker queue that a job
+		 *		  submitted from this thread should go to.
+		 *
+		 * @return Returns the calling worker's own index, or
+		 *		   the next worker in round-robin order for
+		 *		   threads outside the pool.
+		 */
+		std::uint32_t pickWorker();
+
+		static const std::uint32_t sInitialQueueCapacity;
+
+		std::vector<std::unique_ptr<Worker>> mWorkers;
+
+		std::atomic<std::uint32_t> mNumQueued;
+		std::atomic<std::uint32_t> mNextWorker;
+		std::atomic<bool> mIsRunning;
+
+		std::mutex mSleepMutex;
+		std::condition_variable mSleepCondition;
+
+		static thread_local JobSystem* sCurrentSystem;
+		static thread_local std::uint32_t sCurrentWorker;
+	};
+}
@@ -0,0 +1,99 @@
+#include "pch.h"
+#include "PendingCreate.h"
+
+#include "Factory.h"
+#include "Entity.h"
+
+using namespace DOGEngine;
+using namespace std;
+
+PendingCreate::PendingCreate() :
+	mPending()
+{
+}
+
+//-----------------------------------------------------------------
+
+PendingCreate::PendingCreate(PendingCreate&& other) :
+	mPending(std::move(other.mPending))
+{
+}
+
+//-----------------------------------------------------------------
+
+PendingCreate& PendingCreate::operator=(PendingCreate&& other)
+{
+	if(this != &other)
+	{
+		mPending = std::move(other.mPending);
+	}
+
+	return *this;
+}
+
+//-----------------------------------------------------------------
+
+PendingCreate::~PendingCreate()
+{
+}
+
+//-----------------------------------------------------------------
+
+void PendingCreate::enqueue(WorldState& worldState, Scope& parent, const string& className, const string& instanceName)
+{
+	// the sequence belongs to the calling update, so it is advanced outside the lock
+	uint32_t sequence = worldState.deferSequence++;
+
+	lock_guard<mutex> lock(mMutex);
+	mPending.push_back(Creation{ &parent, className, instanceName, worldState.sectorIndex, worldState.entityIndex, sequence });
+}
+
+//-----------------------------------------------------------------
+
+void PendingCreate::empty()
+{
+	lock_guard<mutex> lock(mMutex);
+
+	// sector, then entity, then sequence is the order a serial update would have queued them in
+	//		stable, so requests queued outside of World::update keep their queueing order
+	stable_sort(mPending.begin(), mPending.end(), [](const Creation& lhs, const Creation& rhs)
+	{
+		if(lhs.mSectorIndex != rhs.mSectorIndex)
+		{
+			return lhs.mSectorIndex < rhs.mSectorIndex;
+		}
+		if(lhs.mEntityIndex != rhs.mEntityIndex)
+		{
+			return lhs.mEntityIndex < rhs.mEntityIndex;
+		}
+		return lhs.mSequence < rhs.mSequence;
+	});
+
+	for(auto& creation : mPending)
+	{
+		Action* action = Factory<Action>::create(creation.mClassName);
+		if(action != nullptr)
+		{
+			action->setName(creation.mInstanceName);
+			creation.mParent->adopt(Entity::sActionsAttribute, *action);
+		}
+	}
+
+	mPending.clear();
+}
+
+//-----------------------------------------------------------------
+
+void PendingCreate::clear()
+{
+	lock_guard<mutex> lock(mMutex);
+	mPending.clear();
+}
+
+//-----------------------------------------------------------------
+
+uint32_t PendingCreate::size()
+{
+	lock_guard<mutex> lock(mMutex);
+	return static_cast<uint32_t>(mPending.size());
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "Scope.h"
+#include "WorldState.h"
+
+namespace DOGEngine
+{
+	/**
+	 * Queue of Actions waiting to be created at the end
+	 * of the simulation loop's execution. The counterpart
+	 * to PendingDelete.
+	 *
+	 * Requests may be queued from any thread. Each one
+	 * is stamped with where the update was in the World's
+	 * traversal, and the queue is applied in serial
+	 * traversal order no matter which thread queued
+	 * what, so a parallel update builds the same tree as
+	 * a serial one.
+	 */
+	class PendingCreate final
+	{
+	public:
+
+		PendingCreate(const PendingCreate& other) = delete;
+		PendingCreate& operator=(const PendingCreate& other) = delete;
+
+		/**
+		 * @brief Constructor.
+		 */
+		PendingCreate();
+
+		/**
+		 * @brief Move constructor.
+		 *
+		 * @param other The object being moved.
+		 *				It is reset to a default
+		 *				state.
+		 */
+		PendingCreate(PendingCreate&& other);
+
+		/**
+		 * @brief Move assignment.
+		 *
+		 * @param other The object being moved.
+		 *				It is reset to a default
+		 *				state.
+		 *
+		 * @return Returns a reference to this.
+		 */
+		PendingCreate& operator=(PendingCreate&& other);
+
+		/**
+		 * @brief Destructor.
+		 */
+		~PendingCreate();
+
+		/**
+		 * @brief Queues the creation of an Action.
+		 *
+		 * @param worldState State of the update doing the
+		 *					 queueing. Its traversal position
+		 *					 orders the request, and its
+		 *					 sequence counter is advanced.
+		 * @param parent The Scope that will adopt the new
+		 *				 Action into its "actions" attribute.
+		 * @param className The type name of the Action to
+		 *					create.
+		 * @param instanceName The name to give the new Action.
+		 */
+		void enqueue(WorldState& worldState, Scope& parent, const std::string& className, const std::string& instanceName);
+
+		/**
+		 * @brief Empties the queue, creating and adopting
+		 *		  each queued Action in serial traversal
+		 *		  order. Unknown class names are skipped.
+		 *
+		 * @note This should be called at the end of the game
+		 *		 loop each frame, before PendingDelete is
+		 *		 emptied (a parent may be pending delete).
+		 */
+		void empty();
+
+		/**
+		 * @brief Clears the queue. Nothing is created.
+		 */
+		void clear();
+
+		/**
+		 * @brief Says how many creations are currently
+		 *		  queued.
+		 *
+		 * @return Returns the number of queued creations.
+		 */
+		std::uint32_t size();
+
+	private:
+
+		struct Creation
+		{
+			Scope* mParent;
+			std::string mClassName;
+			std::string mInstanceName;
+
+			std::uint32_t mSectorIndex;
+			std::uint32_t mEntityIndex;
+			std::uint32_t mSequence;
+		};
+
+		std::vector<Creation> mPending;
+		std::mutex mMutex;
+	};
+}
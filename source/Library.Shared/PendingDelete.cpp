@@ -8,15 +8,20 @@ using namespace DOGEngine;
 using namespace std;
 
 PendingDelete::PendingDelete() :
-	mPending()
+	mPending(),
+	mQueued(),
+	mMayHaveDescendants(false)
 {
 }
 
 //-----------------------------------------------------------------
 
 PendingDelete::PendingDelete(PendingDelete&& other) :
-	mPending(std::move(other.mPending))
+	mPending(std::move(other.mPending)),
+	mQueued(std::move(other.mQueued)),
+	mMayHaveDescendants(other.mMayHaveDescendants)
 {
+	other.mMayHaveDescendants = false;
 }
 
 //-----------------------------------------------------------------
@@ -26,6 +31,10 @@ PendingDelete& PendingDelete::operator=(PendingDelete&& other)
 	if(this != &other)
 	{
 		mPending = std::move(other.mPending);
+		mQueued = std::move(other.mQueued);
+		mMayHaveDescendants = other.mMayHaveDescendants;
+
+		other.mMayHaveDescendants = false;
 	}
 
 	return *this;
@@ -46,24 +55,12 @@ void PendingDelete::enqueue(Scope& scope)
 	// can only insert non-World Scopes and those not already pending delete
 	if(!scope.Is(World::TypeIdClass()) && !isPendingDelete(scope))
 	{
-		// partition off the inserted elements that are children of incoming scope
-		uint32_t last = mPending.size();
-		for(uint32_t start = 0; start < last; ++start)
-		{
-			while(mPending[start]->isAncestor(scope) && start != last)
-			{
-				std::swap(mPending[start], mPending[--last]);
-			}
-		}
-
-		// remove partitioned children of incoming scope
-		while(last < mPending.size())
-		{
-			mPending.popBack();
-		}
+		// children of the incoming scope that are already queued are dropped in one pass, the next time the queue is read
+		mMayHaveDescendants = mMayHaveDescendants || !mPending.isEmpty();
 
 		// insert scope
 		mPending.pushBack(&scope);
+		mQueued.insert(make_pair(&scope, true));
 	}
 }
 
@@ -74,6 +71,8 @@ void PendingDelete::empty()
 	lock_guard<recursive_mutex> lock(mMutex);
 
 	// delete objects, then clear
+	//		a queued descendant would already be gone by the time its turn came
+	removeQueuedDescendants();
 	for(auto& scope : mPending)
 	{
 		delete scope;
@@ -87,6 +86,8 @@ void PendingDelete::clear()
 {
 	lock_guard<recursive_mutex> lock(mMutex);
 	mPending.clear();
+	mQueued.clear();
+	mMayHaveDescendants = false;
 }
 
 //-----------------------------------------------------------------
@@ -95,14 +96,44 @@ bool PendingDelete::isPendingDelete(Scope& scope)
 {
 	lock_guard<recursive_mutex> lock(mMutex);
 
+	// scope has ancestor in queue (could include itself)
+	return mQueued.containsKey(&scope) || hasQueuedAncestor(scope);
+}
+
+//-----------------------------------------------------------------
+
+uint32_t PendingDelete::size()
+{
+	lock_guard<recursive_mutex> lock(mMutex);
+	removeQueuedDescendants();
+	return mPending.size();
+}
+
+//-----------------------------------------------------------------
+
+bool PendingDelete::hasQueuedAncestor(Scope& scope)
+{
 	bool result = false;
-	for(uint32_t i = 0; i < mPending.size(); ++i)
+	if(mPending.size() < scope.getDepth())
+	{
+		for(auto& queued : mPending)
+		{
+			if(queued != &scope && scope.isAncestor(*queued))
+			{
+				result = true;
+				break;
+			}
+		}
+	}
+	else
 	{
-		// scope has ancestor in queue (could include itself)
-		if(scope.isAncestor(*mPending[i]))
+		for(Scope* ancestor = scope.getParent(); ancestor != nullptr; ancestor = ancestor->getParent())
 		{
-			result = true;
-			break;
+			if(mQueued.containsKey(ancestor))
+			{
+				result = true;
+				break;
+			}
 		}
 	}
 
@@ -111,8 +142,30 @@ bool PendingDelete::isPendingDelete(Scope& scope)
 
 //-----------------------------------------------------------------
 
-uint32_t PendingDelete::size()
+void PendingDelete::removeQueuedDescendants()
 {
-	lock_guard<recursive_mutex> lock(mMutex);
-	return mPending.size();
+	if(mMayHaveDescendants)
+	{
+		// the topmost queued Scope on any chain always stays, so dropping entries as we go can't hide another one
+		uint32_t numKept = 0;
+		for(uint32_t i = 0; i < mPending.size(); ++i)
+		{
+			Scope* scope = mPending[i];
+			if(hasQueuedAncestor(*scope))
+			{
+				mQueued.remove(scope);
+			}
+			else
+			{
+				mPending[numKept++] = scope;
+			}
+		}
+
+		while(mPending.size() > numKept)
+		{
+			mPending.popBack();
+		}
+
+		mMayHaveDescendants = false;
+	}
 }
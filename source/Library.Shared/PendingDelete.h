@@ -3,6 +3,7 @@
 
 #include "Scope.h"
 #include "Vector.h"
+#include "HashMap.h"
 
 namespace DOGEngine
 {
@@ -61,6 +62,10 @@ namespace DOGEngine
 		 * @note Likewise, if the incoming Scope has descendants
 		 *		 on the queue, those descendants are removed (as
 		 *		 they will be deleted along with their ancestor).
+		 *		 They are removed the next time the queue is
+		 *		 sized or emptied, so enqueueing stays at most
+		 *		 proportional to the Scope's depth rather than
+		 *		 the length of the queue.
 		 */
 		void enqueue(Scope& scope);
 
@@ -94,6 +99,8 @@ namespace DOGEngine
 		 *		 to be considered "pending deletion". A Scope is
 		 *		 said to be "pending delete" if it or one of its
 		 *		 ancestors is inserted to the queue.
+		 * @note Proportional to the smaller of the Scope's depth
+		 *		 and the length of the queue.
 		 */
 		bool isPendingDelete(Scope& scope);
 
@@ -107,7 +114,32 @@ namespace DOGEngine
 
 	private:
 
+		typedef HashMap<Scope*, bool> ScopeSet;
+
+		/**
+		 * @brief Says whether a strict ancestor of the given
+		 *		  Scope is on the queue.
+		 *
+		 * @param scope The Scope being checked.
+		 *
+		 * @return Returns true if a parent, grandparent, etc.
+		 *		   of the Scope is queued.
+		 *
+		 * @note Looks up each ancestor in the queue, or tests
+		 *		 each queued Scope for ancestry (which is constant
+		 *		 time), whichever list is shorter.
+		 */
+		bool hasQueuedAncestor(Scope& scope);
+
+		/**
+		 * @brief Drops queued Scopes that a queued ancestor will
+		 *		  delete anyway.
+		 */
+		void removeQueuedDescendants();
+
 		Vector<Scope*> mPending;
+		ScopeSet mQueued;
+		bool mMayHaveDescendants;
 		std::recursive_mutex mMutex;
 	};
 }
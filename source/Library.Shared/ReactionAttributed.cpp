@@ -15,14 +15,11 @@ const string ReactionAttributed::sSubtypeAttribute = "subtype";
 ReactionAttributed::ReactionAttributed(const string& name) :
 	Reaction(name)
 {
-	if(!areSignaturesInitialized())
-	{
-		initSignatures();
-	}
+	initSignaturesOnce();
 	populate();
 
-	// subscribe this object to events with attributed event args
-	Event<EventArgs>::subscribe(*this);
+	// subscribe this object to events with attributed event args, routed by its subtypes
+	resubscribe();
 }
 
 //-----------------------------------------------------------------
@@ -31,6 +28,7 @@ ReactionAttributed::ReactionAttributed(const ReactionAttributed& other) :
 	Reaction(other)
 {
 	updateExternalStorage();
+	resubscribe();
 }
 
 
@@ -42,6 +40,7 @@ ReactionAttributed& ReactionAttributed::operator=(const ReactionAttributed& othe
 	{
 		ActionList::operator=(other);
 		updateExternalStorage();
+		resubscribe();
 	}
 
 	return *this;
@@ -71,6 +70,10 @@ ReactionAttributed& ReactionAttributed::operator=(ReactionAttributed&& other)
 	if(this != &other)
 	{
 		ActionList::operator=(std::move(other));
+
+		// other was reset to the default subtype, so both objects change routes
+		resubscribe();
+		other.resubscribe();
 	}
 
 	return *this;
@@ -95,10 +98,12 @@ void ReactionAttributed::notify(const EventPublisher& e)
 	// validate the type and subtype of the event
 	if(const Event<EventArgs>* eCast = e.As<Event<EventArgs>>())
 	{
-		EventArgs args = eCast->message();
+		// the payload is shared by every subscriber, so it's read in place rather than copied
+		const EventArgs& args = eCast->message();
 		if(isSubtype(args.getSubtype()))
 		{
 			// copy data from args to this object
+			//		heap arrays are shared with the event, and small ones are assigned over in place
 			for(auto& iter : args)
 			{
 				append((*iter).first) = (*iter).second;
@@ -116,13 +121,22 @@ void ReactionAttributed::notify(const EventPublisher& e)
 void ReactionAttributed::addSubtype(const string& subtype)
 {
 	(*this)[sSubtypeAttribute].pushBack(subtype);
+	Event<EventArgs>::subscribe(*this, subtype);
 }
 
 //-----------------------------------------------------------------
 
 bool ReactionAttributed::removeSubtype(const string& subtype)
 {
-	return (*this)[sSubtypeAttribute].remove(subtype);
+	bool result = (*this)[sSubtypeAttribute].remove(subtype);
+
+	// the subtypes Datum may hold duplicates, so only stop routing once the last one is gone
+	if(result && !isSubtype(subtype))
+	{
+		Event<EventArgs>::unsubscribe(*this, subtype);
+	}
+
+	return result;
 }
 
 //-----------------------------------------------------------------
@@ -175,3 +189,16 @@ void ReactionAttributed::updateExternalStorage()
 {
 	ActionList::updateExternalStorage();
 }
+
+//-----------------------------------------------------------------
+
+void ReactionAttributed::resubscribe()
+{
+	Event<EventArgs>::unsubscribe(*this);
+
+	const Datum& subtypes = getSubtypes();
+	for(uint32_t i = 0; i < subtypes.size(); ++i)
+	{
+		Event<EventArgs>::subscribe(*this, subtypes.get<string>(i));
+	}
+}
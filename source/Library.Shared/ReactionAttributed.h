@@ -10,8 +10,10 @@ namespace DOGEngine
 	 * notifications and executes child Actions.
 	 *
 	 * ReactionAttributed has an array of event subtypes.
-	 * The subtype of incoming events is validated against
-	 * this list.
+	 * It subscribes to Event<EventArgs> once per subtype,
+	 * so it is only notified of events it handles. The
+	 * subtype of incoming events is still validated
+	 * against this list.
 	 *
 	 * Child actions are executed in order if the list
 	 * of handleable subtypes contains the subtype of
@@ -91,7 +93,8 @@ namespace DOGEngine
 
 		/**
 		 * @brief Adds a new event subtype to this object's
-		 *		  list of subtypes.
+		 *		  list of subtypes, and subscribes to events
+		 *		  of that subtype.
 		 *
 		 * @param subtype The subtype being added.
 		 */
@@ -99,7 +102,9 @@ namespace DOGEngine
 
 		/**
 		 * @brief Removes a handled event subtype from
-		 *		  this object's list of subtypes.
+		 *		  this object's list of subtypes. Stops
+		 *		  receiving events of that subtype once
+		 *		  no copies of it are left in the list.
 		 *
 		 * @param subtype The subtype being removed.
 		 *
@@ -129,6 +134,15 @@ namespace DOGEngine
 		 */
 		bool isSubtype(const std::string& subtype) const;
 
+		/**
+		 * @brief Replaces this object's Event<EventArgs>
+		 *		  subscriptions with one per subtype in
+		 *		  its list of subtypes. Call after writing
+		 *		  to the subtypes Datum directly, as the
+		 *		  Xml parse does for subtype fields.
+		 */
+		void resubscribe();
+
 	protected:
 
 		/**
@@ -2,14 +2,21 @@
 #pragma once
 
 #include "pch.h"
+#include "SlabAllocator.h"
+#include "HeapAllocator.h"
 
 namespace DOGEngine
 {
 	/**
 	 * Templated container class. Implements a singly-linked
 	 * list to store a dynamically-sized list of data.
+	 *
+	 * Nodes come from the TAllocator policy, which by default
+	 * carves them out of contiguous blocks owned by the list
+	 * (see SlabAllocator). Use HeapAllocator to get one heap
+	 * allocation per node instead.
 	 */
-	template <typename T>
+	template <typename T, template <typename> class TAllocator = SlabAllocator>
 	class SList final
 	{
 
@@ -326,6 +333,8 @@ namespace DOGEngine
 		 *		 the elements of the list, NOT the
 		 *		 pointers that those elements may be
 		 *		 storing.
+		 * @note Also frees the list's node blocks. Removing
+		 *		 elements any other way keeps them for reuse.
 		 */
 		void clear();
 
@@ -346,6 +355,14 @@ namespace DOGEngine
 		 */
 		bool isEmpty() const;
 
+		/**
+		 * @brief Getter for how many heap allocations this
+		 *		  list's allocator has made for its nodes.
+		 *
+		 * @return Returns the allocator's lifetime count.
+		 */
+		std::uint32_t numHeapAllocations() const;
+
 		/**
 		 * @brief Gets an Iterator for the front
 		 *		  of the list.
@@ -465,10 +482,31 @@ namespace DOGEngine
 		 */
 		void performDeepCopy(const SList& other);
 
+		/**
+		 * @brief Constructs a Node in storage from the
+		 *		  allocator.
+		 *
+		 * @param data The data the Node stores.
+		 * @param next The next Node in the list.
+		 *
+		 * @return Returns the new Node.
+		 */
+		Node* createNode(const T& data, Node* next = nullptr);
+
+		/**
+		 * @brief Destroys a Node and hands its storage
+		 *		  back to the allocator.
+		 *
+		 * @param node The Node being destroyed.
+		 */
+		void destroyNode(Node* node);
+
 		std::uint32_t mCount;
 
 		Node* mFront;
 		Node* mBack;
+
+		TAllocator<Node> mAllocator;
 	};
 }
 
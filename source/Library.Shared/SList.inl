@@ -4,29 +4,31 @@ namespace DOGEngine
 
 #pragma region SList
 
-	template <typename T>
-	SList<T>::SList() :
+	template <typename T, template <typename> class TAllocator>
+	SList<T, TAllocator>::SList() :
 		mCount(0),
 		mFront(nullptr),
-		mBack(nullptr)
+		mBack(nullptr),
+		mAllocator()
 	{
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	SList<T>::SList(const SList& other) :
+	template <typename T, template <typename> class TAllocator>
+	SList<T, TAllocator>::SList(const SList& other) :
 		mCount(0),
 		mFront(nullptr),
-		mBack(nullptr)
+		mBack(nullptr),
+		mAllocator()
 	{
 		performDeepCopy(other);
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	SList<T>& SList<T>::operator=(const SList& other)
+	template <typename T, template <typename> class TAllocator>
+	SList<T, TAllocator>& SList<T, TAllocator>::operator=(const SList& other)
 	{
 		// if not a self-assignment, we can actually deepcopy
 		if(this != &other)
@@ -41,11 +43,12 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	SList<T>::SList(SList&& other) :
+	template <typename T, template <typename> class TAllocator>
+	SList<T, TAllocator>::SList(SList&& other) :
 		mCount(other.mCount),
 		mFront(other.mFront),
-		mBack(other.mBack)
+		mBack(other.mBack),
+		mAllocator(std::move(other.mAllocator))
 	{
 		other.mCount = 0;
 		other.mFront = nullptr;
@@ -54,16 +57,18 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	SList<T>& SList<T>::operator=(SList&& other)
+	template <typename T, template <typename> class TAllocator>
+	SList<T, TAllocator>& SList<T, TAllocator>::operator=(SList&& other)
 	{
 		if(&other != this)
 		{
 			clear();
 
+			// the nodes live in other's allocator, so it comes along with them
 			mCount = other.mCount;
 			mFront = other.mFront;
 			mBack = other.mBack;
+			mAllocator = std::move(other.mAllocator);
 
 			other.mCount = 0;
 			other.mFront = nullptr;
@@ -75,8 +80,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	SList<T>::~SList()
+	template <typename T, template <typename> class TAllocator>
+	SList<T, TAllocator>::~SList()
 	{
 		// we need to deallocate all Nodes that this list may contain
 		clear();
@@ -84,17 +89,17 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	typename SList<T>::Iterator SList<T>::pushFront(const T& data)
+	template <typename T, template <typename> class TAllocator>
+	typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::pushFront(const T& data)
 	{
 		if(isEmpty())
 		{
-			mFront = new Node(data);
+			mFront = createNode(data);
 			mBack = mFront;
 		}
 		else
 		{
-			mFront = new Node(data, mFront);
+			mFront = createNode(data, mFront);
 		}
 
 		mCount++;
@@ -104,15 +109,15 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	void SList<T>::popFront()
+	template <typename T, template <typename> class TAllocator>
+	void SList<T, TAllocator>::popFront()
 	{
 		if(!isEmpty())
 		{
 			// list is not empty, can remove element
 			Node* oldFront = mFront;
 			mFront = oldFront->mNext;
-			delete oldFront;
+			destroyNode(oldFront);
 
 			mCount--;
 
@@ -126,8 +131,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	T& SList<T>::front()
+	template <typename T, template <typename> class TAllocator>
+	T& SList<T, TAllocator>::front()
 	{
 		if(isEmpty())
 		{
@@ -139,8 +144,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	const T& SList<T>::front() const
+	template <typename T, template <typename> class TAllocator>
+	const T& SList<T, TAllocator>::front() const
 	{
 		if(isEmpty())
 		{
@@ -152,17 +157,17 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	typename SList<T>::Iterator SList<T>::pushBack(const T& data)
+	template <typename T, template <typename> class TAllocator>
+	typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::pushBack(const T& data)
 	{
 		if(isEmpty())
 		{
-			mBack = new Node(data);
+			mBack = createNode(data);
 			mFront = mBack;
 		}
 		else
 		{
-			mBack->mNext = new Node(data);
+			mBack->mNext = createNode(data);
 			mBack = mBack->mNext;
 		}
 
@@ -173,8 +178,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	T& SList<T>::back()
+	template <typename T, template <typename> class TAllocator>
+	T& SList<T, TAllocator>::back()
 	{
 		if(isEmpty())
 		{
@@ -186,8 +191,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	const T& SList<T>::back() const
+	template <typename T, template <typename> class TAllocator>
+	const T& SList<T, TAllocator>::back() const
 	{
 		if(isEmpty())
 		{
@@ -199,36 +204,47 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	void SList<T>::clear()
+	template <typename T, template <typename> class TAllocator>
+	void SList<T, TAllocator>::clear()
 	{
 		while(!isEmpty())
 		{
 			// remove elements until list is empty
 			popFront();
 		}
+
+		// popFront keeps its blocks for the next push, but a clear hands them back
+		mAllocator.release();
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	std::uint32_t SList<T>::size() const
+	template <typename T, template <typename> class TAllocator>
+	std::uint32_t SList<T, TAllocator>::size() const
 	{
 		return mCount;
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	bool SList<T>::isEmpty() const
+	template <typename T, template <typename> class TAllocator>
+	bool SList<T, TAllocator>::isEmpty() const
 	{
 		return mCount == 0;
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	typename SList<T>::Iterator SList<T>::begin()
+	template <typename T, template <typename> class TAllocator>
+	std::uint32_t SList<T, TAllocator>::numHeapAllocations() const
+	{
+		return mAllocator.numHeapAllocations();
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename T, template <typename> class TAllocator>
+	typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::begin()
 	{
 		// begin is an Iterator belonging to this list and pointing to mFront
 		//		if the list is empty, mFront is null and begin == end
@@ -237,8 +253,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	typename const SList<T>::Iterator SList<T>::begin() const
+	template <typename T, template <typename> class TAllocator>
+	typename const SList<T, TAllocator>::Iterator SList<T, TAllocator>::begin() const
 	{
 		// begin is an Iterator belonging to this list and pointing to mFront
 		//		if the list is empty, mFront is null and begin == end
@@ -247,8 +263,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	typename SList<T>::Iterator SList<T>::end()
+	template <typename T, template <typename> class TAllocator>
+	typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::end()
 	{
 		// end is an Iterator belonging to this list and pointing to no Node
 		return Iterator(this, nullptr);
@@ -256,8 +272,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	typename const SList<T>::Iterator SList<T>::end() const
+	template <typename T, template <typename> class TAllocator>
+	typename const SList<T, TAllocator>::Iterator SList<T, TAllocator>::end() const
 	{
 		// end is an Iterator belonging to this list and pointing to no Node
 		return Iterator(this, nullptr);
@@ -265,8 +281,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	typename SList<T>::Iterator SList<T>::insertAfter(typename const SList<T>::Iterator& iter, const T& data)
+	template <typename T, template <typename> class TAllocator>
+	typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::insertAfter(typename const SList<T, TAllocator>::Iterator& iter, const T& data)
 	{
 		if(iter.mOwner != this)
 		{
@@ -282,7 +298,7 @@ namespace DOGEngine
 		else
 		{
 			// otherwise, we create a new Node after the given Iterator
-			iter.mNode->mNext = new Node(data, iter.mNode->mNext);
+			iter.mNode->mNext = createNode(data, iter.mNode->mNext);
 			mCount++;
 
 			returnIter = Iterator(this, iter.mNode->mNext);
@@ -293,12 +309,12 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	typename SList<T>::Iterator SList<T>::find(const T& data)
+	template <typename T, template <typename> class TAllocator>
+	typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::find(const T& data)
 	{
-		SList<T>::Iterator iter;
+		SList<T, TAllocator>::Iterator iter;
 
-		SList<T>::Iterator endIter = end();
+		SList<T, TAllocator>::Iterator endIter = end();
 		for(iter = begin(); iter != endIter; ++iter)
 		{
 			// we can break and return the current Iterator when we find a Node with matching data
@@ -314,12 +330,12 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	typename const SList<T>::Iterator SList<T>::find(const T& data) const
+	template <typename T, template <typename> class TAllocator>
+	typename const SList<T, TAllocator>::Iterator SList<T, TAllocator>::find(const T& data) const
 	{
-		SList<T>::Iterator iter;
+		SList<T, TAllocator>::Iterator iter;
 
-		SList<T>::Iterator endIter = end();
+		SList<T, TAllocator>::Iterator endIter = end();
 		for(iter = begin(); iter != endIter; ++iter)
 		{
 			// we can break and return the current Iterator when we find a Node with matching data
@@ -335,8 +351,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	bool SList<T>::remove(const T& data)
+	template <typename T, template <typename> class TAllocator>
+	bool SList<T, TAllocator>::remove(const T& data)
 	{	
 		Iterator iter = find(data);
 		return remove(iter);
@@ -344,8 +360,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	bool SList<T>::remove(typename SList<T>::Iterator& iter)
+	template <typename T, template <typename> class TAllocator>
+	bool SList<T, TAllocator>::remove(typename SList<T, TAllocator>::Iterator& iter)
 	{
 		if(iter.mOwner != this)
 		{
@@ -358,7 +374,7 @@ namespace DOGEngine
 			if(mCount == 1)
 			{
 				// removing the only object from the list
-				delete mFront;
+				destroyNode(mFront);
 				mFront = mBack = nullptr;
 			}
 			else
@@ -372,7 +388,7 @@ namespace DOGEngine
 					for(nextNode = mFront; nextNode->mNext != currNode; nextNode = nextNode->mNext);
 					nextNode->mNext = nullptr;
 					mBack = nextNode;
-					delete currNode;
+					destroyNode(currNode);
 				}
 
 				// removing any other node
@@ -387,7 +403,7 @@ namespace DOGEngine
 					// replace data in current, delete next
 					currNode->mData = nextNode->mData;
 					currNode->mNext = nextNode->mNext;
-					delete nextNode;
+					destroyNode(nextNode);
 				}
 			}
 
@@ -400,8 +416,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	void SList<T>::performDeepCopy(const SList& other)
+	template <typename T, template <typename> class TAllocator>
+	void SList<T, TAllocator>::performDeepCopy(const SList& other)
 	{
 		for(T& data : other)
 		{
@@ -411,14 +427,40 @@ namespace DOGEngine
 		}
 	}
 
+	//-----------------------------------------------------------------
+
+	template <typename T, template <typename> class TAllocator>
+	typename SList<T, TAllocator>::Node* SList<T, TAllocator>::createNode(const T& data, Node* next)
+	{
+		void* memory = mAllocator.allocate();
+		try
+		{
+			return new(memory) Node(data, next);
+		}
+		catch(...)
+		{
+			mAllocator.deallocate(memory);
+			throw;
+		}
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename T, template <typename> class TAllocator>
+	void SList<T, TAllocator>::destroyNode(Node* node)
+	{
+		node->~Node();
+		mAllocator.deallocate(node);
+	}
+
 #pragma endregion
 
 	//=================================================================
 
 #pragma region SList::Iterator
 
-	template <typename T>
-	SList<T>::Iterator::Iterator() :
+	template <typename T, template <typename> class TAllocator>
+	SList<T, TAllocator>::Iterator::Iterator() :
 		mOwner(nullptr),
 		mNode(nullptr)
 	{
@@ -426,8 +468,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	SList<T>::Iterator::Iterator(const SList* owner, Node* node) :
+	template <typename T, template <typename> class TAllocator>
+	SList<T, TAllocator>::Iterator::Iterator(const SList* owner, Node* node) :
 		mOwner(owner),
 		mNode(node)
 	{
@@ -435,8 +477,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	SList<T>::Iterator::Iterator(const Iterator& other) :
+	template <typename T, template <typename> class TAllocator>
+	SList<T, TAllocator>::Iterator::Iterator(const Iterator& other) :
 		mOwner(other.mOwner),
 		mNode(other.mNode)
 	{
@@ -444,15 +486,15 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	SList<T>::Iterator::~Iterator()
+	template <typename T, template <typename> class TAllocator>
+	SList<T, TAllocator>::Iterator::~Iterator()
 	{
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	typename SList<T>::Iterator& SList<T>::Iterator::operator=(const Iterator& other)
+	template <typename T, template <typename> class TAllocator>
+	typename SList<T, TAllocator>::Iterator& SList<T, TAllocator>::Iterator::operator=(const Iterator& other)
 	{
 		if(this != &other)
 		{
@@ -466,8 +508,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	bool SList<T>::Iterator::operator==(const Iterator& other) const
+	template <typename T, template <typename> class TAllocator>
+	bool SList<T, TAllocator>::Iterator::operator==(const Iterator& other) const
 	{
 		// the Iterators are the same if the owners AND the nodes are the same
 		return mOwner == other.mOwner && mNode == other.mNode;
@@ -475,8 +517,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	bool SList<T>::Iterator::operator!=(const Iterator& other) const
+	template <typename T, template <typename> class TAllocator>
+	bool SList<T, TAllocator>::Iterator::operator!=(const Iterator& other) const
 	{
 		// the Iterators are different if the owners are different OR the nodes are different
 		return mOwner != other.mOwner || mNode != other.mNode;
@@ -484,8 +526,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	typename SList<T>::Iterator& SList<T>::Iterator::operator++()
+	template <typename T, template <typename> class TAllocator>
+	typename SList<T, TAllocator>::Iterator& SList<T, TAllocator>::Iterator::operator++()
 	{
 		if(mNode != nullptr)
 		{
@@ -497,8 +539,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	typename SList<T>::Iterator SList<T>::Iterator::operator++(int)
+	template <typename T, template <typename> class TAllocator>
+	typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::Iterator::operator++(int)
 	{
 		// postincrement operator saves a copy of the object before incrementing
 		Iterator savedIterator = *this;
@@ -514,8 +556,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	T& SList<T>::Iterator::operator*()
+	template <typename T, template <typename> class TAllocator>
+	T& SList<T, TAllocator>::Iterator::operator*()
 	{
 		if(mNode == nullptr)
 		{
@@ -527,8 +569,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	const T& SList<T>::Iterator::operator*() const
+	template <typename T, template <typename> class TAllocator>
+	const T& SList<T, TAllocator>::Iterator::operator*() const
 	{
 		if(mNode == nullptr)
 		{
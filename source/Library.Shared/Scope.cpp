@@ -9,11 +9,39 @@ RTTI_DEFINITIONS(Scope)
 
 uint32_t Scope::sNumTabs = 0;
 
+const uint32_t Scope::sMaxSymbolScan = 16;
+
+const uint64_t Scope::sVersionBlockSize = 1 << 16;
+atomic<uint64_t> Scope::sNextVersionBlock(1);
+
+#pragma region Binding
+
+Scope::Binding::Binding() :
+	mOrigin(nullptr),
+	mOwner(nullptr),
+	mDatum(nullptr),
+	mKey(),
+	mVersion(0)
+{
+}
+
+#pragma endregion
+
+//=================================================================
+
 Scope::Scope(uint32_t size) :
 	mMap(),
 	mVector(size),
-	mParent(nullptr)
+	mSymbols(size),
+	mNumUnresolved(0),
+	mParent(nullptr),
+	mParentEntry(nullptr),
+	mParentIndex(0),
+	mDepth(0),
+	mDeepAncestors(0),
+	mStructureVersion(nextVersion())
 {
+	mMap.reserve(size);
 }
 
 //-----------------------------------------------------------------
@@ -66,13 +94,16 @@ Scope& Scope::operator=(Scope&& other)
 		// other's parent adopts this object using other's name, then detach other from parent
 		if(other.mParent != nullptr)
 		{
-			other.mParent->adopt(other.mParent->findName(&other), *this);
+			other.mParent->attach(*other.mParentEntry, *this);
 			other.orphan();
 		}
 
 		// move chains and inserted pair pointers from other into this
 		mVector = std::move(other.mVector);
 		mMap = std::move(other.mMap);
+		mSymbols = std::move(other.mSymbols);
+		mNumUnresolved = other.mNumUnresolved;
+		other.mNumUnresolved = 0;
 
 		// all of other's former child tables have to be reparented to this
 		for(auto& kvPair : mVector)
@@ -86,6 +117,13 @@ Scope& Scope::operator=(Scope&& other)
 				}
 			}
 		}
+
+		// then the whole tree's ancestry is set in one pass, from the top
+		updateAncestry();
+
+		// Bindings into either tree may have resolved to the Datums that just moved
+		invalidateBindings();
+		other.invalidateBindings();
 	}
 
 	return *this;
@@ -96,12 +134,73 @@ Scope& Scope::operator=(Scope&& other)
 Scope::~Scope()
 {
 	// have to detach from parent in case it's not being destroyed too
-	orphan();
+	//		our subtree goes with us, so its ancestry is never recomputed
+	if(mParent != nullptr)
+	{
+		detach();
+
+		// with no ancestors left, clearing only invalidates this Scope
+		mDepth = 0;
+	}
 	clear();
 }
 
 //-----------------------------------------------------------------
 
+void* Scope::operator new(size_t size)
+{
+	static_assert(sizeof(ArenaHeader) <= ScopeArena::sAlignment, "The arena header must fit in front of the Scope!");
+
+	// a header in front of each Scope remembers which arena, if any, it came from
+	ScopeArena* arena = ScopeArena::current();
+	size_t blockSize = size + ScopeArena::sAlignment;
+
+	void* block = (arena != nullptr) ? arena->allocate(blockSize) : ::operator new(blockSize);
+	void* memory = static_cast<char*>(block) + ScopeArena::sAlignment;
+
+	ArenaHeader* header = static_cast<ArenaHeader*>(block);
+	header->mArena = arena;
+	header->mSlot = (arena != nullptr) ? arena->track(*static_cast<Scope*>(memory)) : 0;
+
+	return memory;
+}
+
+//-----------------------------------------------------------------
+
+void Scope::operator delete(void* memory)
+{
+	if(memory != nullptr)
+	{
+		void* block = static_cast<char*>(memory) - ScopeArena::sAlignment;
+		ArenaHeader* header = static_cast<ArenaHeader*>(block);
+
+		// arena storage is only ever freed all at once, by the arena
+		if(header->mArena == nullptr)
+		{
+			::operator delete(block);
+		}
+		else
+		{
+			header->mArena->forget(header->mSlot);
+		}
+	}
+}
+
+//-----------------------------------------------------------------
+
+void* Scope::operator new(size_t, void* memory)
+{
+	return memory;
+}
+
+//-----------------------------------------------------------------
+
+void Scope::operator delete(void*, void*)
+{
+}
+
+//-----------------------------------------------------------------
+
 bool Scope::Equals(const RTTI* rhs) const
 {
 	if(this == rhs)
@@ -157,6 +256,13 @@ Datum& Scope::operator[](const string& key)
 
 //-----------------------------------------------------------------
 
+Datum& Scope::operator[](const Symbol& key)
+{
+	return append(key);
+}
+
+//-----------------------------------------------------------------
+
 Datum& Scope::operator[](const uint32_t index)
 {
 	return mVector[index]->second;
@@ -188,6 +294,34 @@ Datum* Scope::find(const string& key) const
 
 //-----------------------------------------------------------------
 
+Datum* Scope::find(const Symbol& key) const
+{
+	if(!key.isValid())
+	{
+		return nullptr;
+	}
+
+	// prescribed attributes are appended first, so the hot lookups all land in this scan
+	uint32_t numScanned = min(mVector.size(), sMaxSymbolScan);
+	for(uint32_t i = 0; i < numScanned; ++i)
+	{
+		if(mSymbols[i] == key)
+		{
+			return &mVector[i]->second;
+		}
+	}
+
+	// past the scan, or the key may be stored without its id -- fall back on the string table
+	if(numScanned < mVector.size() || mNumUnresolved > 0)
+	{
+		return find(key.name());
+	}
+
+	return nullptr;
+}
+
+//-----------------------------------------------------------------
+
 Datum* Scope::search(const string& key, const Scope** outScope) const
 {
 	const Scope* currentScope = this;
@@ -216,29 +350,65 @@ Datum* Scope::search(const string& key, const Scope** outScope) const
 
 //-----------------------------------------------------------------
 
-string Scope::findName(Scope* const other) const
+Datum* Scope::search(const Symbol& key, const Scope** outScope) const
 {
-	string returnStr = "";
-	for(auto& kvPair : mVector)
-	{
-		string& name = kvPair->first;
-		Datum& datum = kvPair->second;
+	const Scope* currentScope = this;
+	Datum* findResult = nullptr;
 
-		if(datum.type() != Datum::DatumType::Table)
+	// walk the ancestry chain until we find the key or run out of ancestors
+	while(currentScope != nullptr)
+	{
+		findResult = currentScope->find(key);
+		if(findResult != nullptr)
 		{
-			continue;
+			break;
 		}
 
-		// for each field with type for Scope...
-		// check each Table datum's entries for the address we want
-		for(uint32_t i = 0; i < datum.size(); ++i)
-		{
-			if(&datum[i] == other)
-			{
-				returnStr = name;
-				break;
-			}
-		}
+		currentScope = currentScope->mParent;
+	}
+
+	// set Scope that owns the key if we can
+	if(outScope != nullptr)
+	{
+		*outScope = currentScope;
+	}
+
+	return findResult;
+}
+
+//-----------------------------------------------------------------
+
+Datum* Scope::search(const Symbol& key, Binding& binding, const Scope** outScope) const
+{
+	// the version is read first, so a change made during the search leaves the binding stale rather than wrong
+	//		only our own tree's version matters, and a Scope that has moved to another tree sees that tree's
+	uint64_t version = root()->mStructureVersion.load();
+	if(binding.mVersion != version || binding.mOrigin != this || binding.mKey != key)
+	{
+		binding.mDatum = search(key, &binding.mOwner);
+		binding.mOrigin = this;
+		binding.mKey = key;
+		binding.mVersion = version;
+	}
+
+	if(outScope != nullptr)
+	{
+		*outScope = binding.mOwner;
+	}
+
+	return binding.mDatum;
+}
+
+//-----------------------------------------------------------------
+
+string Scope::findName(Scope* const other) const
+{
+	string returnStr = "";
+
+	// a direct child knows which of our fields it is stored in
+	if(other != nullptr && other->mParent == this && (other->isAtRecordedSlot() || other->locateInParent()))
+	{
+		returnStr = other->mParentEntry->first;
 	}
 
 	return returnStr;
@@ -253,15 +423,20 @@ Datum& Scope::append(const string& key)
 		throw exception("Error -- cannot use an empty key name to append a data field!");
 	}
 
-	bool didInsert;
-	MapIter iter = mMap.insert(PairType(key, Datum()), &didInsert);
-	if(didInsert)
+	return appendEntry(key, nullptr).second;
+}
+
+//-----------------------------------------------------------------
+
+Datum& Scope::append(const Symbol& key)
+{
+	if(!key.isValid())
 	{
-		// push back new entries (address of the pair type) to the vector
-		mVector.pushBack(&*iter);
+		throw exception("Error -- cannot use an invalid Symbol to append a data field!");
 	}
 
-	return iter->second;
+	Datum* datum = find(key);
+	return (datum != nullptr) ? *datum : appendEntry(key.name(), &key).second;
 }
 
 //-----------------------------------------------------------------
@@ -274,7 +449,8 @@ Scope& Scope::appendScope(const string& key)
 	}
 
 	// attempt to append key (returns new Datum or one already there)
-	Datum& datum = append(key);
+	PairType& entry = appendEntry(key, nullptr);
+	Datum& datum = entry.second;
 
 	if(datum.type() != Datum::DatumType::Unknown && datum.type() != Datum::DatumType::Table)
 	{
@@ -288,10 +464,13 @@ Scope& Scope::appendScope(const string& key)
 		throw exception("Error -- cannot append a scope to a field storing external data!");
 	}
 
+	// checked before allocating, so a refused Scope is never built
+	checkArena(ScopeArena::current());
+
 	// push back new scope to the datum that append returns
 	Scope* scope = new Scope();
-	scope->mParent = this;
-	datum.pushBack(*scope);
+	attach(entry, *scope);
+	scope->updateAncestry();
 
 	return *scope;
 }
@@ -309,24 +488,34 @@ void Scope::clear()
 			continue;
 		}
 
-		for(; !datum.isEmpty(); )
+		while(!datum.isEmpty())
 		{
-			// nulling the child scope's parent eliminates the orphan during deletion
-			// we then remove the entry from the datum while where here
-			Scope& childScope = datum[0];
-			childScope.mParent = nullptr;
-			datum.removeAt(0);
-
-			// recursive delete the child scope
-			//		detached from 'this', so no orphan performed (and no double-search)
-			delete &childScope;
+			// abandoning the child scope's parent eliminates the orphan during deletion
+			// taking children from the back removes them without shifting the rest of the array down
+			Scope& childScope = datum[datum.size() - 1];
+			datum.popBack();
+
+			// a child destroyed with its arena is gone already, and its arena will release the storage
+			if(!isDestroyedWithArena(childScope))
+			{
+				// recursive delete the child scope
+				//		detached from 'this', so no orphan performed (and no double-search)
+				childScope.abandonParent();
+				delete &childScope;
+			}
 		}
 	}
 
+	// every Datum here is about to go, along with any Binding that resolved to one
+	invalidateBindings();
+
 	// clear the map and vector of all allocated elements
 	mMap.clear();
 	mVector.clear();
 	mVector.shrinkToFit();
+	mSymbols.clear();
+	mSymbols.shrinkToFit();
+	mNumUnresolved = 0;
 }
 
 //-----------------------------------------------------------------
@@ -342,7 +531,8 @@ void Scope::adopt(const string& key, Scope& child)
 	if(&child != this && child.getParent() != this)
 	{
 		// get or create a new Datum for the key
-		Datum& datum = append(key);
+		PairType& entry = appendEntry(key, nullptr);
+		Datum& datum = entry.second;
 
 		if(datum.type() != Datum::DatumType::Unknown && datum.type() != Datum::DatumType::Table)
 		{
@@ -356,9 +546,13 @@ void Scope::adopt(const string& key, Scope& child)
 			throw exception("Error -- cannot adopt a scope to a field storing external data!");
 		}
 
+		// children are always allocated with new, so they have a header
+		const ArenaHeader* header = reinterpret_cast<const ArenaHeader*>(reinterpret_cast<const char*>(&child) - ScopeArena::sAlignment);
+		checkArena(header->mArena);
+
 		child.orphan();
-		child.mParent = this;
-		datum.pushBack(child);
+		attach(entry, child);
+		child.updateAncestry();
 	}
 }
 
@@ -368,24 +562,43 @@ void Scope::orphan()
 {
 	if(mParent != nullptr)
 	{
-		// step thru inserted elements in parent
-		for(auto& parentPair : mParent->mVector)
-		{
-			Datum& datum = parentPair->second;
+		detach();
 
-			// attempt to remove the current Scope from the current Datum if it's of type Table
-			//		removing an object not in the Datum is a noop, so we're safe in trying to remove it from wherever
-			if(datum.type() == Datum::DatumType::Table)
-			{
-				if(datum.remove(*this))
-				{
-					break;
-				}
-			}
-		}
+		// we now root a tree of our own
+		updateAncestry();
+		invalidateBindings();
+	}
+}
+
+//-----------------------------------------------------------------
+
+void Scope::detach()
+{
+	assert(mParent != nullptr);
 
-		mParent = nullptr;
+	// the recorded slot is only searched for if the parent's Datum was edited behind our back
+	if(isAtRecordedSlot() || locateInParent())
+	{
+		Datum& datum = mParentEntry->second;
+		uint32_t last = datum.size() - 1;
+
+		// the last sibling fills the gap, so nothing else in the array moves
+		if(mParentIndex != last)
+		{
+			Scope& sibling = datum[last];
+			datum.set(sibling, mParentIndex);
+			sibling.mParentEntry = mParentEntry;
+			sibling.mParentIndex = mParentIndex;
+		}
+		datum.popBack();
 	}
+
+	// the tree we leave has changed shape
+	invalidateBindings();
+
+	mParent = nullptr;
+	mParentEntry = nullptr;
+	mParentIndex = 0;
 }
 
 //-----------------------------------------------------------------
@@ -397,6 +610,13 @@ Scope::TableVector::Iterator Scope::begin()
 
 //-----------------------------------------------------------------
 
+const Scope::TableVector::Iterator Scope::begin() const
+{
+	return mVector.begin();
+}
+
+//-----------------------------------------------------------------
+
 Scope::TableVector::Iterator Scope::end()
 {
 	return mVector.end();
@@ -404,20 +624,25 @@ Scope::TableVector::Iterator Scope::end()
 
 //-----------------------------------------------------------------
 
+const Scope::TableVector::Iterator Scope::end() const
+{
+	return mVector.end();
+}
+
+//-----------------------------------------------------------------
+
 bool Scope::isAncestor(const Scope& scope) const
 {
 	bool result = false;
 
-	const Scope* currentScope = this;
-	while(currentScope != nullptr)
+	// an ancestor is always shallower, and there is only one Scope on our chain at each depth
+	if(scope.mDepth == mDepth)
 	{
-		if(currentScope == &scope)
-		{
-			result = true;
-			break;
-		}
-
-		currentScope = currentScope->mParent;
+		result = (&scope == this);
+	}
+	else if(scope.mDepth < mDepth)
+	{
+		result = (ancestorAt(scope.mDepth) == &scope);
 	}
 
 	return result;
@@ -425,6 +650,13 @@ bool Scope::isAncestor(const Scope& scope) const
 
 //-----------------------------------------------------------------
 
+uint32_t Scope::getDepth() const
+{
+	return mDepth;
+}
+
+//-----------------------------------------------------------------
+
 uint32_t Scope::size() const
 {
 	return mVector.size();
@@ -481,36 +713,292 @@ string Scope::ToString() const
 
 //-----------------------------------------------------------------
 
+ScopeArena* Scope::getTreeArena() const
+{
+	return nullptr;
+}
+
+//-----------------------------------------------------------------
+
+Scope::PairType& Scope::appendEntry(const string& key, const Symbol* symbol)
+{
+	bool didInsert;
+	MapIter iter = mMap.insert(PairType(key, Datum()), &didInsert);
+	if(didInsert)
+	{
+		// push back new entries (address of the pair type) to the vector
+		mVector.pushBack(&*iter);
+
+		// plain string keys only pick up a Symbol if the name is already interned, so the table never grows here
+		Symbol keySymbol = (symbol != nullptr) ? *symbol : Symbol::lookup(key);
+		mSymbols.pushBack(keySymbol);
+		if(!keySymbol.isValid())
+		{
+			++mNumUnresolved;
+		}
+
+		// a new key can shadow one that a Binding resolved further up the tree
+		invalidateBindings();
+	}
+
+	return *iter;
+}
+
+//-----------------------------------------------------------------
+
+void Scope::attach(PairType& entry, Scope& child)
+{
+	Datum& datum = entry.second;
+	datum.pushBack(child);
+
+	child.mParent = this;
+	child.mParentEntry = &entry;
+	child.mParentIndex = datum.size() - 1;
+
+	invalidateBindings();
+}
+
+//-----------------------------------------------------------------
+
+bool Scope::isAtRecordedSlot() const
+{
+	bool result = false;
+	if(mParentEntry != nullptr)
+	{
+		Datum& datum = mParentEntry->second;
+		result = datum.type() == Datum::DatumType::Table && mParentIndex < datum.size() && &datum[mParentIndex] == this;
+	}
+
+	return result;
+}
+
+//-----------------------------------------------------------------
+
+bool Scope::locateInParent()
+{
+	bool result = false;
+	for(auto& parentPair : mParent->mVector)
+	{
+		Datum& datum = parentPair->second;
+		if(datum.type() != Datum::DatumType::Table)
+		{
+			continue;
+		}
+
+		for(uint32_t i = 0; i < datum.size(); ++i)
+		{
+			if(&datum[i] == this)
+			{
+				mParentEntry = parentPair;
+				mParentIndex = i;
+				result = true;
+				break;
+			}
+		}
+
+		if(result)
+		{
+			break;
+		}
+	}
+
+	return result;
+}
+
+//-----------------------------------------------------------------
+
+void Scope::updateAncestry()
+{
+	mDeepAncestors.clear();
+
+	if(mParent != nullptr)
+	{
+		// our ancestors are the parent's, plus the parent itself
+		uint32_t parentDepth = mParent->mDepth;
+		uint32_t numInline = (parentDepth < sNumInlineAncestors) ? parentDepth : sNumInlineAncestors;
+		for(uint32_t i = 0; i < numInline; ++i)
+		{
+			mAncestors[i] = mParent->mAncestors[i];
+		}
+
+		if(parentDepth < sNumInlineAncestors)
+		{
+			mAncestors[parentDepth] = mParent;
+		}
+		else
+		{
+			mDeepAncestors.reserve(parentDepth + 1 - sNumInlineAncestors);
+			for(auto& ancestor : mParent->mDeepAncestors)
+			{
+				mDeepAncestors.pushBack(ancestor);
+			}
+			mDeepAncestors.pushBack(mParent);
+		}
+
+		mDepth = parentDepth + 1;
+	}
+	else
+	{
+		mDepth = 0;
+	}
+
+	// a Scope that moves back up the tree gives back the room it no longer needs
+	mDeepAncestors.shrinkToFit();
+
+	// the whole subtree moved with us
+	for(auto& kvPair : mVector)
+	{
+		Datum& datum = kvPair->second;
+		if(datum.type() != Datum::DatumType::Table)
+		{
+			continue;
+		}
+
+		for(uint32_t i = 0; i < datum.size(); ++i)
+		{
+			datum[i].updateAncestry();
+		}
+	}
+}
+
+//-----------------------------------------------------------------
+
+bool Scope::isDestroyedWithArena(const Scope& child)
+{
+	// children are always allocated with new, so they have a header
+	const ArenaHeader* header = reinterpret_cast<const ArenaHeader*>(reinterpret_cast<const char*>(&child) - ScopeArena::sAlignment);
+	return header->mArena != nullptr && header->mArena->hasDestroyedScopes();
+}
+
+//-----------------------------------------------------------------
+
+void Scope::checkArena(const ScopeArena* arena) const
+{
+	// heap Scopes are deleted by their parents, so they fit in any tree
+	const ScopeArena* treeArena = root()->getTreeArena();
+	if(arena != nullptr && treeArena != nullptr && arena != treeArena)
+	{
+		throw exception("Error -- cannot add a Scope from one arena to a tree owned by another!");
+	}
+}
+
+//-----------------------------------------------------------------
+
+void Scope::abandonParent()
+{
+	mParent = nullptr;
+	mParentEntry = nullptr;
+	mParentIndex = 0;
+
+	// with no ancestors left, invalidating Bindings while we are destroyed only touches this Scope
+	mDepth = 0;
+}
+
+//-----------------------------------------------------------------
+
+Scope* Scope::ancestorAt(uint32_t depth) const
+{
+	assert(depth < mDepth);
+	return (depth < sNumInlineAncestors) ? mAncestors[depth] : mDeepAncestors[depth - sNumInlineAncestors];
+}
+
+//-----------------------------------------------------------------
+
+Scope* Scope::root()
+{
+	return (mDepth == 0) ? this : mAncestors[0];
+}
+
+//-----------------------------------------------------------------
+
+const Scope* Scope::root() const
+{
+	return (mDepth == 0) ? this : mAncestors[0];
+}
+
+//-----------------------------------------------------------------
+
+void Scope::invalidateBindings()
+{
+	root()->mStructureVersion.store(nextVersion());
+}
+
+//-----------------------------------------------------------------
+
+uint64_t Scope::nextVersion()
+{
+	thread_local uint64_t tNextVersion = 0;
+	thread_local uint64_t tEndVersion = 0;
+
+	if(tNextVersion == tEndVersion)
+	{
+		tNextVersion = sNextVersionBlock.fetch_add(sVersionBlockSize);
+		tEndVersion = tNextVersion + sVersionBlockSize;
+	}
+
+	return tNextVersion++;
+}
+
+//-----------------------------------------------------------------
+
 void Scope::performDeepCopy(const Scope& other)
 {
+	// the children are copied (through their own copy constructors) before they are attached,
+	//		so only the outermost copy sets ancestry, once, after the whole tree is built
+	thread_local uint32_t tNumNestedCopies = 0;
+
 	mVector.reserve(other.mVector.capacity());
+	mSymbols.reserve(other.mVector.capacity());
+	mMap.reserve(other.mVector.size());
 
 	// step through all inserted fields of other
-	for(auto& kvPair : other.mVector)
+	for(uint32_t index = 0; index < other.mVector.size(); ++index)
 	{
-		string& name = kvPair->first;
-		Datum& datum = kvPair->second;
+		string& name = other.mVector[index]->first;
+		Datum& datum = other.mVector[index]->second;
+
+		// a key other added before its name was interned may have been interned since
+		const Symbol* symbol = other.mSymbols[index].isValid() ? &other.mSymbols[index] : nullptr;
 
 		if(datum.isEmpty())
 		{
-			append(name) = datum;
+			appendEntry(name, symbol).second = datum;
 		}
 		else
 		{
 			if(datum.type() != Datum::DatumType::Table)
 			{
-				append(name) = datum;
+				appendEntry(name, symbol).second = datum;
 			}
 			else
 			{
+				PairType& entry = appendEntry(name, symbol);
 				for(uint32_t i = 0; i < datum.size(); ++i)
 				{
-					// adopting a virtual copy-constructed pointer preserves the true type of the child
-					adopt(name, *datum[i].copy());
+					// attaching a virtual copy-constructed pointer preserves the true type of the child
+					++tNumNestedCopies;
+					Scope* child = nullptr;
+					try
+					{
+						child = datum[i].copy();
+					}
+					catch(...)
+					{
+						--tNumNestedCopies;
+						throw;
+					}
+					--tNumNestedCopies;
+
+					attach(entry, *child);
 				}
 			}
 		}	
 	}
+
+	if(tNumNestedCopies == 0)
+	{
+		updateAncestry();
+	}
 }
 
 //-----------------------------------------------------------------
@@ -4,8 +4,10 @@
 #include "HashMap.h"
 #include "Vector.h"
 #include "Datum.h"
+#include "Symbol.h"
 
 #include "RTTI.h"
+#include "ScopeArena.h"
 
 namespace DOGEngine
 {
@@ -16,20 +18,65 @@ namespace DOGEngine
 	 *
 	 * Scopes also keep an ordered array that tracks the order
 	 * of data insertions.
+	 *
+	 * Every key may also be looked up by Symbol. Each entry
+	 * records the Symbol of its key if that name was already
+	 * interned when the entry was added, and Symbol lookups
+	 * compare those ids instead of hashing the key.
+	 *
+	 * Each Scope knows its depth in the tree and keeps every
+	 * ancestor indexed by depth, so ancestry tests and finding
+	 * the root never walk the parent chain. The nearest
+	 * ancestors are stored inline; only Scopes deeper than
+	 * that allocate room for the rest.
 	 */
 	class Scope : public RTTI
 	{
 		RTTI_DECLARATIONS(Scope, RTTI)
 
+		friend class ScopeArena;
+
 	protected:
 
 		typedef std::pair<std::string, Datum> PairType;
 		typedef HashMap<std::string, Datum> TableMap;	
 		typedef TableMap::Iterator MapIter;
 		typedef Vector<PairType*> TableVector;
+		typedef Vector<Symbol> SymbolVector;
 
 	public:
 
+		/**
+		 * Cached result of a search, for callers that resolve
+		 * the same Symbol from the same Scope over and over.
+		 * Any structural change to a tree -- a child adopted,
+		 * orphaned or destroyed, or a new key appended --
+		 * invalidates the Bindings resolved in that tree, and
+		 * the next search through one walks the ancestry
+		 * again. Changes to other trees, such as Scopes being
+		 * parsed on other threads, leave them alone.
+		 */
+		class Binding final
+		{
+		public:
+
+			/**
+			 * @brief Constructor. The Binding starts out
+			 *		  unresolved.
+			 */
+			Binding();
+
+		private:
+
+			friend class Scope;
+
+			const Scope* mOrigin;
+			const Scope* mOwner;
+			Datum* mDatum;
+			Symbol mKey;
+			std::uint64_t mVersion;
+		};
+
 		/**
 		 * @brief Constructor.
 		 *
@@ -104,6 +151,45 @@ namespace DOGEngine
 		 */
 		virtual ~Scope();
 
+		/**
+		 * @brief Allocates storage for a Scope, or any class
+		 *		  derived from it, from this thread's current
+		 *		  ScopeArena if there is one, and from the heap
+		 *		  otherwise.
+		 *
+		 * @param size The size of the object.
+		 *
+		 * @return Returns a pointer to the storage.
+		 */
+		static void* operator new(std::size_t size);
+
+		/**
+		 * @brief Frees the storage of a Scope allocated with
+		 *		  new. Storage from a ScopeArena is left for the
+		 *		  arena to release with the rest of its blocks,
+		 *		  and the arena stops tracking the Scope.
+		 *
+		 * @param memory The storage being freed.
+		 */
+		static void operator delete(void* memory);
+
+		/**
+		 * @brief Placement new. Constructs a Scope in storage
+		 *		  the caller already owns; no arena is involved.
+		 *
+		 * @param size The size of the object.
+		 * @param memory The storage the Scope is built in.
+		 *
+		 * @return Returns memory.
+		 */
+		static void* operator new(std::size_t size, void* memory);
+
+		/**
+		 * @brief Placement delete, matching placement new. Does
+		 *		  nothing; the caller owns the storage.
+		 */
+		static void operator delete(void* memory, void* place);
+
 		/**
 		 * @brief Equality method. Compares this Scope with an RTTI.
 		 *		  The comparison is recursive.
@@ -156,6 +242,21 @@ namespace DOGEngine
 		 */
 		Datum& operator[](const std::string& key);
 
+		/**
+		 * @brief Square brackets operator. Gets or creates the Datum
+		 *		  associated with the given Symbol.
+		 *
+		 * @param key The Symbol to look up.
+		 *
+		 * @return Returns a reference to a Datum object. If the key
+		 *		   is already in the Scope, the Datum already there
+		 *		   is returned. If the key is not in the Scope, a new
+		 *		   empty Datum returned.
+		 *
+		 * @exception Throws an exception if the Symbol is invalid.
+		 */
+		Datum& operator[](const Symbol& key);
+
 		/**
 		 * @brief Square brackets operator. Gets the Datum inserted
 		 *		  in the given order.
@@ -196,6 +297,22 @@ namespace DOGEngine
 		 */
 		Datum* find(const std::string& key) const;
 
+		/**
+		 * @brief Retrieves the Datum object associated with the given
+		 *		  Symbol if it exists.
+		 *
+		 * @param key The Symbol to look up.
+		 *
+		 * @return Returns a pointer to the Datum object if the key is
+		 *		   in the Scope. Otherwise, returns nullptr.
+		 *
+		 * @note The first few entries are matched by id alone. The
+		 *		 string table is only consulted for keys past those
+		 *		 entries, or for keys added before their name was
+		 *		 interned.
+		 */
+		Datum* find(const Symbol& key) const;
+
 		/**
 		 * @brief Finds the closest occurance of the given key in this
 		 *		  Scope or one of its ancestors.
@@ -210,6 +327,39 @@ namespace DOGEngine
 		 */
 		Datum* search(const std::string& key, const Scope** outScope = nullptr) const;
 
+		/**
+		 * @brief Finds the closest occurance of the given Symbol in
+		 *		  this Scope or one of its ancestors.
+		 *
+		 * @param key The Symbol to look up.
+		 * @param outScope Passed by reference for returning, if provided.
+		 *				   Points to the Scope that contains the closest
+		 *				   occurance of the given key.
+		 *
+		 * @return Returns a pointer to the Datum object if the key is in
+		 *		   the Scope. Otherwise, returns nullptr.
+		 */
+		Datum* search(const Symbol& key, const Scope** outScope = nullptr) const;
+
+		/**
+		 * @brief Finds the closest occurance of the given Symbol in
+		 *		  this Scope or one of its ancestors, reusing the
+		 *		  result cached in a Binding if nothing has changed
+		 *		  since it was resolved.
+		 *
+		 * @param key The Symbol to look up.
+		 * @param binding The cache for this lookup. Resolved again if
+		 *				  it is stale, or was last used with another
+		 *				  Scope or Symbol.
+		 * @param outScope Passed by reference for returning, if provided.
+		 *				   Points to the Scope that contains the closest
+		 *				   occurance of the given key.
+		 *
+		 * @return Returns a pointer to the Datum object if the key is in
+		 *		   the Scope. Otherwise, returns nullptr.
+		 */
+		Datum* search(const Symbol& key, Binding& binding, const Scope** outScope = nullptr) const;
+
 		/**
 		 * @brief Retrieves the field name of the given child scope.
 		 *
@@ -219,6 +369,9 @@ namespace DOGEngine
 		 *		   Scope if it is a child of this Scope. If the given
 		 *		   Scope is not a direct child of this Scope, an empty
 		 *		   string is returned ""
+		 *
+		 * @note Constant time -- each child records the field it is
+		 *		 stored in.
 		 */
 		std::string findName(Scope* const other) const;
 
@@ -238,6 +391,21 @@ namespace DOGEngine
 		 */
 		Datum& append(const std::string& key);
 
+		/**
+		 * @brief Gets or creates the Datum associated with the given
+		 *		  Symbol.
+		 *
+		 * @param key The Symbol to look up.
+		 *
+		 * @return Returns a reference to a Datum object. If the key
+		 *		   is already in the Scope, the Datum already there
+		 *		   is returned. If the key is not in the Scope, a new
+		 *		   empty Datum returned.
+		 *
+		 * @exception Throws an exception if the Symbol is invalid.
+		 */
+		Datum& append(const Symbol& key);
+
 		/**
 		 * @brief Attaches a new Scope as a child of this Scope.
 		 *
@@ -259,6 +427,8 @@ namespace DOGEngine
 		 *			  ""
 		 * @exception Throws exception if a Datum exists at the given
 		 *			  key that is not of type Table
+		 * @exception Throws exception if the tree is owned by an
+		 *			  arena other than the one that is active
 		 */
 		Scope& appendScope(const std::string& key);
 
@@ -285,12 +455,22 @@ namespace DOGEngine
 		 *			  ""
 		 * @exception Throws exception if a Datum exists at the given
 		 *			  key that is not of type Table
+		 * @exception Throws exception if the child comes from an
+		 *			  arena and the tree is owned by another one.
+		 *			  Copy the child with that arena active to
+		 *			  move it across.
 		 */
 		void adopt(const std::string& key, Scope& child);
 
 		/**
 		 * @brief Detaches this Scope from its parent. The parent is
 		 *		  no longer responsible for this Scope or its children.
+		 *
+		 * @note Removal from the parent is constant time: the last
+		 *		 Scope in the same field takes this Scope's place, so
+		 *		 the order of the remaining siblings is not preserved.
+		 *		 This Scope's subtree then has its ancestry updated.
+		 *		 Destroying a Scope skips that update.
 		 */
 		void orphan();
 
@@ -302,6 +482,14 @@ namespace DOGEngine
 		 */
 		TableVector::Iterator begin();
 
+		/**
+		 * @brief Gets the starting iterator for a const Scope.
+		 *
+		 * @return Returns a const Vector::Iterator pointing to the
+		 *		   start of mVector.
+		 */
+		const TableVector::Iterator begin() const;
+
 		/**
 		 * @brief Gets the ending iterator for the Scope.
 		 *
@@ -310,6 +498,14 @@ namespace DOGEngine
 		 */
 		TableVector::Iterator end();
 
+		/**
+		 * @brief Gets the ending iterator for a const Scope.
+		 *
+		 * @return Returns a const Vector::Iterator pointing to the
+		 *		   end of mVector.
+		 */
+		const TableVector::Iterator end() const;
+
 		/**
 		 * @brief Says whether the given Scope is an ancestor of this.
 		 *
@@ -319,9 +515,19 @@ namespace DOGEngine
 		 *		   parent chain. Otherwise, returns false.
 		 *
 		 * @note Scopes are considered their own ancestor (scope == this)
+		 * @note Constant time at any depth.
 		 */
 		bool isAncestor(const Scope& scope) const;
 
+		/**
+		 * @brief Retrieves how far this Scope is from the root of its
+		 *		  tree.
+		 *
+		 * @return Returns 0 for a Scope with no parent, 1 for its
+		 *		   children, and so on.
+		 */
+		std::uint32_t getDepth() const;
+
 		/**
 		 * @brief Retrieves the number of inserted string-Datum pairs.
 		 *
@@ -356,13 +562,174 @@ namespace DOGEngine
 
 	protected:
 
+		/**
+		 * @brief Getter for the arena that owns this tree, when
+		 *		  this Scope is its root. Scopes from any other
+		 *		  arena cannot join the tree, since that arena
+		 *		  would destroy them while the tree still holds
+		 *		  them.
+		 *
+		 * @return Returns nullptr, as a plain Scope tree is owned
+		 *		   by no arena, and may mix Scopes from any of them.
+		 */
+		virtual ScopeArena* getTreeArena() const;
+
 		TableMap mMap;
 		TableVector mVector;
 
+		// parallel to mVector -- the Symbol of each key, or an invalid Symbol if it wasn't interned yet
+		SymbolVector mSymbols;
+		std::uint32_t mNumUnresolved;
+
 		Scope* mParent;
 
 	private:
 
+		/**
+		 * Stored in front of every Scope allocated with new.
+		 */
+		struct ArenaHeader
+		{
+			ScopeArena* mArena;
+			std::uint32_t mSlot;
+		};
+
+		/**
+		 * @brief Says whether a child was destroyed along with
+		 *		  the rest of its ScopeArena, so its parent should
+		 *		  only let go of it.
+		 *
+		 * @param child A Scope stored in one of our fields.
+		 *
+		 * @return Returns true if the child's arena has destroyed
+		 *		   its Scopes.
+		 */
+		static bool isDestroyedWithArena(const Scope& child);
+
+		/**
+		 * @brief Makes sure Scopes from an arena may join this
+		 *		  Scope's tree.
+		 *
+		 * @param arena The arena the Scopes come from, or
+		 *				nullptr for the heap.
+		 *
+		 * @exception Throws exception if the tree is owned by
+		 *			  another arena.
+		 */
+		void checkArena(const ScopeArena* arena) const;
+
+		/**
+		 * @brief Forgets this Scope's parent without touching
+		 *		  it, for a Scope that is destroyed along with
+		 *		  (or by) its parent. This Scope becomes the root
+		 *		  of what is left of its tree.
+		 */
+		void abandonParent();
+
+		/**
+		 * @brief Removes this Scope from its parent's field and
+		 *		  forgets the parent. Depth and ancestors are left
+		 *		  as they were, for the caller to update (or not,
+		 *		  if this Scope is being destroyed).
+		 */
+		void detach();
+
+		/**
+		 * @brief Inserts the key if it is new, recording its Symbol
+		 *		  alongside it.
+		 *
+		 * @param key The string key to look up.
+		 * @param symbol The Symbol of the key, if the caller has it.
+		 *				 If nullptr, a new key's Symbol is looked up
+		 *				 in the symbol table.
+		 *
+		 * @return Returns a reference to the Datum at the key.
+		 */
+		PairType& appendEntry(const std::string& key, const Symbol* symbol);
+
+		/**
+		 * @brief Pushes a child onto the back of one of this Scope's
+		 *		  fields, recording where it was stored. The child's
+		 *		  ancestry is left to the caller, so a tree being
+		 *		  copied can set it once, from the top.
+		 *
+		 * @param entry The field the child is stored in.
+		 * @param child The incoming Scope, with no parent.
+		 */
+		void attach(PairType& entry, Scope& child);
+
+		/**
+		 * @brief Says whether this Scope is still stored where it
+		 *		  recorded. Only false if the parent's Datum was
+		 *		  edited directly rather than through Scope.
+		 *
+		 * @return Returns true if the recorded slot holds this Scope.
+		 */
+		bool isAtRecordedSlot() const;
+
+		/**
+		 * @brief Searches the parent's fields for this Scope and
+		 *		  records where it was found.
+		 *
+		 * @return Returns true if the parent stores this Scope.
+		 */
+		bool locateInParent();
+
+		/**
+		 * @brief Recomputes the depth and ancestors of this Scope
+		 *		  and everything below it, after its parent has
+		 *		  changed.
+		 *
+		 * @note Proportional to the size of the subtree times its
+		 *		 depth.
+		 */
+		void updateAncestry();
+
+		/**
+		 * @brief Getter for the ancestor at the given depth.
+		 *
+		 * @param depth The depth of the ancestor, less than ours.
+		 *
+		 * @return Returns the ancestor.
+		 */
+		Scope* ancestorAt(std::uint32_t depth) const;
+
+		/**
+		 * @brief Getter for the root of this Scope's tree.
+		 *
+		 * @return Returns the root, which is this Scope if it
+		 *		   has no parent.
+		 */
+		Scope* root();
+
+		/**
+		 * @brief Getter for the root of this Scope's tree.
+		 *
+		 * @return Returns the root, which is this Scope if it
+		 *		   has no parent.
+		 */
+		const Scope* root() const;
+
+		/**
+		 * @brief Marks the structure of this Scope's tree as
+		 *		  changed, which invalidates the Bindings resolved
+		 *		  in it.
+		 */
+		void invalidateBindings();
+
+		/**
+		 * @brief Hands out a structure version that no tree has
+		 *		  had before, so a Binding can't mistake a new tree
+		 *		  (or a Scope reusing a freed address) for the one
+		 *		  it was resolved in.
+		 *
+		 * @return Returns the version.
+		 *
+		 * @note Each thread reserves versions in blocks, so the
+		 *		 shared counter is only touched once per block.
+		 */
+		static std::uint64_t nextVersion();
+
 		/**
 		 * @brief Handles the logic for recursive deep copies of Scopes.
 		 *
@@ -381,6 +748,25 @@ namespace DOGEngine
 		 */
 		std::string addTabs() const;
 
+		// the parent's field this Scope is stored in, and its index there
+		PairType* mParentEntry;
+		std::uint32_t mParentIndex;
+
+		static const std::uint32_t sNumInlineAncestors = 8;
+
+		// ancestors indexed by depth -- the first few inline, the rest (rarely any) in mDeepAncestors
+		std::uint32_t mDepth;
+		Scope* mAncestors[sNumInlineAncestors];
+		Vector<Scope*> mDeepAncestors;
+
+		// only read on roots -- changes anywhere in a tree are recorded on its root
+		std::atomic<std::uint64_t> mStructureVersion;
+
 		static std::uint32_t sNumTabs;
+
+		static const std::uint64_t sVersionBlockSize;
+		static std::atomic<std::uint64_t> sNextVersionBlock;
+
+		static const std::uint32_t sMaxSymbolScan;
 	};
 }
@@ -0,0 +1,245 @@
+#include "pch.h"
+#include "ScopeArena.h"
+
+#include "Scope.h"
+
+using namespace DOGEngine;
+using namespace std;
+
+thread_local ScopeArena* ScopeArena::sCurrent = nullptr;
+
+#pragma region Activation
+
+ScopeArena::Activation::Activation(ScopeArena& arena) :
+	mPrevious(sCurrent)
+{
+	sCurrent = &arena;
+}
+
+//-----------------------------------------------------------------
+
+ScopeArena::Activation::Activation(ScopeArena* arena) :
+	mPrevious(sCurrent)
+{
+	sCurrent = arena;
+}
+
+//-----------------------------------------------------------------
+
+ScopeArena::Activation::~Activation()
+{
+	sCurrent = mPrevious;
+}
+
+#pragma endregion
+
+//=================================================================
+
+#pragma region ScopeArena
+
+ScopeArena::ScopeArena(const size_t blockSize) :
+	mBlocks(nullptr),
+	mSpareBlocks(nullptr),
+	mBump(nullptr),
+	mBumpEnd(nullptr),
+	mBlockSize(blockSize),
+	mBytesAllocated(0),
+	mNumBlocks(0),
+	mScopes(0),
+	mHasDestroyedScopes(false),
+	mMutex()
+{
+}
+
+//-----------------------------------------------------------------
+
+ScopeArena::~ScopeArena()
+{
+	release();
+}
+
+//-----------------------------------------------------------------
+
+void* ScopeArena::allocate(const size_t size)
+{
+	// every request is rounded up so the next one stays aligned
+	size_t alignedSize = (size + sAlignment - 1) & ~(sAlignment - 1);
+
+	lock_guard<mutex> lock(mMutex);
+
+	if(static_cast<size_t>(mBumpEnd - mBump) < alignedSize)
+	{
+		// an oversized request gets a block to itself, the rest of the current block is simply skipped
+		size_t blockSize = (alignedSize > mBlockSize) ? alignedSize : mBlockSize;
+
+		Block* block = nullptr;
+		if(blockSize == mBlockSize && mSpareBlocks != nullptr)
+		{
+			block = mSpareBlocks;
+			mSpareBlocks = block->mNext;
+		}
+		else
+		{
+			block = static_cast<Block*>(::operator new(sizeof(Block) + blockSize));
+			block->mSize = blockSize;
+		}
+
+		block->mNext = mBlocks;
+		mBlocks = block;
+		++mNumBlocks;
+
+		mBump = reinterpret_cast<char*>(block + 1);
+		mBumpEnd = mBump + blockSize;
+	}
+
+	void* result = mBump;
+	mBump += alignedSize;
+	mBytesAllocated += alignedSize;
+
+	return result;
+}
+
+//-----------------------------------------------------------------
+
+uint32_t ScopeArena::track(Scope& scope)
+{
+	lock_guard<mutex> lock(mMutex);
+
+	uint32_t slot = mScopes.size();
+	mScopes.pushBack(&scope);
+
+	return slot;
+}
+
+//-----------------------------------------------------------------
+
+void ScopeArena::forget(const uint32_t slot)
+{
+	lock_guard<mutex> lock(mMutex);
+
+	// a Scope deleted after destroyScopes() already has no slot
+	if(slot < mScopes.size())
+	{
+		mScopes[slot] = nullptr;
+	}
+}
+
+//-----------------------------------------------------------------
+
+void ScopeArena::destroyScopes()
+{
+	mHasDestroyedScopes = true;
+
+	// not locked, since destructors may forget() other Scopes -- the size is read each time in case they do
+	for(uint32_t i = 0; i < mScopes.size(); ++i)
+	{
+		Scope* scope = mScopes[i];
+		if(scope != nullptr)
+		{
+			// its parent (and its children from here) are destroyed by this same loop, so nothing needs to be unlinked
+			mScopes[i] = nullptr;
+			scope->abandonParent();
+			scope->~Scope();
+		}
+	}
+
+	mScopes.clear();
+}
+
+//-----------------------------------------------------------------
+
+bool ScopeArena::hasDestroyedScopes() const
+{
+	return mHasDestroyedScopes;
+}
+
+//-----------------------------------------------------------------
+
+void ScopeArena::reset()
+{
+	destroyScopes();
+
+	lock_guard<mutex> lock(mMutex);
+
+	// regular blocks go on the spare list for the next tree, only oversized ones go back to the heap
+	while(mBlocks != nullptr)
+	{
+		Block* block = mBlocks;
+		mBlocks = block->mNext;
+
+		if(block->mSize == mBlockSize)
+		{
+			block->mNext = mSpareBlocks;
+			mSpareBlocks = block;
+		}
+		else
+		{
+			::operator delete(block);
+		}
+	}
+
+	rewind();
+}
+
+//-----------------------------------------------------------------
+
+void ScopeArena::release()
+{
+	destroyScopes();
+
+	lock_guard<mutex> lock(mMutex);
+
+	freeBlocks(mBlocks);
+	freeBlocks(mSpareBlocks);
+	mScopes.shrinkToFit();
+
+	rewind();
+}
+
+//-----------------------------------------------------------------
+
+size_t ScopeArena::bytesAllocated() const
+{
+	lock_guard<mutex> lock(mMutex);
+	return mBytesAllocated;
+}
+
+//-----------------------------------------------------------------
+
+uint32_t ScopeArena::numBlocks() const
+{
+	lock_guard<mutex> lock(mMutex);
+	return mNumBlocks;
+}
+
+//-----------------------------------------------------------------
+
+ScopeArena* ScopeArena::current()
+{
+	return sCurrent;
+}
+
+//-----------------------------------------------------------------
+
+void ScopeArena::freeBlocks(Block*& blocks)
+{
+	while(blocks != nullptr)
+	{
+		Block* block = blocks;
+		blocks = block->mNext;
+		::operator delete(block);
+	}
+}
+
+//-----------------------------------------------------------------
+
+void ScopeArena::rewind()
+{
+	mBump = nullptr;
+	mBumpEnd = nullptr;
+	mBytesAllocated = 0;
+	mNumBlocks = 0;
+	mHasDestroyedScopes = false;
+}
+
+#pragma endregion
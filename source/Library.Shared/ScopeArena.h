@@ -0,0 +1,241 @@
+#pragma once
+
+#include "pch.h"
+#include "Vector.h"
+
+namespace DOGEngine
+{
+	class Scope;
+
+	/**
+	 * Monotonic arena for Scope trees. Storage is bumped out
+	 * of large blocks and never given back one object at a
+	 * time; release() frees every block at once.
+	 *
+	 * While an Activation for an arena is alive on a thread,
+	 * every Scope that thread allocates with new -- including
+	 * Worlds, Sectors, Entities and anything else made by a
+	 * Factory or copy() -- comes from that arena. Deleting
+	 * such a Scope still runs its destructor, so the heap
+	 * memory its Datums own is freed, but its own storage is
+	 * left for reset() or release().
+	 *
+	 * The arena keeps track of the Scopes built in it. The
+	 * ones still alive when it is reset or released are
+	 * destroyed in a single pass over that list, rather than
+	 * by their parents one child at a time. A Scope from an
+	 * arena therefore can't be adopted into a tree owned by
+	 * a different one, such as another World's.
+	 *
+	 * Allocation is thread-safe, so an arena may be active on
+	 * several threads at once; jobs on the JobSystem run with
+	 * the arena that was active where they were submitted.
+	 * reset(), release() and destroyScopes() must not run
+	 * while other threads are using the arena.
+	 */
+	class ScopeArena final
+	{
+	public:
+
+		/**
+		 * Alignment of every allocation.
+		 */
+		static const std::size_t sAlignment = 16;
+
+		/**
+		 * Default size of each block, in bytes.
+		 */
+		static const std::size_t sDefaultBlockSize = 64 * 1024;
+
+		/**
+		 * Makes an arena the current one on this thread for
+		 * as long as the Activation lives. The arena that was
+		 * current before is restored by the destructor, so
+		 * Activations can be nested.
+		 */
+		class Activation final
+		{
+		public:
+
+			/**
+			 * @brief Constructor. Makes the arena current.
+			 *
+			 * @param arena The arena new Scopes come from.
+			 */
+			explicit Activation(ScopeArena& arena);
+
+			/**
+			 * @brief Constructor. Makes the arena current.
+			 *
+			 * @param arena The arena new Scopes come from, or
+			 *				nullptr for the heap.
+			 */
+			explicit Activation(ScopeArena* arena);
+
+			Activation(const Activation& other) = delete;
+			Activation& operator=(const Activation& other) = delete;
+
+			/**
+			 * @brief Destructor. Restores the previously
+			 *		  current arena.
+			 */
+			~Activation();
+
+		private:
+
+			ScopeArena* mPrevious;
+		};
+
+		/**
+		 * @brief Constructor. No memory is allocated until
+		 *		  the first call to allocate.
+		 *
+		 * @param blockSize The size of each block, in bytes.
+		 *					Larger requests get a block of
+		 *					their own.
+		 */
+		explicit ScopeArena(const std::size_t blockSize = sDefaultBlockSize);
+
+		ScopeArena(const ScopeArena& other) = delete;
+		ScopeArena& operator=(const ScopeArena& other) = delete;
+
+		/**
+		 * @brief Destructor. Destroys the Scopes still alive
+		 *		  in the arena, then frees every block.
+		 */
+		~ScopeArena();
+
+		/**
+		 * @brief Getter for uninitialized storage, aligned to
+		 *		  sAlignment.
+		 *
+		 * @param size The number of bytes needed.
+		 *
+		 * @return Returns a pointer to the storage.
+		 */
+		void* allocate(const std::size_t size);
+
+		/**
+		 * @brief Records a Scope built in the arena's storage,
+		 *		  so destroyScopes() can find it.
+		 *
+		 * @param scope The Scope.
+		 *
+		 * @return Returns the Scope's slot, for forget().
+		 */
+		std::uint32_t track(Scope& scope);
+
+		/**
+		 * @brief Drops the record of a Scope that was deleted
+		 *		  on its own.
+		 *
+		 * @param slot The slot track() returned for it.
+		 */
+		void forget(const std::uint32_t slot);
+
+		/**
+		 * @brief Runs the destructor of every Scope still alive
+		 *		  in the arena, in one pass. Each is cut loose
+		 *		  from its parent first, without the parent being
+		 *		  touched, and a Scope's children from this arena
+		 *		  are only let go of, since the same pass destroys
+		 *		  them. Children from the heap are deleted as
+		 *		  usual.
+		 *
+		 * @note Until the next reset() or release(), Scopes that
+		 *		 hold children from this arena let go of them
+		 *		 instead of deleting them, so the owner of the
+		 *		 arena can clear its own tree after this.
+		 */
+		void destroyScopes();
+
+		/**
+		 * @brief Says whether destroyScopes() has run since the
+		 *		  arena was last reset or released.
+		 *
+		 * @return Returns true if the arena's Scopes are gone.
+		 */
+		bool hasDestroyedScopes() const;
+
+		/**
+		 * @brief Rewinds the arena so its storage can be handed
+		 *		  out again, keeping its blocks for the next
+		 *		  tree. Oversized blocks are freed. Scopes still
+		 *		  alive in the arena are destroyed first, as by
+		 *		  destroyScopes().
+		 */
+		void reset();
+
+		/**
+		 * @brief Frees every block at once. Scopes still alive
+		 *		  in the arena are destroyed first, as by
+		 *		  destroyScopes().
+		 */
+		void release();
+
+		/**
+		 * @brief Getter for the number of bytes handed out
+		 *		  since the arena was created or released.
+		 *
+		 * @return Returns the number of bytes allocated.
+		 */
+		std::size_t bytesAllocated() const;
+
+		/**
+		 * @brief Getter for the number of blocks the arena
+		 *		  is handing out storage from. Blocks kept by
+		 *		  reset() are not counted until they are used
+		 *		  again.
+		 *
+		 * @return Returns the number of blocks.
+		 */
+		std::uint32_t numBlocks() const;
+
+		/**
+		 * @brief Getter for this thread's current arena.
+		 *
+		 * @return Returns the arena of the innermost live
+		 *		   Activation on this thread, or nullptr if
+		 *		   there is none.
+		 */
+		static ScopeArena* current();
+
+	private:
+
+		/**
+		 * Header at the start of every block, linking the
+		 * blocks together. Padded so that the storage after
+		 * it is aligned.
+		 */
+		struct alignas(sAlignment) Block
+		{
+			Block* mNext;
+			std::size_t mSize;
+		};
+
+		void freeBlocks(Block*& blocks);
+
+		/**
+		 * @brief Moves the bump pointer to the start of no
+		 *		  block. Leaves the blocks themselves alone.
+		 */
+		void rewind();
+
+		Block* mBlocks;
+		Block* mSpareBlocks;
+		char* mBump;
+		char* mBumpEnd;
+
+		std::size_t mBlockSize;
+		std::size_t mBytesAllocated;
+		std::uint32_t mNumBlocks;
+
+		// the Scopes built here, in allocation order -- nullptr once deleted
+		Vector<Scope*> mScopes;
+		bool mHasDestroyedScopes;
+
+		mutable std::mutex mMutex;
+
+		static thread_local ScopeArena* sCurrent;
+	};
+}
@@ -15,13 +15,17 @@ const string Sector::sEntitiesAttribute = "entities";
 const string Sector::sActionsAttribute = "actions";
 const string Sector::sReactionsAttribute = "reactions";
 
+const Symbol Sector::sNameSymbol(Sector::sNameAttribute);
+const Symbol Sector::sEntitiesSymbol(Sector::sEntitiesAttribute);
+const Symbol Sector::sActionsSymbol(Sector::sActionsAttribute);
+const Symbol Sector::sReactionsSymbol(Sector::sReactionsAttribute);
+
+const uint32_t Sector::sEntitiesPerJob = 64;
+
 Sector::Sector(const std::string& name) :
 	Attributed()
 {
-	if(!areSignaturesInitialized())
-	{
-		initSignatures();
-	}
+	initSignaturesOnce();
 	populate();
 
 	// set name to the argument if we were given one (populate sets name to some default value)
@@ -93,24 +97,46 @@ Sector::~Sector()
 void Sector::update(WorldState& worldState)
 {
 	worldState.sector = this;
-
-	// call update on each child action in this world
-	Datum& actions = getActions();
-	for(uint32_t i = 0; i < actions.size(); ++i)
-	{
-		static_cast<Action*>(&actions[i])->update(worldState);
-	}
+	updateActions(worldState);
 
 	// call update on each child entity in this sector
 	Datum& entities = getEntities();
 	for(uint32_t i = 0; i < entities.size(); ++i)
 	{
+		worldState.entityIndex = i + 1;
 		static_cast<Entity*>(&entities[i])->update(worldState);
 	}
 }
 
 //-----------------------------------------------------------------
 
+void Sector::update(WorldState& worldState, JobSystem::JobGroup& jobGroup)
+{
+	worldState.sector = this;
+	updateActions(worldState);
+
+	// chunks are cut by index, so the split doesn't depend on which thread gets what
+	//		structural changes are deferred, so the entity list holds still until every job is done
+	Datum& entities = getEntities();
+	vector<JobSystem::Job> jobs;
+	for(uint32_t begin = 0; begin < entities.size(); begin += sEntitiesPerJob)
+	{
+		uint32_t end = min(begin + sEntitiesPerJob, entities.size());
+		jobs.emplace_back([&entities, worldState, begin, end]() mutable
+		{
+			for(uint32_t i = begin; i < end; ++i)
+			{
+				worldState.entityIndex = i + 1;
+				static_cast<Entity*>(&entities[i])->update(worldState);
+			}
+		});
+	}
+
+	jobGroup.submit(jobs);
+}
+
+//-----------------------------------------------------------------
+
 Entity* Sector::createEntity(const string& className, const string& objectName)
 {
 	Entity* entity = Factory<Entity>::create(className);
@@ -180,21 +206,21 @@ World* Sector::getWorld() const
 
 Datum& Sector::getEntities() const
 {
-	return *find(sEntitiesAttribute);
+	return *mEntities;
 }
 
 //-----------------------------------------------------------------
 
 Datum& Sector::getActions() const
 {
-	return *find(sActionsAttribute);
+	return *mActions;
 }
 
 //-----------------------------------------------------------------
 
 Datum& Sector::getReactions() const
 {
-	return *find(sReactionsAttribute);
+	return *mReactions;
 }
 
 //-----------------------------------------------------------------
@@ -220,6 +246,10 @@ void Sector::populate()
 	addTableEntry(sEntitiesAttribute);
 	addTableEntry(sActionsAttribute);
 	addTableEntry(sReactionsAttribute);
+
+	mEntities = find(sEntitiesSymbol);
+	mActions = find(sActionsSymbol);
+	mReactions = find(sReactionsSymbol);
 }
 
 //-----------------------------------------------------------------
@@ -227,5 +257,23 @@ void Sector::populate()
 void Sector::updateExternalStorage()
 {
 	Attributed::updateExternalStorage();
-	(*this)[sNameAttribute].setStorage(&mName, 1);
+
+	mEntities = find(sEntitiesSymbol);
+	mActions = find(sActionsSymbol);
+	mReactions = find(sReactionsSymbol);
+}
+
+//-----------------------------------------------------------------
+
+void Sector::updateActions(WorldState& worldState)
+{
+	// the sector's own actions come before any of its entities
+	worldState.entityIndex = 0;
+
+	// call update on each child action in this sector
+	Datum& actions = getActions();
+	for(uint32_t i = 0; i < actions.size(); ++i)
+	{
+		static_cast<Action*>(&actions[i])->update(worldState);
+	}
 }
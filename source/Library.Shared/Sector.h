@@ -6,6 +6,7 @@
 
 #include "WorldState.h"
 #include "Entity.h"
+#include "JobSystem.h"
 
 namespace DOGEngine
 {
@@ -88,6 +89,22 @@ namespace DOGEngine
 		 */
 		void update(WorldState& worldState);
 
+		/**
+		 * @brief Parallel update method for the simulation
+		 *		  loop. Updates this object's Actions on the
+		 *		  calling thread, then submits its child
+		 *		  Entities to the given group in fixed-size
+		 *		  chunks. Each chunk updates its Entities in
+		 *		  order with its own copy of the WorldState.
+		 *
+		 * @param worldState Data of the current simulation
+		 *					 state. Copied into each job.
+		 * @param jobGroup The group the Entity jobs are
+		 *				   submitted to. The caller waits on
+		 *				   it.
+		 */
+		void update(WorldState& worldState, JobSystem::JobGroup& jobGroup);
+
 		/**
 		 * @brief Creates a child Entity.
 		 *
@@ -193,20 +210,39 @@ namespace DOGEngine
 		virtual void populate() override;
 
 		/**
-		 * @brief Updates this class' table's pointers
-		 *		  to external storage.
+		 * @brief Re-resolves the cached child-collection
+		 *		  Datums.
 		 */
 		virtual void updateExternalStorage() override;
 
 	private:
 
+		/**
+		 * @brief Calls update on each child Action.
+		 *
+		 * @param worldState Data of the current simulation
+		 *					 state.
+		 */
+		void updateActions(WorldState& worldState);
+
+		static const std::uint32_t sEntitiesPerJob;
+
 		std::string mName;
 
+		Datum* mEntities;
+		Datum* mActions;
+		Datum* mReactions;
+
 	public:
 
 		const static std::string sNameAttribute;
 		const static std::string sEntitiesAttribute;
 		const static std::string sActionsAttribute;
 		const static std::string sReactionsAttribute;
+
+		const static Symbol sNameSymbol;
+		const static Symbol sEntitiesSymbol;
+		const static Symbol sActionsSymbol;
+		const static Symbol sReactionsSymbol;
 	};
 }
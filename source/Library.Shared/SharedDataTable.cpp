@@ -10,7 +10,9 @@ RTTI_DEFINITIONS(SharedDataTable)
 
 SharedDataTable::SharedDataTable() :
 	SharedData(),
-	mScope(nullptr)
+	mScope(nullptr),
+	mArena(nullptr),
+	mPendingChildren()
 {
 }
 
@@ -18,6 +20,7 @@ SharedDataTable::SharedDataTable() :
 
 SharedDataTable::~SharedDataTable()
 {
+	discardPendingChildren();
 	delete mScope;
 }
 
@@ -34,8 +37,12 @@ void SharedDataTable::initialize()
 {
 	SharedData::initialize();
 
+	discardPendingChildren();
 	delete mScope;
 	mScope = nullptr;
+
+	// subfile jobs run with the arena of the parse that submitted them, so this picks it up too
+	mArena = ScopeArena::current();
 }
 
 //-----------------------------------------------------------------
@@ -51,11 +58,32 @@ void SharedDataTable::setScope(const std::string& name, Scope& child)
 
 //-----------------------------------------------------------------
 
+void SharedDataTable::queueChild(const ChildLoader& loader, const ChildAdopter& adopter)
+{
+	// the entry is heap allocated, so it stays put while the job writes to it
+	PendingChild* pending = &pushPendingChild(adopter);
+	pending->mGroup.submit([pending, loader]()
+	{
+		pending->mChild = loader();
+	});
+}
+
+//-----------------------------------------------------------------
+
+void SharedDataTable::deferChild(const ChildLoader& loader, const ChildAdopter& adopter)
+{
+	pushPendingChild(adopter).mDeferredLoad = loader;
+}
+
+//-----------------------------------------------------------------
+
 void SharedDataTable::setScopeToParent()
 {
 	// scope becomes its parent if there is one
 	if(mScope != nullptr)
 	{
+		adoptPendingChildren(mScope);
+
 		if(mScope->getParent() != nullptr)
 		{
 			mScope = mScope->getParent();
@@ -67,6 +95,9 @@ void SharedDataTable::setScopeToParent()
 
 Scope* SharedDataTable::extractScope()
 {
+	ScopeArena::Activation activation(mArena);
+	adoptPendingChildren(nullptr);
+
 	Scope* scope = mScope;
 	mScope = nullptr;
 
@@ -79,3 +110,82 @@ Scope* SharedDataTable::getScope() const
 {
 	return mScope;
 }
+
+//-----------------------------------------------------------------
+
+void SharedDataTable::setArena(ScopeArena* arena)
+{
+	mArena = arena;
+}
+
+//-----------------------------------------------------------------
+
+ScopeArena* SharedDataTable::getArena() const
+{
+	return mArena;
+}
+
+//-----------------------------------------------------------------
+
+SharedDataTable::PendingChild& SharedDataTable::pushPendingChild(const ChildAdopter& adopter)
+{
+	assert(mScope != nullptr);
+
+	mPendingChildren.push_back(unique_ptr<PendingChild>(new PendingChild()));
+	PendingChild& pending = *mPendingChildren.back();
+	pending.mParent = mScope;
+	pending.mChild = nullptr;
+	pending.mAdopt = adopter;
+
+	return pending;
+}
+
+//-----------------------------------------------------------------
+
+void SharedDataTable::adoptPendingChildren(Scope* parent)
+{
+	// the Scope being left is the innermost open one, so its children are the newest entries
+	size_t first = mPendingChildren.size();
+	while(first > 0 && (parent == nullptr || mPendingChildren[first - 1]->mParent == parent))
+	{
+		--first;
+	}
+
+	// adopted in the order they were queued; on a throw, the rest are left for discardPendingChildren
+	for(size_t i = first; i < mPendingChildren.size(); ++i)
+	{
+		PendingChild& pending = *mPendingChildren[i];
+		pending.mGroup.wait();
+		if(pending.mDeferredLoad)
+		{
+			pending.mChild = pending.mDeferredLoad();
+		}
+
+		assert(pending.mChild != nullptr);
+		pending.mAdopt(*pending.mParent, *pending.mChild);
+		pending.mChild = nullptr;
+	}
+
+	mPendingChildren.erase(mPendingChildren.begin() + first, mPendingChildren.end());
+}
+
+//-----------------------------------------------------------------
+
+void SharedDataTable::discardPendingChildren()
+{
+	for(unique_ptr<PendingChild>& pending : mPendingChildren)
+	{
+		// the parse these belonged to is being thrown away, so their errors are too
+		try
+		{
+			pending->mGroup.wait();
+		}
+		catch(...)
+		{
+		}
+
+		delete pending->mChild;
+	}
+
+	mPendingChildren.clear();
+}
@@ -4,6 +4,7 @@
 #include "RTTI.h"
 #include "XmlParseMaster.h"
 #include "Scope.h"
+#include "JobSystem.h"
 
 namespace DOGEngine
 {
@@ -21,6 +22,16 @@ namespace DOGEngine
 	 *		XmlParseHelperString.h
 	 *		XmlParseHelperVector.h
 	 *		XmlParseHelperMatrix.h
+	 *
+	 * Children whose contents are produced off the parse
+	 * thread (subfiles) are queued on the current Scope
+	 * and adopted, in the order they were queued, when
+	 * the parse moves back up past that Scope. They end
+	 * up after the Scope's inline children.
+	 *
+	 * Scopes are created in the arena that was active
+	 * when the parse started, until a World is parsed;
+	 * from then on they go in the World's own arena.
 	 */
 	class SharedDataTable : public SharedData
 	{
@@ -28,6 +39,9 @@ namespace DOGEngine
 
 	public:
 
+		typedef std::function<Scope*()> ChildLoader;
+		typedef std::function<void(Scope& parent, Scope& child)> ChildAdopter;
+
 		SharedDataTable(const SharedDataTable& other) = delete;
 		SharedDataTable(SharedDataTable&& other) = delete;
 		SharedDataTable& operator=(const SharedDataTable& other) = delete;
@@ -39,7 +53,8 @@ namespace DOGEngine
 		SharedDataTable();
 
 		/**
-		 * @brief Destructor.
+		 * @brief Destructor. Waits for and deletes any
+		 *		  queued children that were never adopted.
 		 */
 		virtual ~SharedDataTable();
 
@@ -54,7 +69,10 @@ namespace DOGEngine
 
 		/**
 		 * @brief Resets the parse depth and table
-		 *		  kept on this object.
+		 *		  kept on this object. Queued children
+		 *		  that were never adopted are discarded.
+		 *		  The arena this thread has active is the
+		 *		  one the new parse creates Scopes in.
 		 */
 		virtual void initialize() override;
 
@@ -68,9 +86,42 @@ namespace DOGEngine
 		 */
 		void setScope(const std::string& name, Scope& child);
 
+		/**
+		 * @brief Queues a child for the current Scope whose
+		 *		  contents are built by a job on the JobSystem.
+		 *
+		 * @param loader Builds the child. Runs on a worker
+		 *				 thread, so it must not touch the Scope
+		 *				 being parsed.
+		 * @param adopter Attaches the built child to the
+		 *				  current Scope. Runs on the parse
+		 *				  thread when the parse leaves it.
+		 *
+		 * @note Anything the loader throws is rethrown on the
+		 *		 parse thread, when the child is adopted.
+		 */
+		void queueChild(const ChildLoader& loader, const ChildAdopter& adopter);
+
+		/**
+		 * @brief Queues a child for the current Scope that is
+		 *		  built on the parse thread, when the parse leaves
+		 *		  the Scope. It is adopted in order with the
+		 *		  children queued by queueChild.
+		 *
+		 * @param loader Builds the child. It may wait on jobs
+		 *				 started by this parse.
+		 * @param adopter Attaches the built child to the
+		 *				  current Scope.
+		 */
+		void deferChild(const ChildLoader& loader, const ChildAdopter& adopter);
+
 		/**
 		 * @brief Moves the current Scope one level up, to its
-		 *		  parent.
+		 *		  parent. Children queued on the current Scope
+		 *		  are waited for and adopted first.
+		 *
+		 * @exception Rethrows anything thrown while building a
+		 *			  queued child.
 		 */
 		void setScopeToParent();
 
@@ -82,6 +133,9 @@ namespace DOGEngine
 		 *
 		 * @note The responsibility of deleting the returned
 		 *		 Scope then belongs to the caller.
+		 *
+		 * @exception Rethrows anything thrown while building a
+		 *			  queued child that had not been adopted yet.
 		 */
 		Scope* extractScope();
 
@@ -96,8 +150,69 @@ namespace DOGEngine
 		 */
 		Scope* getScope() const;
 
+		/**
+		 * @brief Sets the arena the rest of the parse
+		 *		  creates Scopes in.
+		 *
+		 * @param arena The arena, or nullptr for the heap.
+		 */
+		void setArena(ScopeArena* arena);
+
+		/**
+		 * @brief Retrieves the arena the parse creates
+		 *		  Scopes in. Helpers activate it while
+		 *		  they handle an element.
+		 *
+		 * @return Returns the arena, or nullptr for the
+		 *		   heap.
+		 */
+		ScopeArena* getArena() const;
+
 	protected:
 
 		Scope* mScope;
+		ScopeArena* mArena;
+
+	private:
+
+		/**
+		 * A child being built by a job, or waiting to be built
+		 * on the parse thread, and where it goes.
+		 */
+		struct PendingChild
+		{
+			Scope* mParent;
+			Scope* mChild;
+			ChildLoader mDeferredLoad;
+			ChildAdopter mAdopt;
+			JobSystem::JobGroup mGroup;
+		};
+
+		/**
+		 * @brief Appends a child entry for the current Scope
+		 *		  to the queue.
+		 *
+		 * @param adopter Attaches the built child.
+		 *
+		 * @return Returns the new entry.
+		 */
+		PendingChild& pushPendingChild(const ChildAdopter& adopter);
+
+		/**
+		 * @brief Waits for and adopts the queued children of
+		 *		  the given Scope, which are at the back of the
+		 *		  queue since the parse is leaving it.
+		 *
+		 * @param parent The Scope being left, or nullptr to
+		 *				 adopt everything still queued.
+		 */
+		void adoptPendingChildren(Scope* parent);
+
+		/**
+		 * @brief Waits for and deletes every queued child.
+		 */
+		void discardPendingChildren();
+
+		std::vector<std::unique_ptr<PendingChild>> mPendingChildren;
 	};
 }
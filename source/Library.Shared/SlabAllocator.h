@@ -0,0 +1,128 @@
+#pragma once
+
+#include "pch.h"
+
+namespace DOGEngine
+{
+	/**
+	 * Node allocator for the linked containers. Hands out
+	 * storage for one T at a time from contiguous blocks,
+	 * and recycles freed storage through a free list, so a
+	 * container pays one heap allocation per block instead
+	 * of one per element.
+	 *
+	 * Blocks start small and double up to a cap, so tiny
+	 * containers stay tiny. Storage never moves once handed
+	 * out; blocks are only freed by release() or the
+	 * destructor.
+	 *
+	 * Each container owns its own allocator, so there is no
+	 * locking.
+	 *
+	 * SList and HashMap take their allocator as a template
+	 * policy. A policy provides allocate, deallocate,
+	 * release and numHeapAllocations, and is movable but
+	 * not copyable. HeapAllocator is the one-allocation-
+	 * per-node alternative.
+	 */
+	template <typename T>
+	class SlabAllocator final
+	{
+	public:
+
+		/**
+		 * @brief Constructor. No memory is allocated
+		 *		  until the first call to allocate.
+		 */
+		SlabAllocator();
+
+		SlabAllocator(const SlabAllocator& other) = delete;
+		SlabAllocator& operator=(const SlabAllocator& other) = delete;
+
+		/**
+		 * @brief Move constructor. Takes over the other
+		 *		  allocator's blocks, so storage it handed
+		 *		  out now belongs to this one.
+		 *
+		 * @param other The allocator being moved. It is
+		 *				left empty.
+		 */
+		SlabAllocator(SlabAllocator&& other);
+
+		/**
+		 * @brief Move assignment. Frees this allocator's
+		 *		  blocks, then takes over the other's.
+		 *
+		 * @param other The allocator being moved. It is
+		 *				left empty.
+		 *
+		 * @return Returns a reference to this.
+		 */
+		SlabAllocator& operator=(SlabAllocator&& other);
+
+		/**
+		 * @brief Destructor. Frees every block.
+		 */
+		~SlabAllocator();
+
+		/**
+		 * @brief Getter for uninitialized storage for one
+		 *		  T. Reuses freed storage first, then the
+		 *		  rest of the newest block, and only then
+		 *		  allocates a new block.
+		 *
+		 * @return Returns a pointer to the storage.
+		 */
+		void* allocate();
+
+		/**
+		 * @brief Returns storage to the free list. The T
+		 *		  in it must already be destroyed.
+		 *
+		 * @param memory Storage from this allocator.
+		 */
+		void deallocate(void* memory);
+
+		/**
+		 * @brief Frees every block at once. Everything
+		 *		  this allocator handed out must already
+		 *		  be destroyed.
+		 */
+		void release();
+
+		/**
+		 * @brief Getter for how many heap allocations this
+		 *		  allocator has made over its lifetime.
+		 *
+		 * @return Returns the number of blocks allocated.
+		 */
+		std::uint32_t numHeapAllocations() const;
+
+	private:
+
+		/**
+		 * One unit of storage. Holds a T while handed out,
+		 * and the link to the next free unit while free.
+		 * The first unit of each block holds the link to
+		 * the previous block instead.
+		 */
+		union Unit
+		{
+			Unit* mNext;
+			typename std::aligned_storage<sizeof(T), alignof(T)>::type mStorage;
+		};
+
+		static const std::uint32_t sInitialBlockSize = 8;
+		static const std::uint32_t sMaxBlockSize = 1024;
+
+		Unit* mBlocks;
+		Unit* mFree;
+		Unit* mBump;
+		Unit* mBumpEnd;
+
+		std::uint32_t mNextBlockSize;
+		std::uint32_t mNumHeapAllocations;
+	};
+}
+
+#include "SlabAllocator.inl"
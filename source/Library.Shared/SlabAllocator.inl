@@ -0,0 +1,132 @@
+
+namespace DOGEngine
+{
+	template <typename T>
+	SlabAllocator<T>::SlabAllocator() :
+		mBlocks(nullptr),
+		mFree(nullptr),
+		mBump(nullptr),
+		mBumpEnd(nullptr),
+		mNextBlockSize(sInitialBlockSize),
+		mNumHeapAllocations(0)
+	{
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename T>
+	SlabAllocator<T>::SlabAllocator(SlabAllocator&& other) :
+		mBlocks(nullptr),
+		mFree(nullptr),
+		mBump(nullptr),
+		mBumpEnd(nullptr),
+		mNextBlockSize(sInitialBlockSize),
+		mNumHeapAllocations(0)
+	{
+		operator=(std::move(other));
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename T>
+	SlabAllocator<T>& SlabAllocator<T>::operator=(SlabAllocator&& other)
+	{
+		if(this != &other)
+		{
+			release();
+
+			mBlocks = other.mBlocks;
+			mFree = other.mFree;
+			mBump = other.mBump;
+			mBumpEnd = other.mBumpEnd;
+			mNextBlockSize = other.mNextBlockSize;
+			mNumHeapAllocations = other.mNumHeapAllocations;
+
+			other.mBlocks = nullptr;
+			other.mFree = nullptr;
+			other.mBump = nullptr;
+			other.mBumpEnd = nullptr;
+			other.mNextBlockSize = sInitialBlockSize;
+			other.mNumHeapAllocations = 0;
+		}
+
+		return *this;
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename T>
+	SlabAllocator<T>::~SlabAllocator()
+	{
+		release();
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename T>
+	void* SlabAllocator<T>::allocate()
+	{
+		// recycled storage first -- it is the most likely to still be in cache
+		if(mFree != nullptr)
+		{
+			Unit* unit = mFree;
+			mFree = unit->mNext;
+			return unit;
+		}
+
+		if(mBump == mBumpEnd)
+		{
+			// unit 0 links the blocks together, the rest are handed out in order
+			Unit* block = static_cast<Unit*>(::operator new(sizeof(Unit) * (mNextBlockSize + 1)));
+			block->mNext = mBlocks;
+			mBlocks = block;
+
+			mBump = block + 1;
+			mBumpEnd = mBump + mNextBlockSize;
+
+			if(mNextBlockSize < sMaxBlockSize)
+			{
+				mNextBlockSize *= 2;
+			}
+			++mNumHeapAllocations;
+		}
+
+		return mBump++;
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename T>
+	void SlabAllocator<T>::deallocate(void* memory)
+	{
+		Unit* unit = static_cast<Unit*>(memory);
+		unit->mNext = mFree;
+		mFree = unit;
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename T>
+	void SlabAllocator<T>::release()
+	{
+		while(mBlocks != nullptr)
+		{
+			Unit* block = mBlocks;
+			mBlocks = block->mNext;
+			::operator delete(block);
+		}
+
+		mFree = nullptr;
+		mBump = nullptr;
+		mBumpEnd = nullptr;
+		mNextBlockSize = sInitialBlockSize;
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename T>
+	std::uint32_t SlabAllocator<T>::numHeapAllocations() const
+	{
+		return mNumHeapAllocations;
+	}
+}
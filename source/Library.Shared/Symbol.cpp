@@ -0,0 +1,135 @@
+#include "pch.h"
+#include "Symbol.h"
+
+#include "HashMap.h"
+#include "Vector.h"
+
+#include <shared_mutex>
+
+using namespace DOGEngine;
+using namespace std;
+
+const uint32_t Symbol::sInvalidId = UINT32_MAX;
+
+/**
+ * Name-to-id map plus the reverse lookup. The names
+ * vector and every Symbol point at the map's keys, which
+ * stay put since HashMap never moves its pairs.
+ *
+ * Lookups only read, so they share the lock; the Xml
+ * parses running on the JobSystem look up every element
+ * name they meet.
+ */
+struct Symbol::SymbolTable
+{
+	shared_timed_mutex mMutex;
+	HashMap<string, uint32_t, HashFunc<string>, CompareFunc<string>, HeapAllocator> mIds;
+	Vector<const string*> mNames;
+};
+
+//-----------------------------------------------------------------
+
+Symbol::Symbol() :
+	mId(sInvalidId), mName(nullptr)
+{
+}
+
+//-----------------------------------------------------------------
+
+Symbol::Symbol(const string& name) :
+	mId(sInvalidId), mName(nullptr)
+{
+	// most names are already interned, so look them up under the shared lock first
+	*this = lookup(name);
+
+	if(!isValid())
+	{
+		SymbolTable& symbolTable = table();
+		lock_guard<shared_timed_mutex> lock(symbolTable.mMutex);
+
+		// look before inserting so interning a known name doesn't copy the string
+		auto iter = symbolTable.mIds.find(name);
+		if(iter == symbolTable.mIds.end())
+		{
+			iter = symbolTable.mIds.insert(make_pair(name, symbolTable.mNames.size()));
+			symbolTable.mNames.pushBack(&iter->first);
+		}
+		mId = iter->second;
+		mName = &iter->first;
+	}
+}
+
+//-----------------------------------------------------------------
+
+bool Symbol::operator==(const Symbol& other) const
+{
+	return mId == other.mId;
+}
+
+//-----------------------------------------------------------------
+
+bool Symbol::operator!=(const Symbol& other) const
+{
+	return !operator==(other);
+}
+
+//-----------------------------------------------------------------
+
+uint32_t Symbol::id() const
+{
+	return mId;
+}
+
+//-----------------------------------------------------------------
+
+const string& Symbol::name() const
+{
+	if(!isValid())
+	{
+		throw exception("Error -- cannot get the name of an invalid Symbol!");
+	}
+
+	return *mName;
+}
+
+//-----------------------------------------------------------------
+
+bool Symbol::isValid() const
+{
+	return mId != sInvalidId;
+}
+
+//-----------------------------------------------------------------
+
+Symbol Symbol::lookup(const string& name)
+{
+	SymbolTable& symbolTable = table();
+	shared_lock<shared_timed_mutex> lock(symbolTable.mMutex);
+
+	Symbol symbol;
+	auto iter = symbolTable.mIds.find(name);
+	if(iter != symbolTable.mIds.end())
+	{
+		symbol.mId = iter->second;
+		symbol.mName = &iter->first;
+	}
+
+	return symbol;
+}
+
+//-----------------------------------------------------------------
+
+uint32_t Symbol::numSymbols()
+{
+	SymbolTable& symbolTable = table();
+	shared_lock<shared_timed_mutex> lock(symbolTable.mMutex);
+	return symbolTable.mNames.size();
+}
+
+//-----------------------------------------------------------------
+
+Symbol::SymbolTable& Symbol::table()
+{
+	static SymbolTable sTable;
+	return sTable;
+}
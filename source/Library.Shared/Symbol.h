@@ -0,0 +1,132 @@
+#pragma once
+
+#include "pch.h"
+
+namespace DOGEngine
+{
+	/**
+	 * Compact handle for an interned string. Every distinct
+	 * name is stored once in a global table and handed a
+	 * small integer id, so two Symbols compare with a single
+	 * integer compare instead of a string compare.
+	 *
+	 * Scope accepts Symbols in place of string keys. Classes
+	 * with prescribed attributes keep their attribute names
+	 * as static Symbols so per-frame lookups never hash a
+	 * string.
+	 *
+	 * The table is thread-safe, and lookups of names that
+	 * are already interned share its lock. Each Symbol also
+	 * keeps the address of its interned string, so name()
+	 * never has to go back to the table.
+	 *
+	 * Names are never released: an id and its string stay
+	 * valid for the life of the process.
+	 */
+	class Symbol final
+	{
+	public:
+
+		/**
+		 * @brief Default constructor. Creates an invalid
+		 *		  Symbol that names nothing.
+		 */
+		Symbol();
+
+		/**
+		 * @brief Constructor. Interns the given name,
+		 *		  adding it to the table if it is new.
+		 *
+		 * @param name The string to intern.
+		 */
+		explicit Symbol(const std::string& name);
+
+		Symbol(const Symbol& other) = default;
+		Symbol& operator=(const Symbol& other) = default;
+
+		/**
+		 * @brief Equality operator.
+		 *
+		 * @param other The Symbol to which we are comparing.
+		 *
+		 * @return Returns true if both Symbols name the same
+		 *		   string.
+		 */
+		bool operator==(const Symbol& other) const;
+
+		/**
+		 * @brief Inequality operator.
+		 *
+		 * @param other The Symbol to which we are comparing.
+		 *
+		 * @return Returns true if the Symbols name different
+		 *		   strings.
+		 */
+		bool operator!=(const Symbol& other) const;
+
+		/**
+		 * @brief Getter for this Symbol's interned id.
+		 *
+		 * @return Returns the id, or Symbol::sInvalidId if
+		 *		   this Symbol is invalid.
+		 */
+		std::uint32_t id() const;
+
+		/**
+		 * @brief Getter for the string this Symbol names.
+		 *
+		 * @return Returns a reference to the interned string,
+		 *		   which is never moved or freed.
+		 *
+		 * @note Does not lock the table.
+		 *
+		 * @exception Throws an exception if this Symbol is
+		 *			  invalid.
+		 */
+		const std::string& name() const;
+
+		/**
+		 * @brief Says whether this Symbol names a string.
+		 *
+		 * @return Returns false for default-constructed
+		 *		   Symbols and failed lookups.
+		 */
+		bool isValid() const;
+
+		/**
+		 * @brief Looks up a name without interning it.
+		 *
+		 * @param name The string to look up.
+		 *
+		 * @return Returns the Symbol for the name if it has
+		 *		   already been interned. Otherwise, returns an
+		 *		   invalid Symbol.
+		 */
+		static Symbol lookup(const std::string& name);
+
+		/**
+		 * @brief Getter for the number of interned names.
+		 *
+		 * @return Returns the size of the table.
+		 */
+		static std::uint32_t numSymbols();
+
+		static const std::uint32_t sInvalidId;
+
+	private:
+
+		struct SymbolTable;
+
+		/**
+		 * @brief Getter for the global table. Created on
+		 *		  first use, so static Symbols in any
+		 *		  translation unit can intern safely.
+		 *
+		 * @return Returns a reference to the table.
+		 */
+		static SymbolTable& table();
+
+		std::uint32_t mId;
+		const std::string* mName;
+	};
+}
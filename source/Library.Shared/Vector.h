@@ -5,12 +5,70 @@
 
 namespace DOGEngine
 {
+#pragma region Vector Traits
+
+	/**
+	 * Says whether a type can be moved to a new address
+	 * with a plain memcpy (and its old copy forgotten
+	 * without running its destructor). Vector grows with
+	 * memcpy for these types, and with move construction
+	 * for everything else.
+	 *
+	 * Defaults to trivially copyable types. Specialize it
+	 * for types that own heap data but never point into
+	 * themselves.
+	 */
+	template <typename T>
+	struct IsTriviallyRelocatable : std::is_trivially_copyable<T>
+	{
+	};
+
+	/**
+	 * Default growth strategy for Vector. Doubles the
+	 * capacity.
+	 *
+	 * A growth strategy is a functor that takes the
+	 * current capacity and returns a larger one.
+	 */
+	struct DoubleGrowth
+	{
+		std::uint32_t operator()(std::uint32_t capacity) const;
+	};
+
+	/**
+	 * Growth strategy that grows the capacity by half.
+	 * Wastes less space than doubling, at the cost of
+	 * more reallocations.
+	 */
+	struct HalfGrowth
+	{
+		std::uint32_t operator()(std::uint32_t capacity) const;
+	};
+
+	/**
+	 * Growth strategy that grows the capacity by a fixed
+	 * number of elements, for Vectors whose final size is
+	 * roughly known.
+	 */
+	template <std::uint32_t TIncrement>
+	struct FixedGrowth
+	{
+		static_assert(TIncrement > 0, "FixedGrowth needs a non-zero increment");
+
+		std::uint32_t operator()(std::uint32_t capacity) const;
+	};
+
+#pragma endregion
+
 	/**
 	 * Templated container class. Stores a dynamically-
 	 * sized contiguous array of templated objects for
 	 * random access of stored elements.
+	 *
+	 * When full, the array grows to the capacity that the
+	 * TGrowth functor picks.
 	 */
-	template <typename T>
+	template <typename T, typename TGrowth = DoubleGrowth>
 	class Vector final
 	{
 	public:
@@ -348,12 +406,38 @@ namespace DOGEngine
 		 *
 		 * @note If the Vector's size and capacity are the same, 
 		 *		 this method automatically allocates more space 
-		 *		 for the Vector array using reserve(). The size
-		 *		 of the reserved space grows by half of the old
-		 *		 allocation's size.
+		 *		 for the Vector array. The new capacity comes
+		 *		 from the TGrowth functor.
 		 */
 		void pushBack(const T& data);
 
+		/**
+		 * @brief Moves the given data onto the back of the
+		 *		  Vector.
+		 *
+		 * @param data The data being added to the Vector.
+		 *			   It is left in a moved-from state.
+		 *
+		 * @note Grows the array the same way as the copying
+		 *		 pushBack.
+		 */
+		void pushBack(T&& data);
+
+		/**
+		 * @brief Constructs a new element in place at the
+		 *		  back of the Vector.
+		 *
+		 * @param args The arguments for T's constructor.
+		 *			   They may refer to elements of this
+		 *			   Vector.
+		 *
+		 * @return Returns a reference to the new element.
+		 *
+		 * @note Grows the array the same way as pushBack.
+		 */
+		template <typename... TArgs>
+		T& emplaceBack(TArgs&&... args);
+
 		/**
 		 * @brief Removes the last element from the Vector.
 		 *
@@ -480,6 +564,34 @@ namespace DOGEngine
 		 */
 		void performDeepCopy(const Vector& other);
 
+		/**
+		 * @brief Moves the stored elements into a new
+		 *		  allocation of the given capacity, then
+		 *		  frees the old one.
+		 *
+		 * @param newCapacity The capacity of the new array.
+		 *					  Must be at least size().
+		 */
+		void reallocate(std::uint32_t newCapacity);
+
+		/**
+		 * @brief Moves the stored elements into the given
+		 *		  uninitialized array with memcpy. Used for
+		 *		  trivially relocatable types.
+		 *
+		 * @param newArray The destination array.
+		 */
+		void relocate(T* newArray, std::true_type);
+
+		/**
+		 * @brief Moves the stored elements into the given
+		 *		  uninitialized array one by one, destroying
+		 *		  the originals.
+		 *
+		 * @param newArray The destination array.
+		 */
+		void relocate(T* newArray, std::false_type);
+
 		T* mArray;
 
 		std::uint32_t mSize;
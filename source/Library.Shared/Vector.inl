@@ -4,8 +4,8 @@ namespace DOGEngine
 
 #pragma region Vector
 
-	template <typename T>
-	Vector<T>::Vector(const std::uint32_t capacity) :
+	template <typename T, typename TGrowth>
+	Vector<T, TGrowth>::Vector(const std::uint32_t capacity) :
 		mArray(nullptr),
 		mSize(0),
 		mCapacity(0)
@@ -16,8 +16,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	Vector<T>::Vector(const Vector& other) :
+	template <typename T, typename TGrowth>
+	Vector<T, TGrowth>::Vector(const Vector& other) :
 		mArray(nullptr),
 		mSize(0),
 		mCapacity(0)
@@ -27,8 +27,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	Vector<T>& Vector<T>::operator=(const Vector& other)
+	template <typename T, typename TGrowth>
+	Vector<T, TGrowth>& Vector<T, TGrowth>::operator=(const Vector& other)
 	{
 		if(this != &other)
 		{
@@ -46,8 +46,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	Vector<T>::Vector(Vector&& other) :
+	template <typename T, typename TGrowth>
+	Vector<T, TGrowth>::Vector(Vector&& other) :
 		mArray(other.mArray),
 		mSize(other.mSize),
 		mCapacity(other.mCapacity)
@@ -59,8 +59,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	Vector<T>& Vector<T>::operator=(Vector&& other)
+	template <typename T, typename TGrowth>
+	Vector<T, TGrowth>& Vector<T, TGrowth>::operator=(Vector&& other)
 	{
 		if(&other != this)
 		{
@@ -82,8 +82,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	Vector<T>::~Vector()
+	template <typename T, typename TGrowth>
+	Vector<T, TGrowth>::~Vector()
 	{
 		// we only need to free() mArray after clear() because clearing the vector
 		// has already destroyed all the elements
@@ -94,8 +94,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	T& Vector<T>::operator[](const std::uint32_t index)
+	template <typename T, typename TGrowth>
+	T& Vector<T, TGrowth>::operator[](const std::uint32_t index)
 	{
 		if(index >= mSize)
 		{
@@ -107,8 +107,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	const T& Vector<T>::operator[](const std::uint32_t index) const
+	template <typename T, typename TGrowth>
+	const T& Vector<T, TGrowth>::operator[](const std::uint32_t index) const
 	{
 		if(index >= mSize)
 		{
@@ -120,44 +120,31 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	void Vector<T>::reserve(const std::uint32_t reserveSize)
+	template <typename T, typename TGrowth>
+	void Vector<T, TGrowth>::reserve(const std::uint32_t reserveSize)
 	{
 		// only need to reserve space if we're requesting more space than we already have
 		if(reserveSize > mCapacity)
 		{
-			// create new allocation and shallow-copy data from old to new buffers
-			T* newArray = reinterpret_cast<T*>(malloc(reserveSize * sizeof(T)));
-			memcpy(newArray, mArray, mCapacity * sizeof(T));
-
-			// we're done using the old allocation, so we free it
-			//		we don't call the destructors on the old copies of the stored objects because
-			//		this would invalidate pointers to heap-allocated data that the new copies may have
-			free(mArray);
-
-			mArray = newArray;
-			mCapacity = reserveSize;
+			reallocate(reserveSize);
 		}
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	void Vector<T>::shrinkToFit()
+	template <typename T, typename TGrowth>
+	void Vector<T, TGrowth>::shrinkToFit()
 	{
-		T* newArray = reinterpret_cast<T*>(malloc(mSize * sizeof(T)));
-		memcpy(newArray, mArray, mSize * sizeof(T));
-
-		free(mArray);
-
-		mArray = newArray;
-		mCapacity = mSize;
+		if(mSize < mCapacity)
+		{
+			reallocate(mSize);
+		}
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	typename Vector<T>::Iterator Vector<T>::find(const T& data) const
+	template <typename T, typename TGrowth>
+	typename Vector<T, TGrowth>::Iterator Vector<T, TGrowth>::find(const T& data) const
 	{
 		Iterator iter;
 		Iterator endIter = end();
@@ -174,8 +161,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	T& Vector<T>::at(const std::uint32_t index)
+	template <typename T, typename TGrowth>
+	T& Vector<T, TGrowth>::at(const std::uint32_t index)
 	{
 		if(index >= mSize)
 		{
@@ -187,8 +174,8 @@ namespace DOGEngine
 	
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	const T& Vector<T>::at(const std::uint32_t index) const
+	template <typename T, typename TGrowth>
+	const T& Vector<T, TGrowth>::at(const std::uint32_t index) const
 	{
 		if(index >= mSize)
 		{
@@ -200,8 +187,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	T& Vector<T>::front()
+	template <typename T, typename TGrowth>
+	T& Vector<T, TGrowth>::front()
 	{
 		if(isEmpty())
 		{
@@ -213,8 +200,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	const T& Vector<T>::front() const
+	template <typename T, typename TGrowth>
+	const T& Vector<T, TGrowth>::front() const
 	{
 		if(isEmpty())
 		{
@@ -226,8 +213,8 @@ namespace DOGEngine
 	
 	//-----------------------------------------------------------------
 	
-	template <typename T>
-	T& Vector<T>::back()
+	template <typename T, typename TGrowth>
+	T& Vector<T, TGrowth>::back()
 	{
 		if(isEmpty())
 		{
@@ -239,8 +226,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	const T& Vector<T>::back() const
+	template <typename T, typename TGrowth>
+	const T& Vector<T, TGrowth>::back() const
 	{
 		if(isEmpty())
 		{
@@ -252,27 +239,65 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	void Vector<T>::pushBack(const T& data)
+	template <typename T, typename TGrowth>
+	void Vector<T, TGrowth>::pushBack(const T& data)
+	{
+		emplaceBack(data);
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename T, typename TGrowth>
+	void Vector<T, TGrowth>::pushBack(T&& data)
+	{
+		emplaceBack(std::move(data));
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename T, typename TGrowth>
+	template <typename... TArgs>
+	T& Vector<T, TGrowth>::emplaceBack(TArgs&&... args)
 	{
-		// the array is as big as our capacity, we need to allocate more space for the array
-		//		if capacity is 0, then we create an array of size 1
-		if(mSize == mCapacity)
+		if(mSize < mCapacity)
+		{
+			// create a new element using mSize as an offset from mArray's address
+			// this element is destroyed when popped off the Vector with popBack()
+			new(mArray + mSize)T(std::forward<TArgs>(args)...);
+			return mArray[mSize++];
+		}
+
+		// the array is as big as our capacity, so we need a bigger one
+		//		the new element is built there first, since args may still point into the old array
+		std::uint32_t newCapacity = TGrowth()(mCapacity);
+		if(newCapacity <= mCapacity)
+		{
+			throw std::exception("Error -- the Vector's growth strategy did not grow its capacity!");
+		}
+
+		T* newArray = reinterpret_cast<T*>(malloc(newCapacity * sizeof(T)));
+		try
+		{
+			new(newArray + mSize)T(std::forward<TArgs>(args)...);
+		}
+		catch(...)
 		{
-			std::uint32_t reserveSize = std::max<std::uint32_t>(1, mCapacity * 2);
-			reserve(reserveSize);
+			free(newArray);
+			throw;
 		}
 
-		// create a new element using mSize as an offset from mArray's address
-		// this element is destroyed when popped off the Vector with popBack()
-		new(mArray + mSize)T(data);
-		++mSize;
+		relocate(newArray, IsTriviallyRelocatable<T>());
+		free(mArray);
+
+		mArray = newArray;
+		mCapacity = newCapacity;
+		return mArray[mSize++];
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	void Vector<T>::popBack()
+	template <typename T, typename TGrowth>
+	void Vector<T, TGrowth>::popBack()
 	{
 		if(!isEmpty())
 		{
@@ -283,8 +308,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	bool Vector<T>::remove(const T& data)
+	template <typename T, typename TGrowth>
+	bool Vector<T, TGrowth>::remove(const T& data)
 	{
 		bool result = false;
 
@@ -304,8 +329,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	void Vector<T>::remove(Iterator start, Iterator finish)
+	template <typename T, typename TGrowth>
+	void Vector<T, TGrowth>::remove(Iterator start, Iterator finish)
 	{
 		// problem if the Iterator owners are bad
 		if(start.mOwner != this || finish.mOwner != this)
@@ -322,7 +347,7 @@ namespace DOGEngine
 
 		while(finish.mIndex < mSize)
 		{
-			*start = *finish;
+			*start = std::move(*finish);
 			++start;
 			++finish;
 		}
@@ -335,8 +360,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	void Vector<T>::clear()
+	template <typename T, typename TGrowth>
+	void Vector<T, TGrowth>::clear()
 	{
 		while(!isEmpty())
 		{
@@ -346,64 +371,64 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	std::uint32_t Vector<T>::size() const
+	template <typename T, typename TGrowth>
+	std::uint32_t Vector<T, TGrowth>::size() const
 	{
 		return mSize;
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	std::uint32_t Vector<T>::capacity() const
+	template <typename T, typename TGrowth>
+	std::uint32_t Vector<T, TGrowth>::capacity() const
 	{
 		return mCapacity;
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	bool Vector<T>::isEmpty() const
+	template <typename T, typename TGrowth>
+	bool Vector<T, TGrowth>::isEmpty() const
 	{
 		return mSize == 0;
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	typename Vector<T>::Iterator Vector<T>::begin()
+	template <typename T, typename TGrowth>
+	typename Vector<T, TGrowth>::Iterator Vector<T, TGrowth>::begin()
 	{
 		return Iterator(this, 0);
 	}
 	
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	typename const Vector<T>::Iterator Vector<T>::begin() const
+	template <typename T, typename TGrowth>
+	typename const Vector<T, TGrowth>::Iterator Vector<T, TGrowth>::begin() const
 	{
 		return Iterator(this, 0);
 	}
 	
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	typename Vector<T>::Iterator Vector<T>::end()
+	template <typename T, typename TGrowth>
+	typename Vector<T, TGrowth>::Iterator Vector<T, TGrowth>::end()
 	{
 		return Iterator(this, mSize);
 	}
 	
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	typename const Vector<T>::Iterator Vector<T>::end() const
+	template <typename T, typename TGrowth>
+	typename const Vector<T, TGrowth>::Iterator Vector<T, TGrowth>::end() const
 	{
 		return Iterator(this, mSize);
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	void Vector<T>::performDeepCopy(const Vector& other)
+	template <typename T, typename TGrowth>
+	void Vector<T, TGrowth>::performDeepCopy(const Vector& other)
 	{
 		// reserve space equal to other's capacity, then copy other's data
 		reserve(other.mCapacity);
@@ -413,14 +438,52 @@ namespace DOGEngine
 		}
 	}
 
+	//-----------------------------------------------------------------
+
+	template <typename T, typename TGrowth>
+	void Vector<T, TGrowth>::reallocate(std::uint32_t newCapacity)
+	{
+		T* newArray = reinterpret_cast<T*>(malloc(newCapacity * sizeof(T)));
+		relocate(newArray, IsTriviallyRelocatable<T>());
+
+		free(mArray);
+
+		mArray = newArray;
+		mCapacity = newCapacity;
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename T, typename TGrowth>
+	void Vector<T, TGrowth>::relocate(T* newArray, std::true_type)
+	{
+		// the old copies are simply forgotten -- running their destructors would free what the new copies now own
+		if(mSize > 0)
+		{
+			memcpy(newArray, mArray, mSize * sizeof(T));
+		}
+	}
+
+	//-----------------------------------------------------------------
+
+	template <typename T, typename TGrowth>
+	void Vector<T, TGrowth>::relocate(T* newArray, std::false_type)
+	{
+		for(std::uint32_t i = 0; i < mSize; ++i)
+		{
+			new(newArray + i)T(std::move(mArray[i]));
+			mArray[i].~T();
+		}
+	}
+
 #pragma endregion
 
 	//=================================================================
 
 #pragma region Vector::Iterator
 
-	template <typename T>
-	Vector<T>::Iterator::Iterator() :
+	template <typename T, typename TGrowth>
+	Vector<T, TGrowth>::Iterator::Iterator() :
 		mOwner(nullptr),
 		mIndex(0)
 	{
@@ -428,8 +491,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	Vector<T>::Iterator::Iterator(const Vector* owner, std::uint32_t index) :
+	template <typename T, typename TGrowth>
+	Vector<T, TGrowth>::Iterator::Iterator(const Vector* owner, std::uint32_t index) :
 		mOwner(owner),
 		mIndex(index)
 	{
@@ -437,8 +500,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	Vector<T>::Iterator::Iterator(const Iterator& other) :
+	template <typename T, typename TGrowth>
+	Vector<T, TGrowth>::Iterator::Iterator(const Iterator& other) :
 		mOwner(other.mOwner),
 		mIndex(other.mIndex)
 	{
@@ -446,15 +509,15 @@ namespace DOGEngine
 	
 	//-----------------------------------------------------------------
 	
-	template <typename T>
-	Vector<T>::Iterator::~Iterator()
+	template <typename T, typename TGrowth>
+	Vector<T, TGrowth>::Iterator::~Iterator()
 	{
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	typename Vector<T>::Iterator& Vector<T>::Iterator::operator=(const Iterator& other)
+	template <typename T, typename TGrowth>
+	typename Vector<T, TGrowth>::Iterator& Vector<T, TGrowth>::Iterator::operator=(const Iterator& other)
 	{
 		if(this != &other)
 		{
@@ -467,24 +530,24 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	bool Vector<T>::Iterator::operator==(const Iterator& other) const
+	template <typename T, typename TGrowth>
+	bool Vector<T, TGrowth>::Iterator::operator==(const Iterator& other) const
 	{
 		return mOwner == other.mOwner && mIndex == other.mIndex;
 	}
 	
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	bool Vector<T>::Iterator::operator!=(const Iterator& other) const
+	template <typename T, typename TGrowth>
+	bool Vector<T, TGrowth>::Iterator::operator!=(const Iterator& other) const
 	{
 		return !operator==(other);
 	}
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	typename Vector<T>::Iterator& Vector<T>::Iterator::operator++()
+	template <typename T, typename TGrowth>
+	typename Vector<T, TGrowth>::Iterator& Vector<T, TGrowth>::Iterator::operator++()
 	{
 		if(mOwner == nullptr)
 		{
@@ -502,8 +565,8 @@ namespace DOGEngine
 	
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	typename Vector<T>::Iterator Vector<T>::Iterator::operator++(int)
+	template <typename T, typename TGrowth>
+	typename Vector<T, TGrowth>::Iterator Vector<T, TGrowth>::Iterator::operator++(int)
 	{
 		Iterator savedIterator = *this;
 		operator++();
@@ -513,8 +576,8 @@ namespace DOGEngine
 
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	T& Vector<T>::Iterator::operator*()
+	template <typename T, typename TGrowth>
+	T& Vector<T, TGrowth>::Iterator::operator*()
 	{
 		// can't dereference an Iterator with no owner
 		if(mOwner == nullptr)
@@ -533,8 +596,8 @@ namespace DOGEngine
 	
 	//-----------------------------------------------------------------
 
-	template <typename T>
-	const T& Vector<T>::Iterator::operator*() const
+	template <typename T, typename TGrowth>
+	const T& Vector<T, TGrowth>::Iterator::operator*() const
 	{
 		// can't dereference an Iterator with no owner
 		if(mOwner == nullptr)
@@ -551,6 +614,34 @@ namespace DOGEngine
 		return mOwner->mArray[mIndex];
 	}
 
+#pragma endregion
+
+	//=================================================================
+
+#pragma region Growth Functors
+
+	inline std::uint32_t DoubleGrowth::operator()(std::uint32_t capacity) const
+	{
+		// an empty Vector starts with room for one
+		return capacity == 0 ? 1 : capacity * 2;
+	}
+
+	//-----------------------------------------------------------------
+
+	inline std::uint32_t HalfGrowth::operator()(std::uint32_t capacity) const
+	{
+		// small capacities would round the half down to nothing
+		return capacity < 2 ? capacity + 1 : capacity + capacity / 2;
+	}
+
+	//-----------------------------------------------------------------
+
+	template <std::uint32_t TIncrement>
+	inline std::uint32_t FixedGrowth<TIncrement>::operator()(std::uint32_t capacity) const
+	{
+		return capacity + TIncrement;
+	}
+
 #pragma endregion
 
 }
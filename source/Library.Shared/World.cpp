@@ -12,16 +12,21 @@ const string World::sSectorsAttribute = "sectors";
 const string World::sActionsAttribute = "actions";
 const string World::sReactionsAttribute = "reactions";
 
+const Symbol World::sNameSymbol(World::sNameAttribute);
+const Symbol World::sSectorsSymbol(World::sSectorsAttribute);
+const Symbol World::sActionsSymbol(World::sActionsAttribute);
+const Symbol World::sReactionsSymbol(World::sReactionsAttribute);
+
 World::World(const string& name) :
 	Attributed(),
+	mArena(new ScopeArena()),
 	mPendingDelete(),
+	mPendingCreate(),
 	mEventQueue(),
-	mState()
+	mState(),
+	mIsParallelUpdate(false)
 {
-	if(!areSignaturesInitialized())
-	{
-		initSignatures();
-	}
+	initSignaturesOnce();
 	populate();
 
 	// set name to the argument if we were given one (populate sets name to some default value)
@@ -35,8 +40,10 @@ World::World(const string& name) :
 
 World::World(const World& other) :
 	Attributed(other),
+	mArena(new ScopeArena()),
 	mEventQueue(other.mEventQueue),
-	mName(other.mName)
+	mName(other.mName),
+	mIsParallelUpdate(other.mIsParallelUpdate)
 {
 	updateExternalStorage();
 }
@@ -50,10 +57,12 @@ World& World::operator=(const World& other)
 		// we lose the objects this points to, so we just clear it
 		//		don't copy it, because we don't manage what 'other' has
 		mPendingDelete.clear();
+		mPendingCreate.clear();
 
 		Attributed::operator=(other);
 		mEventQueue = other.mEventQueue;
 		mName = other.mName;
+		mIsParallelUpdate = other.mIsParallelUpdate;
 
 		updateExternalStorage();
 	}
@@ -70,7 +79,8 @@ Scope* World::copy()
 
 //-----------------------------------------------------------------
 
-World::World(World&& other)
+World::World(World&& other) :
+	mArena(new ScopeArena())
 {
 	operator=(std::move(other));
 }
@@ -82,10 +92,15 @@ World& World::operator=(World&& other)
 	if(this != &other)
 	{
 		mName = other.mName;
+		mIsParallelUpdate = other.mIsParallelUpdate;
 		mEventQueue = std::move(other.mEventQueue);
 		mPendingDelete = std::move(other.mPendingDelete);
+		mPendingCreate = std::move(other.mPendingCreate);
 
 		Attributed::operator=(std::move(other));
+
+		// the moved Scopes may live in the other arena, and ours has only the ones just destroyed
+		std::swap(mArena, other.mArena);
 	}
 
 	return *this;
@@ -95,6 +110,9 @@ World& World::operator=(World&& other)
 
 World::~World()
 {
+	// the arena destroys its Scopes in one pass, so clear only lets go of the ones that were ours
+	mArena->destroyScopes();
+	clear();
 }
 
 //-----------------------------------------------------------------
@@ -102,6 +120,11 @@ World::~World()
 void World::update()
 {
 	mState.world = this;
+	mState.sector = nullptr;
+	mState.entity = nullptr;
+	mState.sectorIndex = 0;
+	mState.entityIndex = 0;
+	mState.deferSequence = 0;
 
 	// call update on each child action in this world
 	Datum& actions = getActions();
@@ -112,18 +135,42 @@ void World::update()
 
 	// call update on each child sector in this world
 	Datum& sectors = getSectors();
-	for(uint32_t i = 0; i < sectors.size(); ++i)
+	if(mIsParallelUpdate)
 	{
-		static_cast<Sector*>(&sectors[i])->update(mState);
+		updateSectorsParallel(sectors);
+	}
+	else
+	{
+		for(uint32_t i = 0; i < sectors.size(); ++i)
+		{
+			mState.sectorIndex = i + 1;
+			static_cast<Sector*>(&sectors[i])->update(mState);
+		}
 	}
 
 	// update queues
+	//		creates go before deletes, since a new action's parent may itself be pending delete
 	mEventQueue.update(mState.gameTime);
+	mPendingCreate.empty();
 	mPendingDelete.empty();
 }
 
 //-----------------------------------------------------------------
 
+void World::setParallelUpdate(bool isParallel)
+{
+	mIsParallelUpdate = isParallel;
+}
+
+//-----------------------------------------------------------------
+
+bool World::isParallelUpdate() const
+{
+	return mIsParallelUpdate;
+}
+
+//-----------------------------------------------------------------
+
 Sector* World::createSector(const string& name)
 {
 	Sector* sector = new Sector(name);
@@ -178,6 +225,13 @@ PendingDelete& World::getPendingDelete()
 
 //-----------------------------------------------------------------
 
+PendingCreate& World::getPendingCreate()
+{
+	return mPendingCreate;
+}
+
+//-----------------------------------------------------------------
+
 EventQueue& World::getEventQueue()
 {
 	return mEventQueue;
@@ -185,6 +239,13 @@ EventQueue& World::getEventQueue()
 
 //-----------------------------------------------------------------
 
+ScopeArena& World::getArena()
+{
+	return *mArena;
+}
+
+//-----------------------------------------------------------------
+
 WorldState& World::getWorldState()
 {
 	return mState;
@@ -208,21 +269,21 @@ const string& World::getName() const
 
 Datum& World::getSectors() const
 {
-	return *find(sSectorsAttribute);
+	return *mSectors;
 }
 
 //-----------------------------------------------------------------
 
 Datum& World::getActions() const
 {
-	return *find(sActionsAttribute);
+	return *mActions;
 }
 
 //-----------------------------------------------------------------
 
 Datum& World::getReactions() const
 {
-	return *find(sReactionsAttribute);
+	return *mReactions;
 }
 
 //-----------------------------------------------------------------
@@ -248,6 +309,11 @@ void World::populate()
 	addTableEntry(sSectorsAttribute);
 	addTableEntry(sActionsAttribute);
 	addTableEntry(sReactionsAttribute);
+
+	// resolved once here instead of every frame -- map pairs are allocated individually, so growing the table doesn't move these
+	mSectors = find(sSectorsSymbol);
+	mActions = find(sActionsSymbol);
+	mReactions = find(sReactionsSymbol);
 }
 
 //-----------------------------------------------------------------
@@ -255,5 +321,39 @@ void World::populate()
 void World::updateExternalStorage()
 {
 	Attributed::updateExternalStorage();
-	(*this)[sNameAttribute].setStorage(&mName, 1);
+
+	mSectors = find(sSectorsSymbol);
+	mActions = find(sActionsSymbol);
+	mReactions = find(sReactionsSymbol);
+}
+
+//-----------------------------------------------------------------
+
+ScopeArena* World::getTreeArena() const
+{
+	return mArena.get();
+}
+
+//-----------------------------------------------------------------
+
+void World::updateSectorsParallel(Datum& sectors)
+{
+	// every job works on its own copy of the state, taken after the world's actions ran
+	//		sector jobs add their entity jobs to the same group, so one wait covers everything
+	JobSystem::JobGroup jobGroup;
+	vector<JobSystem::Job> jobs;
+	for(uint32_t i = 0; i < sectors.size(); ++i)
+	{
+		Sector* sector = static_cast<Sector*>(&sectors[i]);
+		WorldState sectorState = mState;
+		sectorState.sectorIndex = i + 1;
+
+		jobs.emplace_back([sector, sectorState, &jobGroup]() mutable
+		{
+			sector->update(sectorState, jobGroup);
+		});
+	}
+
+	jobGroup.submit(jobs);
+	jobGroup.wait();
 }
@@ -8,6 +8,7 @@
 #include "Sector.h"
 
 #include "PendingDelete.h"
+#include "PendingCreate.h"
 #include "EventQueue.h"
 
 namespace DOGEngine
@@ -15,6 +16,13 @@ namespace DOGEngine
 	/**
 	 * Attributed class representing a World, the root
 	 * of the simulation hierarchy. Holds Sectors.
+	 *
+	 * Each World owns a ScopeArena. A World parsed from
+	 * Xml is loaded into its arena, so destroying it
+	 * destroys the loaded Scopes in one pass and frees
+	 * their storage all at once. Scopes from the arena
+	 * must not outlive the World, even if they are
+	 * orphaned from it.
 	 */
 	class World final : public Attributed
 	{
@@ -61,6 +69,8 @@ namespace DOGEngine
 		 *
 		 * @param other The World we are moving.
 		 *				It is reset to a default state.
+		 *
+		 * @note The arena goes with the moved Scopes.
 		 */
 		World(World&& other);
 
@@ -75,17 +85,49 @@ namespace DOGEngine
 		World& operator=(World&& other);
 
 		/**
-		 * @brief Destructor.
+		 * @brief Destructor. The Scopes in this World's
+		 *		  arena are destroyed in one pass, without
+		 *		  orphaning them from their parents or
+		 *		  deleting them one child at a time.
 		 */
 		~World();
 
 		/**
 		 * @brief Update method for the simulation loop.
 		 *		  Updates this object and calls update
-		 *		  on child Sectors.
+		 *		  on child Sectors, then applies the
+		 *		  changes deferred during the update.
+		 *
+		 * @note In parallel mode, this World's Actions
+		 *		 run first on the calling thread, then
+		 *		 each Sector (and chunks of its Entities)
+		 *		 run as jobs. Creates and deletes are
+		 *		 deferred in both modes, so both build the
+		 *		 same tree. Actions that touch shared state
+		 *		 directly (e.g. ActionClearEvents or
+		 *		 ActionUnsubscribe) take effect in job
+		 *		 order, not serial order.
 		 */
 		void update();
 
+		/**
+		 * @brief Turns the parallel update on or off.
+		 *		  Off by default.
+		 *
+		 * @param isParallel If true, update spreads
+		 *					 Sectors and Entities over
+		 *					 the shared JobSystem.
+		 */
+		void setParallelUpdate(bool isParallel);
+
+		/**
+		 * @brief Says whether update runs in parallel.
+		 *
+		 * @return Returns true if the parallel update is
+		 *		   on.
+		 */
+		bool isParallelUpdate() const;
+
 		/**
 		 * @brief Creates a child Sector.
 		 *
@@ -137,6 +179,13 @@ namespace DOGEngine
 		 */
 		PendingDelete& getPendingDelete();
 
+		/**
+		 * @brief Retrieves the pending create queue.
+		 *
+		 * @return Returns a reference to mPendingCreate
+		 */
+		PendingCreate& getPendingCreate();
+
 		/**
 		 * @brief Retrieves the event queue.
 		 *
@@ -144,6 +193,15 @@ namespace DOGEngine
 		 */
 		EventQueue& getEventQueue();
 
+		/**
+		 * @brief Retrieves the arena this World's
+		 *		  Scopes are loaded into. Activate it to
+		 *		  create more Scopes there.
+		 *
+		 * @return Returns a reference to mArena
+		 */
+		ScopeArena& getArena();
+
 		/**
 		 * @brief Retrieves the world state.
 		 *
@@ -206,18 +264,44 @@ namespace DOGEngine
 		virtual void populate() override;
 
 		/**
-		 * @brief Updates this class' table's pointers
-		 *		  to external storage.
+		 * @brief Re-resolves the cached child-collection
+		 *		  Datums.
 		 */
 		virtual void updateExternalStorage() override;
 
+		/**
+		 * @brief Getter for the arena that owns this
+		 *		  World's tree, so Scopes loaded into
+		 *		  another World can't be moved in.
+		 *
+		 * @return Returns mArena.
+		 */
+		virtual ScopeArena* getTreeArena() const override;
+
 	private:
 
+		/**
+		 * @brief Runs each child Sector as a job and
+		 *		  waits for them, and the Entity jobs they
+		 *		  spawn, to finish.
+		 *
+		 * @param sectors The Datum holding the Sectors.
+		 */
+		void updateSectorsParallel(Datum& sectors);
+
+		std::unique_ptr<ScopeArena> mArena;
+
 		PendingDelete mPendingDelete;
+		PendingCreate mPendingCreate;
 		EventQueue mEventQueue;
 		WorldState mState;
 
 		std::string mName;
+		bool mIsParallelUpdate;
+
+		Datum* mSectors;
+		Datum* mActions;
+		Datum* mReactions;
 
 	public:
 
@@ -225,5 +309,10 @@ namespace DOGEngine
 		const static std::string sSectorsAttribute;
 		const static std::string sActionsAttribute;
 		const static std::string sReactionsAttribute;
+
+		const static Symbol sNameSymbol;
+		const static Symbol sSectorsSymbol;
+		const static Symbol sActionsSymbol;
+		const static Symbol sReactionsSymbol;
 	};
 }
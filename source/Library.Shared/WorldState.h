@@ -16,6 +16,11 @@ namespace DOGEngine
 	 * Sector, Entity, and Action, and a
 	 * class that tracks time.
 	 *
+	 * Also tracks where the update is in the
+	 * World's traversal, so work deferred from
+	 * a parallel update can be applied in serial
+	 * order.
+	 *
 	 * Functionally does nothing on its own,
 	 * but is passed by reference to others
 	 * that act upon its stored data.
@@ -30,6 +35,9 @@ namespace DOGEngine
 			sector(nullptr), 
 			entity(nullptr),
 			action(nullptr),
+			sectorIndex(0),
+			entityIndex(0),
+			deferSequence(0),
 			gameTime()
 		{};
 
@@ -38,6 +46,14 @@ namespace DOGEngine
 		Entity* entity;
 		Action* action;
 
+		// 1-based positions of the current sector and entity
+		//		0 while updating the world's (or the sector's) own actions
+		std::uint32_t sectorIndex;
+		std::uint32_t entityIndex;
+
+		// bumped for each deferred change queued from this state
+		std::uint32_t deferSequence;
+
 		GameTime gameTime;
 	};
 }
@@ -0,0 +1,87 @@
+#include "pch.h"
+#include "XmlAttributes.h"
+
+using namespace DOGEngine;
+using namespace std;
+
+XmlAttributes::XmlAttributes(const char** attributes) :
+	mAttributes(attributes), mSize(0)
+{
+	assert(attributes != nullptr);
+
+	while(mAttributes[mSize * 2] != nullptr)
+	{
+		++mSize;
+	}
+}
+
+//-----------------------------------------------------------------
+
+uint32_t XmlAttributes::size() const
+{
+	return mSize;
+}
+
+//-----------------------------------------------------------------
+
+const char* XmlAttributes::nameAt(uint32_t index) const
+{
+	if(index >= mSize)
+	{
+		throw exception("Error -- attribute index is out of bounds!");
+	}
+
+	return mAttributes[index * 2];
+}
+
+//-----------------------------------------------------------------
+
+const char* XmlAttributes::valueAt(uint32_t index) const
+{
+	if(index >= mSize)
+	{
+		throw exception("Error -- attribute index is out of bounds!");
+	}
+
+	return mAttributes[index * 2 + 1];
+}
+
+//-----------------------------------------------------------------
+
+const char* XmlAttributes::find(const string& name) const
+{
+	const char* result = nullptr;
+
+	for(uint32_t i = 0; i < mSize; ++i)
+	{
+		if(name.compare(mAttributes[i * 2]) == 0)
+		{
+			result = mAttributes[i * 2 + 1];
+			break;
+		}
+	}
+
+	return result;
+}
+
+//-----------------------------------------------------------------
+
+bool XmlAttributes::containsKey(const string& name) const
+{
+	return find(name) != nullptr;
+}
+
+//-----------------------------------------------------------------
+
+const char* XmlAttributes::operator[](const string& name) const
+{
+	const char* result = find(name);
+	if(result == nullptr)
+	{
+		stringstream exceptionStr;
+		exceptionStr << "Error -- element does not have an attribute named " << name;
+		throw exception(exceptionStr.str().c_str());
+	}
+
+	return result;
+}
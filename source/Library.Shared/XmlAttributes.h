@@ -0,0 +1,105 @@
+#pragma once
+
+#include "pch.h"
+
+namespace DOGEngine
+{
+	/**
+	 * Read-only view over the attributes of an Xml
+	 * start-element tag, as handed to us by expat: a
+	 * null-terminated array of alternating name and value
+	 * strings.
+	 *
+	 * Nothing is copied. The view is only valid for the
+	 * duration of the start-element callback it was made
+	 * in, so helpers must copy out any value they keep.
+	 *
+	 * Elements rarely carry more than a handful of
+	 * attributes, so lookups are a linear scan.
+	 */
+	class XmlAttributes final
+	{
+	public:
+
+		XmlAttributes(const XmlAttributes& other) = delete;
+		XmlAttributes& operator=(const XmlAttributes& other) = delete;
+
+		/**
+		 * @brief Constructor.
+		 *
+		 * @param attributes Expat's null-terminated array of
+		 *					 attribute name-value pairs.
+		 */
+		explicit XmlAttributes(const char** attributes);
+
+		/**
+		 * @brief Getter for the number of attributes.
+		 *
+		 * @return Returns the number of name-value pairs.
+		 */
+		std::uint32_t size() const;
+
+		/**
+		 * @brief Getter for the name of an attribute.
+		 *
+		 * @param index The index of the attribute.
+		 *
+		 * @return Returns the name, as a null-terminated
+		 *		   string.
+		 *
+		 * @exception Throws exception if the index is out of
+		 *			  bounds.
+		 */
+		const char* nameAt(std::uint32_t index) const;
+
+		/**
+		 * @brief Getter for the value of an attribute.
+		 *
+		 * @param index The index of the attribute.
+		 *
+		 * @return Returns the value, as a null-terminated
+		 *		   string.
+		 *
+		 * @exception Throws exception if the index is out of
+		 *			  bounds.
+		 */
+		const char* valueAt(std::uint32_t index) const;
+
+		/**
+		 * @brief Looks up the value of an attribute by name.
+		 *
+		 * @param name The name of the attribute.
+		 *
+		 * @return Returns the value, or nullptr if the element
+		 *		   has no attribute of that name.
+		 */
+		const char* find(const std::string& name) const;
+
+		/**
+		 * @brief Says whether the element has an attribute.
+		 *
+		 * @param name The name of the attribute.
+		 *
+		 * @return Returns true if the attribute is present.
+		 */
+		bool containsKey(const std::string& name) const;
+
+		/**
+		 * @brief Looks up the value of an attribute by name.
+		 *
+		 * @param name The name of the attribute.
+		 *
+		 * @return Returns the value, as a null-terminated
+		 *		   string.
+		 *
+		 * @exception Throws exception if the element has no
+		 *			  attribute of that name.
+		 */
+		const char* operator[](const std::string& name) const;
+
+	private:
+
+		const char** mAttributes;
+		std::uint32_t mSize;
+	};
+}
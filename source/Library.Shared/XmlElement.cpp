@@ -0,0 +1,33 @@
+#include "pch.h"
+#include "XmlElement.h"
+
+using namespace DOGEngine;
+using namespace std;
+
+const uint32_t XmlElement::sUndeclared = UINT32_MAX;
+
+XmlElement::XmlElement(const string& name, uint32_t index) :
+	mName(name), mIndex(index)
+{
+}
+
+//-----------------------------------------------------------------
+
+const string& XmlElement::name() const
+{
+	return mName;
+}
+
+//-----------------------------------------------------------------
+
+uint32_t XmlElement::index() const
+{
+	return mIndex;
+}
+
+//-----------------------------------------------------------------
+
+bool XmlElement::isDeclared() const
+{
+	return mIndex != sUndeclared;
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "pch.h"
+
+namespace DOGEngine
+{
+	/**
+	 * An Xml element as the XmlParseMaster hands it to one
+	 * of its helpers.
+	 *
+	 * The master resolves an element's name once per start
+	 * tag, and tells each helper which of the names it
+	 * declared the element matched. Helpers index their own
+	 * handler tables with that position instead of looking
+	 * the name up again.
+	 *
+	 * Like XmlAttributes, the view is only valid for the
+	 * duration of the callback it was made in.
+	 */
+	class XmlElement final
+	{
+	public:
+
+		XmlElement(const XmlElement& other) = delete;
+		XmlElement& operator=(const XmlElement& other) = delete;
+
+		/**
+		 * @brief Constructor.
+		 *
+		 * @param name The name of the element.
+		 * @param index The position of the name in the helper's
+		 *				declared names, or sUndeclared.
+		 */
+		XmlElement(const std::string& name, std::uint32_t index);
+
+		/**
+		 * @brief Getter for the name of the element.
+		 *
+		 * @return Returns the name.
+		 */
+		const std::string& name() const;
+
+		/**
+		 * @brief Getter for the position of the element's name
+		 *		  in the list the helper filled in through
+		 *		  IXmlParseHelper::getElementNames.
+		 *
+		 * @return Returns the position, or sUndeclared if the
+		 *		   helper did not declare the name.
+		 */
+		std::uint32_t index() const;
+
+		/**
+		 * @brief Says whether the helper declared the element's
+		 *		  name.
+		 *
+		 * @return Returns true if the index is valid.
+		 */
+		bool isDeclared() const;
+
+		static const std::uint32_t sUndeclared;
+
+	private:
+
+		const std::string& mName;
+		std::uint32_t mIndex;
+	};
+}
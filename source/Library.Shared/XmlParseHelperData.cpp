@@ -8,14 +8,30 @@ using namespace glm;
 
 RTTI_DEFINITIONS(XmlParseHelperData)
 
-XmlParseHelperData::DatumTypeMap XmlParseHelperData::sDatumTypeMap;
-
 const string XmlParseHelperData::sIntElement = "Int";
 const string XmlParseHelperData::sFloatElement = "Float";
 const string XmlParseHelperData::sStringElement = "String";
 const string XmlParseHelperData::sVectorElement = "Vector";
 const string XmlParseHelperData::sMatrixElement = "Matrix";
 
+const Symbol XmlParseHelperData::sElementSymbols[] =
+{
+	Symbol(sIntElement),
+	Symbol(sFloatElement),
+	Symbol(sStringElement),
+	Symbol(sVectorElement),
+	Symbol(sMatrixElement)
+};
+
+const Datum::DatumType XmlParseHelperData::sDatumTypes[] =
+{
+	Datum::DatumType::Integer,
+	Datum::DatumType::Float,
+	Datum::DatumType::String,
+	Datum::DatumType::Vector,
+	Datum::DatumType::Matrix
+};
+
 const string XmlParseHelperData::sNameAttribute = "name";
 const string XmlParseHelperData::sValueAttribute = "value";
 const string XmlParseHelperData::sIndexAttribute = "index";
@@ -23,14 +39,6 @@ const string XmlParseHelperData::sIndexAttribute = "index";
 XmlParseHelperData::XmlParseHelperData() :
 	IXmlParseHelper()
 {
-	if(sDatumTypeMap.isEmpty())
-	{
-		sDatumTypeMap[sIntElement] = Datum::DatumType::Integer;
-		sDatumTypeMap[sFloatElement] = Datum::DatumType::Float;
-		sDatumTypeMap[sStringElement] = Datum::DatumType::String;
-		sDatumTypeMap[sVectorElement] = Datum::DatumType::Vector;
-		sDatumTypeMap[sMatrixElement] = Datum::DatumType::Matrix;
-	}
 }
 
 //-----------------------------------------------------------------
@@ -48,64 +56,61 @@ IXmlParseHelper* XmlParseHelperData::clone()
 
 //-----------------------------------------------------------------
 
-bool XmlParseHelperData::startElementHandler(SharedData& sharedData, const string& name, const AttributeMap& attributes)
+void XmlParseHelperData::getElementNames(Vector<Symbol>& names) const
+{
+	for(auto& symbol : sElementSymbols)
+	{
+		names.pushBack(symbol);
+	}
+}
+
+//-----------------------------------------------------------------
+
+bool XmlParseHelperData::acceptsSharedData(const SharedData& sharedData) const
+{
+	return sharedData.Is(SharedDataTable::TypeIdClass());
+}
+
+//-----------------------------------------------------------------
+
+bool XmlParseHelperData::startElementHandler(SharedData& sharedData, const XmlElement& element, const XmlAttributes& attributes)
 {
 	bool result = false;
 
-	SharedDataTable* sharedTable = sharedData.As<SharedDataTable>();
-	if(sharedTable != nullptr)
+	// the master only routes our declared elements to us, and only for a SharedDataTable
+	if(element.isDeclared())
 	{
+		SharedDataTable* sharedTable = static_cast<SharedDataTable*>(&sharedData);
+		const string& name = element.name();
+
 		Scope* scope = sharedTable->getScope();
 		assert(scope != nullptr);
 
-		if(sDatumTypeMap.containsKey(name))
+		// index attribute defined -- we set data in place
+		if(attributes.containsKey(sIndexAttribute))
 		{
-			// index attribute defined -- we set data in place
-			if(attributes.containsKey(sIndexAttribute))
-			{
-				// we can handle this element -- requires "name" and "value"
-				requiresAttribute(attributes, sNameAttribute, name, sharedTable->getXmlParseMaster()->getFileName());
-				requiresAttribute(attributes, sValueAttribute, name, sharedTable->getXmlParseMaster()->getFileName());
-
-				Datum& datum = (*scope)[attributes[sNameAttribute]];
-				datum.setFromString(attributes[sValueAttribute], getIndexFromString(attributes[sIndexAttribute]));
-
-				result = true;
-			}
+			// we can handle this element -- requires "name" and "value"
+			requiresAttribute(attributes, sNameAttribute, name, sharedTable->getXmlParseMaster()->getFileName());
+			requiresAttribute(attributes, sValueAttribute, name, sharedTable->getXmlParseMaster()->getFileName());
 
-			// index attribute not defined -- we push back or set 0th element
-			else
-			{
-				// we can handle this element -- requires "name" and "value"
-				requiresAttribute(attributes, sNameAttribute, name, sharedTable->getXmlParseMaster()->getFileName());
-				requiresAttribute(attributes, sValueAttribute, name, sharedTable->getXmlParseMaster()->getFileName());
+			Datum& datum = (*scope)[attributes[sNameAttribute]];
+			datum.setFromString(attributes[sValueAttribute], getIndexFromString(attributes[sIndexAttribute]));
 
-				Datum& datum = (*scope)[attributes[sNameAttribute]];
-				datum.setType(sDatumTypeMap[name]);
-
-				datum.isExternal() ? datum.setFromString(attributes[sValueAttribute]) : datum.pushBackFromString(attributes[sValueAttribute]);
-
-				result = true;
-			}
+			result = true;
 		}
-	}
 
-	return result;
-}
+		// index attribute not defined -- we push back or set 0th element
+		else
+		{
+			// we can handle this element -- requires "name" and "value"
+			requiresAttribute(attributes, sNameAttribute, name, sharedTable->getXmlParseMaster()->getFileName());
+			requiresAttribute(attributes, sValueAttribute, name, sharedTable->getXmlParseMaster()->getFileName());
 
-//-----------------------------------------------------------------
+			Datum& datum = (*scope)[attributes[sNameAttribute]];
+			datum.setType(sDatumTypes[element.index()]);
 
-bool XmlParseHelperData::endElementHandler(SharedData& sharedData, const string& name)
-{
-	bool result = false;
+			datum.isExternal() ? datum.setFromString(attributes[sValueAttribute]) : datum.pushBackFromString(attributes[sValueAttribute]);
 
-	// expects a shared data table
-	SharedDataTable* sharedTable = sharedData.As<SharedDataTable>();
-	if(sharedTable != nullptr)
-	{
-		// we have a handler for this (doesn't matter which map we look at)
-		if(sDatumTypeMap.containsKey(name))
-		{
 			result = true;
 		}
 	}
@@ -115,9 +120,10 @@ bool XmlParseHelperData::endElementHandler(SharedData& sharedData, const string&
 
 //-----------------------------------------------------------------
 
-void XmlParseHelperData::clearHandlerCache()
+bool XmlParseHelperData::endElementHandler(SharedData& sharedData, const XmlElement& element)
 {
-	sDatumTypeMap.clear();
+	UNREFERENCED_PARAMETER(sharedData);
+	return element.isDeclared();
 }
 
 //-----------------------------------------------------------------
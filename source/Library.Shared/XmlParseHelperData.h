@@ -70,12 +70,31 @@ namespace DOGEngine
 		 */
 		virtual IXmlParseHelper* clone() override;
 
+		/**
+		 * @brief Declares the elements this helper handles:
+		 *		  Int, Float, String,
+		 *		  Vector and Matrix.
+		 *
+		 * @param names The list the element names are appended to.
+		 */
+		virtual void getElementNames(Vector<Symbol>& names) const override;
+
+		/**
+		 * @brief Accepts SharedDataTable only.
+		 *
+		 * @param sharedData The SharedData of the XmlParseMaster.
+		 *
+		 * @return Returns true if the SharedData is a
+		 *		   SharedDataTable.
+		 */
+		virtual bool acceptsSharedData(const SharedData& sharedData) const override;
+
 		/**
 		 * @brief Expat callback for element start tags.
 		 *
 		 * @param sharedData The shared data for the current parse.
-		 * @param name The name of the current element.
-		 * @param attributes Map of key-value pairs of attributes
+		 * @param element The current element.
+		 * @param attributes View of key-value pairs of attributes
 		 *					 as unparsed strings.
 		 *
 		 * @return Returns true if the start element is handled.
@@ -83,24 +102,18 @@ namespace DOGEngine
 		 *
 		 * @exception If there are any errors during parse.
 		 */
-		virtual bool startElementHandler(SharedData& sharedData, const std::string& name, const AttributeMap& attributes) override;
+		virtual bool startElementHandler(SharedData& sharedData, const XmlElement& element, const XmlAttributes& attributes) override;
 
 		/**
 		 * @brief Expat callback for element end tags.
 		 *
 		 * @param sharedData The shared data for the current parse.
-		 * @param name The name of the current element.
+		 * @param element The current element.
 		 *
 		 * @return Returns true if the end element is handled.
 		 *		   Otherwise, returns false.
 		 */
-		virtual bool endElementHandler(SharedData& sharedData, const std::string& name) override;
-
-		/**
-		 * @brief Clears the static map that associates
-		 *		  element names with handler functions.
-		 */
-		static void clearHandlerCache();
+		virtual bool endElementHandler(SharedData& sharedData, const XmlElement& element) override;
 
 	private:
 
@@ -113,10 +126,6 @@ namespace DOGEngine
 		 */
 		std::int32_t getIndexFromString(const std::string& indexStr);
 
-		// datum type map
-		typedef HashMap<std::string, Datum::DatumType> DatumTypeMap;
-		static DatumTypeMap sDatumTypeMap;
-
 		// element tag names
 		const static std::string sIntElement;
 		const static std::string sFloatElement;
@@ -124,6 +133,10 @@ namespace DOGEngine
 		const static std::string sVectorElement;
 		const static std::string sMatrixElement;
 
+		// element tag names as declared to the XmlParseMaster, and the datum type of each, in the same order
+		const static Symbol sElementSymbols[];
+		const static Datum::DatumType sDatumTypes[];
+
 		// element attribute names
 		const static std::string sNameAttribute;
 		const static std::string sValueAttribute;
@@ -15,11 +15,12 @@ using namespace std;
 RTTI_DEFINITIONS(XmlParseHelperSubfile)
 
 const string XmlParseHelperSubfile::sFileElement = "File";
+const Symbol XmlParseHelperSubfile::sFileSymbol(sFileElement);
 const string XmlParseHelperSubfile::sPathAttribute = "path";
 const string XmlParseHelperSubfile::sScopeName = "scope";
 
-XmlParseHelperSubfile::XmlParseHelperSubfile() :
-	IXmlParseHelper()
+XmlParseHelperSubfile::XmlParseHelperSubfile(XmlSubfileCache* cache) :
+	IXmlParseHelper(), mCache(cache)
 {
 }
 
@@ -33,78 +34,71 @@ XmlParseHelperSubfile::~XmlParseHelperSubfile()
 
 IXmlParseHelper* XmlParseHelperSubfile::clone()
 {
-	return new XmlParseHelperSubfile();
+	return new XmlParseHelperSubfile(mCache);
 }
 
 //-----------------------------------------------------------------
 
-bool XmlParseHelperSubfile::startElementHandler(SharedData& sharedData, const std::string& name, const AttributeMap& attributes)
+void XmlParseHelperSubfile::getElementNames(Vector<Symbol>& names) const
+{
+	names.pushBack(sFileSymbol);
+}
+
+//-----------------------------------------------------------------
+
+bool XmlParseHelperSubfile::acceptsSharedData(const SharedData& sharedData) const
+{
+	return sharedData.Is(SharedDataTable::TypeIdClass());
+}
+
+//-----------------------------------------------------------------
+
+bool XmlParseHelperSubfile::startElementHandler(SharedData& sharedData, const XmlElement& element, const XmlAttributes& attributes)
 {
 	bool result = false;
 
-	SharedDataTable* sharedTable = sharedData.As<SharedDataTable>();
-	if(sharedTable != nullptr)
+	// the master only routes File elements to us, and only for a SharedDataTable
+	SharedDataTable* sharedTable = static_cast<SharedDataTable*>(&sharedData);
+	if(element.isDeclared())
 	{
-		if(name == sFileElement)
+		assert(sharedTable->getScope() != nullptr && sharedTable->depth() > 1);
+
+		// a subfile job carries the arena active when it is submitted
+		ScopeArena::Activation activation(sharedTable->getArena());
+
+		requiresAttribute(attributes, sPathAttribute, sFileElement, sharedData.getXmlParseMaster()->getFileName(), true);
+
+		// build path to subfile
+		string subFilePath = sharedTable->getXmlParseMaster()->getFileName();
+		size_t index = subFilePath.find_last_of('/');
+		subFilePath.erase(index + 1);
+		subFilePath.append(attributes[sPathAttribute]);
+
+		if(mCache != nullptr)
 		{
-			Scope* currentScope = sharedTable->getScope();
-			assert(currentScope != nullptr && sharedTable->depth() > 1);
-
-			requiresAttribute(attributes, sPathAttribute, sFileElement, sharedData.getXmlParseMaster()->getFileName(), true);
-
-			unique_ptr<XmlParseMaster> masterClone(sharedTable->getXmlParseMaster()->clone());
-
-			// build path to subfile
-			string subFilePath = sharedTable->getXmlParseMaster()->getFileName();
-			size_t index = subFilePath.find_last_of('/');
-			subFilePath.erase(index + 1);
-			subFilePath.append(attributes[sPathAttribute]);
-
-			// parse the subfile, validate that it returned stuff
-			masterClone->parseFromFile(subFilePath);
-			Scope* subFileScope = masterClone->getSharedData()->As<SharedDataTable>()->extractScope();
-			assert(subFileScope != nullptr && !subFileScope->Is(World::TypeIdClass()));
-
-			// subfile was a sector -- we need world at this level
-			if(subFileScope->Is(Sector::TypeIdClass()))
-			{
-				assert(currentScope->Is(World::TypeIdClass()));
-				currentScope->adopt(World::sSectorsAttribute, *subFileScope);
-			}
-
-			// subfile was an entity -- we need a sector at this level
-			else if(subFileScope->Is(Entity::TypeIdClass()))
-			{
-				assert(currentScope->Is(Sector::TypeIdClass()));
-				currentScope->adopt(Sector::sEntitiesAttribute, *subFileScope);
-			}
-
-			// subfile was a reaction
-			else if(subFileScope->Is(Reaction::TypeIdClass()))
-			{
-				assert(
-					currentScope->Is(World::TypeIdClass()) || currentScope->Is(Sector::TypeIdClass()) ||
-					currentScope->Is(Entity::TypeIdClass()) || currentScope->Is(Action::TypeIdClass()));
-				currentScope->adopt(Entity::sReactionsAttribute, *subFileScope);
-			}
-
-			// subfile was any other type of action
-			else if(subFileScope->Is(Action::TypeIdClass()))
-			{
-				assert(
-					currentScope->Is(World::TypeIdClass()) || currentScope->Is(Sector::TypeIdClass()) || 
-					currentScope->Is(Entity::TypeIdClass()) || currentScope->Is(ActionList::TypeIdClass()));
-				currentScope->adopt(Entity::sActionsAttribute, *subFileScope);
-			}
-
-			// subfile was a basic type -- we just adopt it
-			else
-			{
-				currentScope->adopt(sScopeName, *subFileScope);
-			}
-
-			result = true;
+			// copied from the cached parse when the parse leaves the current scope
+			shared_ptr<XmlSubfileCache::Prototype> prototype = mCache->acquire(subFilePath, *sharedTable->getXmlParseMaster());
+			sharedTable->deferChild(
+				[prototype]()
+				{
+					return prototype->instantiate();
+				},
+				&XmlParseHelperSubfile::adoptSubfileScope);
 		}
+		else
+		{
+			// the subfile is parsed by a job with its own master, and adopted when the parse leaves the current scope
+			shared_ptr<XmlParseMaster> masterClone(sharedTable->getXmlParseMaster()->clone());
+			sharedTable->queueChild(
+				[masterClone, subFilePath]()
+				{
+					masterClone->parseFromFile(subFilePath);
+					return masterClone->getSharedData()->As<SharedDataTable>()->extractScope();
+				},
+				&XmlParseHelperSubfile::adoptSubfileScope);
+		}
+
+		result = true;
 	}
 
 	return result;
@@ -112,8 +106,53 @@ bool XmlParseHelperSubfile::startElementHandler(SharedData& sharedData, const st
 
 //-----------------------------------------------------------------
 
-bool XmlParseHelperSubfile::endElementHandler(SharedData& sharedData, const std::string& name)
+bool XmlParseHelperSubfile::endElementHandler(SharedData& sharedData, const XmlElement& element)
 {
 	UNREFERENCED_PARAMETER(sharedData);
-	return name == sFileElement;
+	return element.isDeclared();
+}
+
+//-----------------------------------------------------------------
+
+void XmlParseHelperSubfile::adoptSubfileScope(Scope& currentScope, Scope& subFileScope)
+{
+	assert(!subFileScope.Is(World::TypeIdClass()));
+
+	// subfile was a sector -- we need world at this level
+	if(subFileScope.Is(Sector::TypeIdClass()))
+	{
+		assert(currentScope.Is(World::TypeIdClass()));
+		currentScope.adopt(World::sSectorsAttribute, subFileScope);
+	}
+
+	// subfile was an entity -- we need a sector at this level
+	else if(subFileScope.Is(Entity::TypeIdClass()))
+	{
+		assert(currentScope.Is(Sector::TypeIdClass()));
+		currentScope.adopt(Sector::sEntitiesAttribute, subFileScope);
+	}
+
+	// subfile was a reaction
+	else if(subFileScope.Is(Reaction::TypeIdClass()))
+	{
+		assert(
+			currentScope.Is(World::TypeIdClass()) || currentScope.Is(Sector::TypeIdClass()) ||
+			currentScope.Is(Entity::TypeIdClass()) || currentScope.Is(Action::TypeIdClass()));
+		currentScope.adopt(Entity::sReactionsAttribute, subFileScope);
+	}
+
+	// subfile was any other type of action
+	else if(subFileScope.Is(Action::TypeIdClass()))
+	{
+		assert(
+			currentScope.Is(World::TypeIdClass()) || currentScope.Is(Sector::TypeIdClass()) || 
+			currentScope.Is(Entity::TypeIdClass()) || currentScope.Is(ActionList::TypeIdClass()));
+		currentScope.adopt(Entity::sActionsAttribute, subFileScope);
+	}
+
+	// subfile was a basic type -- we just adopt it
+	else
+	{
+		currentScope.adopt(sScopeName, subFileScope);
+	}
 }
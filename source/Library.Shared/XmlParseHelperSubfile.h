@@ -5,6 +5,7 @@
 #include "XmlParseMaster.h"
 
 #include "SharedDataTable.h"
+#include "XmlSubfileCache.h"
 
 namespace DOGEngine
 {
@@ -45,6 +46,21 @@ namespace DOGEngine
 	 *
 	 *		<File path="other.xml" />
 	 *		<File path="dir/other.xml" />
+	 *
+	 * Subfiles are parsed on the JobSystem as soon as their
+	 * File element is seen, each by its own clone of the
+	 * master, while the including file carries on. Their
+	 * roots are adopted when the parse reaches the end tag
+	 * of the enclosing element: after that element's inline
+	 * children, and in document order among themselves.
+	 * Worker threads have no ScopeArena active, so subfile
+	 * Scopes always come from the heap.
+	 *
+	 * Given an XmlSubfileCache, each file is parsed at most
+	 * once per parse (and not at all while the cache holds
+	 * a current copy), and every include of it becomes a
+	 * deep copy of that parsed root, made on the parse
+	 * thread when it is adopted.
 	 */
 	class XmlParseHelperSubfile final : public IXmlParseHelper
 	{
@@ -59,8 +75,13 @@ namespace DOGEngine
 
 		/**
 		 * @brief Constructor.
+		 *
+		 * @param cache The cache of parsed subfiles to load
+		 *				through, shared with this helper's
+		 *				clones. If null, every include is
+		 *				parsed.
 		 */
-		XmlParseHelperSubfile();
+		explicit XmlParseHelperSubfile(XmlSubfileCache* cache = nullptr);
 
 		/**
 		 * @brief Destructor.
@@ -69,19 +90,38 @@ namespace DOGEngine
 
 		/**
 		 * @brief Virtual constructor. Creates a new
-		 *		  XmlParseHelperSubfile.
+		 *		  XmlParseHelperSubfile that uses the same
+		 *		  cache.
 		 *
 		 * @return Returns the address of a new parse
 		 *		   helper as the abstract base class.
 		 */
 		virtual IXmlParseHelper* clone() override;
 
+		/**
+		 * @brief Declares the elements this helper handles:
+		 *		  File.
+		 *
+		 * @param names The list the element names are appended to.
+		 */
+		virtual void getElementNames(Vector<Symbol>& names) const override;
+
+		/**
+		 * @brief Accepts SharedDataTable only.
+		 *
+		 * @param sharedData The SharedData of the XmlParseMaster.
+		 *
+		 * @return Returns true if the SharedData is a
+		 *		   SharedDataTable.
+		 */
+		virtual bool acceptsSharedData(const SharedData& sharedData) const override;
+
 		/**
 		 * @brief Expat callback for element start tags.
 		 *
 		 * @param sharedData The shared data for the current parse.
-		 * @param name The name of the current element.
-		 * @param attributes Map of key-value pairs of attributes
+		 * @param element The current element.
+		 * @param attributes View of key-value pairs of attributes
 		 *					 as unparsed strings.
 		 *
 		 * @return Returns true if the start element is handled.
@@ -89,22 +129,35 @@ namespace DOGEngine
 		 *
 		 * @exception If there are any errors during parse.
 		 */
-		virtual bool startElementHandler(SharedData& sharedData, const std::string& name, const AttributeMap& attributes) override;
+		virtual bool startElementHandler(SharedData& sharedData, const XmlElement& element, const XmlAttributes& attributes) override;
 
 		/**
 		 * @brief Expat callback for element end tags.
 		 *
 		 * @param sharedData The shared data for the current parse.
-		 * @param name The name of the current element.
+		 * @param element The current element.
 		 *
 		 * @return Returns true if the end element is handled.
 		 *		   Otherwise, returns false.
 		 */
-		virtual bool endElementHandler(SharedData& sharedData, const std::string& name) override;
+		virtual bool endElementHandler(SharedData& sharedData, const XmlElement& element) override;
 
 	private:
 
+		/**
+		 * @brief Attaches a parsed subfile's root to the
+		 *		  Scope its File element was in, under the
+		 *		  field its type belongs in.
+		 *
+		 * @param currentScope The Scope the File element was in.
+		 * @param subFileScope The root of the parsed subfile.
+		 */
+		static void adoptSubfileScope(Scope& currentScope, Scope& subFileScope);
+
+		XmlSubfileCache* mCache;
+
 		const static std::string sFileElement;
+		const static Symbol sFileSymbol;
 		const static std::string sPathAttribute;
 		const static std::string sScopeName;
 	};
@@ -16,8 +16,6 @@ using namespace std;
 
 RTTI_DEFINITIONS(XmlParseHelperTable)
 
-XmlParseHelperTable::HandlerMap XmlParseHelperTable::sHandlerMap;
-
 const string XmlParseHelperTable::sScopeElement = "Scope";
 const string XmlParseHelperTable::sWorldElement = "World";
 const string XmlParseHelperTable::sSectorElement = "Sector";
@@ -30,6 +28,36 @@ const string XmlParseHelperTable::sThenElement = "Then";
 const string XmlParseHelperTable::sElseElement = "Else";
 const string XmlParseHelperTable::sConditionElement = "Condition";
 
+const Symbol XmlParseHelperTable::sElementSymbols[] =
+{
+	Symbol(sScopeElement),
+	Symbol(sWorldElement),
+	Symbol(sSectorElement),
+	Symbol(sEntityElement),
+	Symbol(sActionElement),
+	Symbol(sReactionElement),
+
+	Symbol(sIfElement),
+	Symbol(sThenElement),
+	Symbol(sElseElement),
+	Symbol(sConditionElement)
+};
+
+const XmlParseHelperTable::HandlerFunction XmlParseHelperTable::sHandlers[] =
+{
+	&XmlParseHelperTable::elementHandlerScope,
+	&XmlParseHelperTable::elementHandlerWorld,
+	&XmlParseHelperTable::elementHandlerSector,
+	&XmlParseHelperTable::elementHandlerEntity,
+	&XmlParseHelperTable::elementHandlerAction,
+	&XmlParseHelperTable::elementHandlerReaction,
+
+	&XmlParseHelperTable::elementHandlerIf,
+	&XmlParseHelperTable::elementHandlerThen,
+	&XmlParseHelperTable::elementHandlerElse,
+	&XmlParseHelperTable::elementHandlerCondition
+};
+
 const string XmlParseHelperTable::sNameAttribute = "name";
 const string XmlParseHelperTable::sClassAttribute = "class";
 const string XmlParseHelperTable::sValueAttribute = "value";
@@ -40,21 +68,6 @@ const string XmlParseHelperTable::sSubtypeAttribute = "subtype";
 XmlParseHelperTable::XmlParseHelperTable() :
 	IXmlParseHelper()
 {
-	// populate the handler map
-	if(sHandlerMap.isEmpty())
-	{
-		sHandlerMap[sScopeElement] = &XmlParseHelperTable::elementHandlerScope;
-		sHandlerMap[sWorldElement] = &XmlParseHelperTable::elementHandlerWorld;
-		sHandlerMap[sSectorElement] = &XmlParseHelperTable::elementHandlerSector;
-		sHandlerMap[sEntityElement] = &XmlParseHelperTable::elementHandlerEntity;
-		sHandlerMap[sActionElement] = &XmlParseHelperTable::elementHandlerAction;
-		sHandlerMap[sReactionElement] = &XmlParseHelperTable::elementHandlerReaction;
-
-		sHandlerMap[sIfElement] = &XmlParseHelperTable::elementHandlerIf;
-		sHandlerMap[sThenElement] = &XmlParseHelperTable::elementHandlerThen;
-		sHandlerMap[sElseElement] = &XmlParseHelperTable::elementHandlerElse;
-		sHandlerMap[sConditionElement] = &XmlParseHelperTable::elementHandlerCondition;
-	}
 }
 
 //-----------------------------------------------------------------
@@ -72,42 +85,34 @@ XmlParseHelperTable* XmlParseHelperTable::clone()
 
 //-----------------------------------------------------------------
 
-bool XmlParseHelperTable::startElementHandler(SharedData& sharedData, const string& name, const AttributeMap& attributes)
+void XmlParseHelperTable::getElementNames(Vector<Symbol>& names) const
 {
-	bool result = false;
-
-	SharedDataTable* sharedTable = sharedData.As<SharedDataTable>();
-	if(sharedTable != nullptr)
+	for(auto& symbol : sElementSymbols)
 	{
-		// invoke the handler method for this element name
-		if(sHandlerMap.containsKey(name))
-		{
-			sHandlerMap[name](*this, *sharedTable, attributes);
-			result = true;
-		}
+		names.pushBack(symbol);
 	}
-
-	return result;
 }
 
 //-----------------------------------------------------------------
 
-bool XmlParseHelperTable::endElementHandler(SharedData& sharedData, const string& name)
+bool XmlParseHelperTable::acceptsSharedData(const SharedData& sharedData) const
 {
-	bool result = false;
+	return sharedData.Is(SharedDataTable::TypeIdClass());
+}
 
-	SharedDataTable* sharedTable = sharedData.As<SharedDataTable>();
-	if(sharedTable != nullptr)
+//-----------------------------------------------------------------
+
+bool XmlParseHelperTable::startElementHandler(SharedData& sharedData, const XmlElement& element, const XmlAttributes& attributes)
+{
+	// the master only routes our declared elements to us, and only for a SharedDataTable
+	bool result = element.isDeclared();
+	if(result)
 	{
-		// handled if we have a handler method for this tag name
-		if(sHandlerMap.containsKey(name))
-		{
-			result = true;
-			if(name != sConditionElement)	// TODO -- Condition will eventually be an expression???
-			{
-				sharedTable->setScopeToParent();
-			}
-		}
+		SharedDataTable& sharedTable = static_cast<SharedDataTable&>(sharedData);
+		ScopeArena::Activation activation(sharedTable.getArena());
+
+		// invoke the handler method for this element
+		(this->*sHandlers[element.index()])(sharedTable, attributes);
 	}
 
 	return result;
@@ -115,9 +120,31 @@ bool XmlParseHelperTable::endElementHandler(SharedData& sharedData, const string
 
 //-----------------------------------------------------------------
 
-void XmlParseHelperTable::clearHandlerCache()
+bool XmlParseHelperTable::endElementHandler(SharedData& sharedData, const XmlElement& element)
 {
-	sHandlerMap.clear();
+	// handled if we have a handler method for this tag
+	bool result = element.isDeclared();
+	if(result)
+	{
+		SharedDataTable& sharedTable = static_cast<SharedDataTable&>(sharedData);
+		HandlerFunction handler = sHandlers[element.index()];
+
+		// queued subfiles are copied from their prototypes as the parse leaves their parent
+		ScopeArena::Activation activation(sharedTable.getArena());
+
+		if(handler == &XmlParseHelperTable::elementHandlerReaction)
+		{
+			// subtype fields in the body were pushed onto the Datum directly, so route those too
+			static_cast<ReactionAttributed*>(sharedTable.getScope())->resubscribe();
+		}
+
+		if(handler != &XmlParseHelperTable::elementHandlerCondition)	// TODO -- Condition will eventually be an expression???
+		{
+			sharedTable.setScopeToParent();
+		}
+	}
+
+	return result;
 }
 
 #pragma endregion
@@ -126,7 +153,7 @@ void XmlParseHelperTable::clearHandlerCache()
 
 #pragma region Element Handlers
 
-void XmlParseHelperTable::elementHandlerScope(SharedDataTable& sharedData, const AttributeMap& attributes)
+void XmlParseHelperTable::elementHandlerScope(SharedDataTable& sharedData, const XmlAttributes& attributes)
 {
 	// basic Scopes require no parent type validation
 	requiresAttribute(attributes, sNameAttribute, sScopeElement, sharedData.getXmlParseMaster()->getFileName(), true);
@@ -137,7 +164,7 @@ void XmlParseHelperTable::elementHandlerScope(SharedDataTable& sharedData, const
 
 //-----------------------------------------------------------------
 
-void XmlParseHelperTable::elementHandlerWorld(SharedDataTable& sharedData, const AttributeMap& attributes)
+void XmlParseHelperTable::elementHandlerWorld(SharedDataTable& sharedData, const XmlAttributes& attributes)
 {
 	// World must exist as the root
 	assert(sharedData.getScope() == nullptr);
@@ -147,11 +174,14 @@ void XmlParseHelperTable::elementHandlerWorld(SharedDataTable& sharedData, const
 
 	World* world = new World(attributes[sNameAttribute]);
 	sharedData.setScope(attributes[sNameAttribute], *world);
+
+	// everything under the World is loaded into its arena
+	sharedData.setArena(&world->getArena());
 }
 
 //-----------------------------------------------------------------
 
-void XmlParseHelperTable::elementHandlerSector(SharedDataTable& sharedData, const AttributeMap& attributes)
+void XmlParseHelperTable::elementHandlerSector(SharedDataTable& sharedData, const XmlAttributes& attributes)
 {
 	// Sector is root of subfile or child of World
 	assert(sharedData.getScope() == nullptr || sharedData.getScope()->Is(World::TypeIdClass()));
@@ -164,7 +194,7 @@ void XmlParseHelperTable::elementHandlerSector(SharedDataTable& sharedData, cons
 
 //-----------------------------------------------------------------
 
-void XmlParseHelperTable::elementHandlerEntity(SharedDataTable& sharedData, const AttributeMap& attributes)
+void XmlParseHelperTable::elementHandlerEntity(SharedDataTable& sharedData, const XmlAttributes& attributes)
 {
 	// Entity is root of subfile or child of Sector
 	assert(sharedData.getScope() == nullptr || sharedData.getScope()->Is(Sector::TypeIdClass()));
@@ -181,7 +211,7 @@ void XmlParseHelperTable::elementHandlerEntity(SharedDataTable& sharedData, cons
 
 //-----------------------------------------------------------------
 
-void XmlParseHelperTable::elementHandlerAction(SharedDataTable& sharedData, const AttributeMap& attributes)
+void XmlParseHelperTable::elementHandlerAction(SharedDataTable& sharedData, const XmlAttributes& attributes)
 {
 	// Action is root of own file or child of World / Sector / Entity / ActionList
 	assert(sharedData.getScope() == nullptr || 
@@ -203,7 +233,7 @@ void XmlParseHelperTable::elementHandlerAction(SharedDataTable& sharedData, cons
 
 //-----------------------------------------------------------------
 
-void XmlParseHelperTable::elementHandlerReaction(SharedDataTable& sharedData, const AttributeMap& attributes)
+void XmlParseHelperTable::elementHandlerReaction(SharedDataTable& sharedData, const XmlAttributes& attributes)
 {
 	// Reaction is root of own file or child of World / Sector / Entity / Action
 	assert(sharedData.getScope() == nullptr ||
@@ -221,7 +251,7 @@ void XmlParseHelperTable::elementHandlerReaction(SharedDataTable& sharedData, co
 
 //-----------------------------------------------------------------
 
-void XmlParseHelperTable::elementHandlerIf(SharedDataTable& sharedData, const AttributeMap& attributes)
+void XmlParseHelperTable::elementHandlerIf(SharedDataTable& sharedData, const XmlAttributes& attributes)
 {
 	// ActionListIf is root of own file or child of World / Sector / Entity / ActionList
 	assert(sharedData.getScope() == nullptr ||
@@ -236,7 +266,7 @@ void XmlParseHelperTable::elementHandlerIf(SharedDataTable& sharedData, const At
 
 //-----------------------------------------------------------------
 
-void XmlParseHelperTable::elementHandlerThen(SharedDataTable& sharedData, const AttributeMap& attributes)
+void XmlParseHelperTable::elementHandlerThen(SharedDataTable& sharedData, const XmlAttributes& attributes)
 {
 	// Then is child of ActionListIf
 	assert(sharedData.getScope() != nullptr && sharedData.getScope()->Is(ActionListIf::TypeIdClass()));
@@ -255,7 +285,7 @@ void XmlParseHelperTable::elementHandlerThen(SharedDataTable& sharedData, const
 
 //-----------------------------------------------------------------
 
-void XmlParseHelperTable::elementHandlerElse(SharedDataTable& sharedData, const AttributeMap& attributes)
+void XmlParseHelperTable::elementHandlerElse(SharedDataTable& sharedData, const XmlAttributes& attributes)
 {
 	// Else is child of ActionListIf
 	assert(sharedData.getScope() != nullptr && sharedData.getScope()->Is(ActionListIf::TypeIdClass()));
@@ -274,7 +304,7 @@ void XmlParseHelperTable::elementHandlerElse(SharedDataTable& sharedData, const
 
 //-----------------------------------------------------------------
 
-void XmlParseHelperTable::elementHandlerCondition(SharedDataTable& sharedData, const AttributeMap& attributes)
+void XmlParseHelperTable::elementHandlerCondition(SharedDataTable& sharedData, const XmlAttributes& attributes)
 {
 	// TODO -- Condition will be expression???
 
@@ -295,13 +325,13 @@ void XmlParseHelperTable::elementHandlerCondition(SharedDataTable& sharedData, c
 
 #pragma region Parse Utility
 
-void XmlParseHelperTable::addAdditionalAttributes(SharedDataTable& sharedData, const AttributeMap& attributes)
+void XmlParseHelperTable::addAdditionalAttributes(SharedDataTable& sharedData, const XmlAttributes& attributes)
 {
-	for(auto& kvPair : attributes)
+	for(uint32_t i = 0; i < attributes.size(); ++i)
 	{
-		string& name = kvPair.first;
-		string& value = kvPair.second;
-		if(name == sNameAttribute || name == sClassAttribute)
+		const char* name = attributes.nameAt(i);
+		const char* value = attributes.valueAt(i);
+		if(sNameAttribute == name || sClassAttribute == name)
 		{
 			continue;
 		}
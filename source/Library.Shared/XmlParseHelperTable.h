@@ -89,12 +89,32 @@ namespace DOGEngine
 		 */
 		virtual XmlParseHelperTable* clone() override;
 
+		/**
+		 * @brief Declares the elements this helper handles:
+		 *		  Scope, World, Sector,
+		 *		  Entity, Action, Reaction, If, Then, Else and
+		 *		  Condition.
+		 *
+		 * @param names The list the element names are appended to.
+		 */
+		virtual void getElementNames(Vector<Symbol>& names) const override;
+
+		/**
+		 * @brief Accepts SharedDataTable only.
+		 *
+		 * @param sharedData The SharedData of the XmlParseMaster.
+		 *
+		 * @return Returns true if the SharedData is a
+		 *		   SharedDataTable.
+		 */
+		virtual bool acceptsSharedData(const SharedData& sharedData) const override;
+
 		/**
 		 * @brief Expat callback for element start tags.
 		 *
 		 * @param sharedData The shared data for the current parse.
-		 * @param name The name of the current element.
-		 * @param attributes Map of key-value pairs of attributes
+		 * @param element The current element.
+		 * @param attributes View of key-value pairs of attributes
 		 *					 as unparsed strings.
 		 *
 		 * @return Returns true if the start element is handled.
@@ -102,24 +122,18 @@ namespace DOGEngine
 		 *
 		 * @exception If there are any errors during parse.
 		 */
-		virtual bool startElementHandler(SharedData& sharedData, const std::string& name, const AttributeMap& attributes) override;
+		virtual bool startElementHandler(SharedData& sharedData, const XmlElement& element, const XmlAttributes& attributes) override;
 
 		/**
 		 * @brief Expat callback for element end tags.
 		 *
 		 * @param sharedData The shared data for the current parse.
-		 * @param name The name of the current element.
+		 * @param element The current element.
 		 *
 		 * @return Returns true if the end element is handled.
 		 *		   Otherwise, returns false.
 		 */
-		virtual bool endElementHandler(SharedData& sharedData, const std::string& name) override;
-
-		/**
-		 * @brief Clears the static map that associates
-		 *		  element names with handler functions.
-		 */
-		static void clearHandlerCache();
+		virtual bool endElementHandler(SharedData& sharedData, const XmlElement& element) override;
 
 	private:
 
@@ -127,43 +141,43 @@ namespace DOGEngine
 		 * @brief Expat callback for Scope element start tags.
 		 *
 		 * @param sharedData The shared data for the current parse.
-		 * @param attributes Map of key-value pairs of attributes
+		 * @param attributes View of key-value pairs of attributes
 		 *					 as unparsed strings.
 		 *
 		 * @exception No "name" attribute or the value of "name" is
 		 *			  an empty string ""
 		 */
-		void elementHandlerScope(SharedDataTable& sharedData, const AttributeMap& attributes);
+		void elementHandlerScope(SharedDataTable& sharedData, const XmlAttributes& attributes);
 
 		/**
 		 * @brief Expat callback for World element start tags.
 		 *
 		 * @param sharedData The shared data for the current parse.
-		 * @param attributes Map of key-value pairs of attributes
+		 * @param attributes View of key-value pairs of attributes
 		 *					 as unparsed strings.
 		 *
 		 * @exception No "name" attribute or the value of "name" is
 		 *			  an empty string ""
 		 */
-		void elementHandlerWorld(SharedDataTable& sharedData, const AttributeMap& attributes);
+		void elementHandlerWorld(SharedDataTable& sharedData, const XmlAttributes& attributes);
 
 		/**
 		 * @brief Expat callback for Sector element start tags.
 		 *
 		 * @param sharedData The shared data for the current parse.
-		 * @param attributes Map of key-value pairs of attributes
+		 * @param attributes View of key-value pairs of attributes
 		 *					 as unparsed strings.
 		 *
 		 * @exception No "name" attribute or the value of "name" is
 		 *			  an empty string ""
 		 */
-		void elementHandlerSector(SharedDataTable& sharedData, const AttributeMap& attributes);
+		void elementHandlerSector(SharedDataTable& sharedData, const XmlAttributes& attributes);
 
 		/**
 		 * @brief Expat callback for Entity element start tags.
 		 *
 		 * @param sharedData The shared data for the current parse.
-		 * @param attributes Map of key-value pairs of attributes
+		 * @param attributes View of key-value pairs of attributes
 		 *					 as unparsed strings.
 		 *
 		 * @exception No "class" attribute or the value of "class" is
@@ -171,13 +185,13 @@ namespace DOGEngine
 		 * @exception No "name" attribute or the value of "name" is
 		 *			  an empty string ""
 		 */
-		void elementHandlerEntity(SharedDataTable& sharedData, const AttributeMap& attributes);
+		void elementHandlerEntity(SharedDataTable& sharedData, const XmlAttributes& attributes);
 
 		/**
 		 * @brief Expat callback for Action element start tags.
 		 *
 		 * @param sharedData The shared data for the current parse.
-		 * @param attributes Map of key-value pairs of attributes
+		 * @param attributes View of key-value pairs of attributes
 		 *					 as unparsed strings.
 		 *
 		 * @exception No "class" attribute or the value of "class" is
@@ -185,37 +199,37 @@ namespace DOGEngine
 		 * @exception No "name" attribute or the value of "name" is
 		 *			  an empty string ""
 		 */
-		void elementHandlerAction(SharedDataTable& sharedData, const AttributeMap& attributes);
+		void elementHandlerAction(SharedDataTable& sharedData, const XmlAttributes& attributes);
 
 		/**
 		 * @brief Expat callback for Reaction element start tags.
 		 *
 		 * @param sharedData The shared data for the current parse.
-		 * @param attributes Map of key-value pairs of attributes
+		 * @param attributes View of key-value pairs of attributes
 		 *					 as unparsed strings.
 		 *
 		 * @exception No "name" attribute or the value of "name" is
 		 *			  an empty string ""
 		 */
-		void elementHandlerReaction(SharedDataTable& sharedData, const AttributeMap& attributes);
+		void elementHandlerReaction(SharedDataTable& sharedData, const XmlAttributes& attributes);
 
 		/**
 		 * @brief Expat callback for If element start tags.
 		 *
 		 * @param sharedData The shared data for the current parse.
-		 * @param attributes Map of key-value pairs of attributes
+		 * @param attributes View of key-value pairs of attributes
 		 *					 as unparsed strings.
 		 *
 		 * @exception No "name" attribute or the value of "name" is
 		 *			  an empty string ""
 		 */
-		void elementHandlerIf(SharedDataTable& sharedData, const AttributeMap& attributes);
+		void elementHandlerIf(SharedDataTable& sharedData, const XmlAttributes& attributes);
 
 		/**
 		 * @brief Expat callback for Then element start tags.
 		 *
 		 * @param sharedData The shared data for the current parse.
-		 * @param attributes Map of key-value pairs of attributes
+		 * @param attributes View of key-value pairs of attributes
 		 *					 as unparsed strings.
 		 *
 		 * @exception No "class" attribute or the value of "class" is
@@ -223,13 +237,13 @@ namespace DOGEngine
 		 * @exception No "name" attribute or the value of "name" is
 		 *			  an empty string ""
 		 */
-		void elementHandlerThen(SharedDataTable& sharedData, const AttributeMap& attributes);
+		void elementHandlerThen(SharedDataTable& sharedData, const XmlAttributes& attributes);
 
 		/**
 		 * @brief Expat callback for Else element start tags.
 		 *
 		 * @param sharedData The shared data for the current parse.
-		 * @param attributes Map of key-value pairs of attributes
+		 * @param attributes View of key-value pairs of attributes
 		 *					 as unparsed strings.
 		 *
 		 * @exception No "class" attribute or the value of "class" is
@@ -237,38 +251,34 @@ namespace DOGEngine
 		 * @exception No "name" attribute or the value of "name" is
 		 *			  an empty string ""
 		 */
-		void elementHandlerElse(SharedDataTable& sharedData, const AttributeMap& attributes);
+		void elementHandlerElse(SharedDataTable& sharedData, const XmlAttributes& attributes);
 
 		/**
 		 * @brief Expat callback for Condition element start tags.
 		 *
 		 * @param sharedData The shared data for the current parse.
-		 * @param attributes Map of key-value pairs of attributes
+		 * @param attributes View of key-value pairs of attributes
 		 *					 as unparsed strings.
 		 *
 		 * @exception No "value" attribute or the value of "value" is
 		 *			  an empty string ""
 		 */
-		void elementHandlerCondition(SharedDataTable& sharedData, const AttributeMap& attributes);
+		void elementHandlerCondition(SharedDataTable& sharedData, const XmlAttributes& attributes);
 
 		/**
 		 * @brief Adds attribute key-value pairs to the current
 		 *		  Table as strings.
 		 *
 		 * @param sharedData The shared data for the current parse.
-		 * @param attributes Map of key-value pairs of attributes
+		 * @param attributes View of key-value pairs of attributes
 		 *					 as unparsed strings.
 		 *
 		 * @note Ignores "name" and "class" attributes.
 		 */
-		void addAdditionalAttributes(SharedDataTable& sharedData, const AttributeMap& attributes);
-
+		void addAdditionalAttributes(SharedDataTable& sharedData, const XmlAttributes& attributes);
 
-		typedef std::function<void(XmlParseHelperTable&, SharedDataTable&, const AttributeMap&)> HandlerFunctions;
-		typedef HashMap<std::string, HandlerFunctions> HandlerMap;
 
-		// hash map holding handler functions
-		static HandlerMap sHandlerMap;
+		typedef void (XmlParseHelperTable::*HandlerFunction)(SharedDataTable&, const XmlAttributes&);
 		
 		// xml element tag names
 		const static std::string sScopeElement;
@@ -283,6 +293,10 @@ namespace DOGEngine
 		const static std::string sElseElement;
 		const static std::string sConditionElement;
 
+		// element tag names as declared to the XmlParseMaster, and the handler for each, in the same order
+		const static Symbol sElementSymbols[];
+		const static HandlerFunction sHandlers[];
+
 		// xml tag attribute names
 		const static std::string sNameAttribute;
 		const static std::string sClassAttribute;
@@ -1,7 +1,6 @@
 
 #include "pch.h"
 #include "XmlParseMaster.h"
-#include "HashMap.h"
 
 using namespace DOGEngine;
 using namespace std;
@@ -9,14 +8,18 @@ using namespace std;
 RTTI_DEFINITIONS(XmlParseMaster)
 RTTI_DEFINITIONS(SharedData)
 
-const uint32_t XmlParseMaster::sBufferSize = 1024;
+const uint32_t XmlParseMaster::sBufferSize = 64 * 1024;
 
 #pragma region XmlParseMaster
 
 XmlParseMaster::XmlParseMaster(SharedData& data) :
 	mParser(XML_ParserCreate(nullptr)),
 	mSharedData(nullptr),
-	mIsClone(false)
+	mIsClone(false),
+	mDispatchTable(0),
+	mRoutes(0),
+	mIsDispatchTableDirty(true),
+	mOpenElements(0)
 {
 	if(mParser == nullptr)
 	{
@@ -92,6 +95,13 @@ void XmlParseMaster::initialize()
 	{
 		helper->initialize();
 	}
+
+	// routing is settled before the parse, so the callbacks never check for changes
+	if(mIsDispatchTableDirty)
+	{
+		buildDispatchTable();
+	}
+	mOpenElements.clear();
 }
 
 //-----------------------------------------------------------------
@@ -123,6 +133,7 @@ bool XmlParseMaster::addHelper(IXmlParseHelper& helper)
 		if(!hasHelper(helper.TypeIdInstance()))
 		{
 			mHelpers.pushBack(&helper);
+			mIsDispatchTableDirty = true;
 			didInsert = true;
 		}
 	}
@@ -135,7 +146,13 @@ bool XmlParseMaster::addHelper(IXmlParseHelper& helper)
 bool XmlParseMaster::removeHelper(IXmlParseHelper& helper)
 {
 	// only remove if not clone, return if sucessful
-	return !mIsClone && mHelpers.remove(&helper);
+	bool didRemove = !mIsClone && mHelpers.remove(&helper);
+	if(didRemove)
+	{
+		mIsDispatchTableDirty = true;
+	}
+
+	return didRemove;
 }
 
 //-----------------------------------------------------------------
@@ -175,36 +192,56 @@ bool XmlParseMaster::parseFromFile(const string& fileName)
 		throw exception("Error -- cannot parse an Xml file with a null SharedData object!");
 	}
 
-	ifstream stream(fileName, ios::in | ios::binary | ios::ate);
-	int32_t fileSize = static_cast<int32_t>(stream.tellg());
+	// not opened with ios::ate, since that fails outright on streams that can't seek
+	ifstream stream(fileName, ios::in | ios::binary);
+	stream.seekg(0, ios::end);
+	streamoff fileSize = static_cast<streamoff>(stream.tellg());
 
-	if(fileSize > 0)
+	if(fileSize > 0 && fileSize <= INT32_MAX)
 	{
-		// some file read initialization
+		// the size is known, so the whole file is read straight into expat's own buffer and parsed in one call
+		//		rather than being copied through a small buffer a chunk at a time
 		setFileName(fileName);
-		char buffer[sBufferSize];
-		bool isFirstChunk = true;
+		initialize();
 
-		// while there is file left to read in...
-		stream.seekg(0, ios::beg);
-		while(stream)
+		int32_t length = static_cast<int32_t>(fileSize);
+		char* buffer = reinterpret_cast<char*>(XML_GetBuffer(mParser, length));
+		if(buffer == nullptr)
 		{
-			// read from file into buffer, break if nothing read (was at eof)
-			stream.read(buffer, sBufferSize);
-			if(stream.gcount() == 0)
-			{
-				break;
-			}
+			throw exception("Error -- could not allocate a parse buffer for the Xml file!");
+		}
 
-			// parse this current chunk (have to give parse some bools saying where we are in the file)
-			result = parse(buffer, static_cast<int32_t>(stream.gcount()), stream.eof(), isFirstChunk);
-			isFirstChunk = false;
+		stream.seekg(0, ios::beg);
+		stream.read(buffer, length);
+		if(stream.gcount() == length)
+		{
+			XML_ParseBuffer(mParser, length, true);
+			result = XML_GetErrorCode(mParser) == XML_ERROR_NONE;
+		}
+	}
+	else if(stream.is_open() && fileSize != 0)
+	{
+		// pipes and other streams can't report their size up front, so they are parsed a chunk at a time until they run dry
+		stream.clear();
+		if(fileSize > 0)
+		{
+			stream.seekg(0, ios::beg);
+		}
+		setFileName(fileName);
+		initialize();
 
-			// break if parse returned any error code
-			if(!result)
+		result = true;
+		while(result && stream)
+		{
+			char* buffer = reinterpret_cast<char*>(XML_GetBuffer(mParser, sBufferSize));
+			if(buffer == nullptr)
 			{
-				break;
+				throw exception("Error -- could not allocate a parse buffer for the Xml file!");
 			}
+
+			stream.read(buffer, sBufferSize);
+			XML_ParseBuffer(mParser, static_cast<int32_t>(stream.gcount()), !stream);
+			result = XML_GetErrorCode(mParser) == XML_ERROR_NONE;
 		}
 	}
 
@@ -230,6 +267,9 @@ void XmlParseMaster::setSharedData(SharedData& data)
 	// detach new shared data from its previous master
 	mSharedData = &data;
 	mSharedData->setXmlParseMaster(*this);
+
+	// helpers may not accept the new shared data
+	mIsDispatchTableDirty = true;
 }
 
 //-----------------------------------------------------------------
@@ -280,21 +320,24 @@ void XmlParseMaster::startElementHandler(void* userData, const XML_Char* name, c
 {
 	assert(userData != nullptr);
 
-	// add all attribute key-value pairs to map of strings as convenience to helpers
-	HashMap<string, string> attributesMap;
-	for(uint32_t i = 0; attributes[i] != nullptr; i += 2)
-	{
-		attributesMap[attributes[i]] = attributes[i + 1];
-	}
+	// helpers read the attributes straight out of expat's array, and share one copy of the element name
+	XmlAttributes attributesView(attributes);
+	string elementName(name);
 
 	SharedData* sharedData = reinterpret_cast<SharedData*>(userData);
-	sharedData->pushNewElement(name);
+	sharedData->pushNewElement(elementName);
 	sharedData->incrementDepth();
 
+	// the name is looked up once here, and the end tag and character data reuse the result
+	XmlParseMaster* master = sharedData->getXmlParseMaster();
+	uint32_t routes = master->routesFor(elementName);
+	master->mOpenElements.pushBack(routes);
+
 	// find a helper that will handle this element start
-	for(auto& helper : sharedData->getXmlParseMaster()->mHelpers)
+	for(auto& route : master->mRoutes[routes])
 	{
-		if(helper->startElementHandler(*sharedData, name, attributesMap))
+		XmlElement element(elementName, route.mIndex);
+		if(route.mHelper->startElementHandler(*sharedData, element, attributesView))
 		{
 			break;
 		}
@@ -307,13 +350,21 @@ void XmlParseMaster::endElementHandler(void* userData, const XML_Char* name)
 {
 	assert(userData != nullptr);
 
+	string elementName(name);
+
 	SharedData* sharedData = reinterpret_cast<SharedData*>(userData);
-	sharedData->popElement(name);
+	sharedData->popElement(elementName);
+
+	// popElement has checked that this ends the innermost open element
+	XmlParseMaster* master = sharedData->getXmlParseMaster();
+	uint32_t routes = master->mOpenElements.back();
+	master->mOpenElements.popBack();
 
 	// find a helper that will handle this element end
-	for(auto& helper : sharedData->getXmlParseMaster()->mHelpers)
+	for(auto& route : master->mRoutes[routes])
 	{
-		if(helper->endElementHandler(*sharedData, name))
+		XmlElement element(elementName, route.mIndex);
+		if(route.mHelper->endElementHandler(*sharedData, element))
 		{
 			break;
 		}
@@ -334,11 +385,15 @@ void XmlParseMaster::charDataHandler(void* userData, const XML_Char* buffer, int
 		if(buffer[0] != '\n' && buffer[0] != '\t')
 		{
 			SharedData* sharedData = reinterpret_cast<SharedData*>(userData);
+			XmlParseMaster* master = sharedData->getXmlParseMaster();
+
+			// character data belongs to the innermost open element, so it goes to the helpers for that element
+			uint32_t routes = master->mOpenElements.isEmpty() ? 0 : master->mOpenElements.back();
 
 			// find a helper that will handle this character data
-			for(auto& helper : sharedData->getXmlParseMaster()->mHelpers)
+			for(auto& route : master->mRoutes[routes])
 			{
-				if(helper->charDataHandler(*sharedData, buffer, length))
+				if(route.mHelper->charDataHandler(*sharedData, buffer, length))
 				{
 					break;
 				}
@@ -347,6 +402,78 @@ void XmlParseMaster::charDataHandler(void* userData, const XML_Char* buffer, int
 	}
 }
 
+//-----------------------------------------------------------------
+
+void XmlParseMaster::buildDispatchTable()
+{
+	mDispatchTable.clear();
+	mRoutes.clear();
+
+	// routes 0 are the catch-all helpers, offered every element no helper has declared
+	mRoutes.pushBack(RouteList(0));
+
+	// helpers are walked in the order they were added, so each name's routes keep the chain's order
+	Vector<Symbol> names(0);
+	for(auto& helper : mHelpers)
+	{
+		if(mSharedData == nullptr || !helper->acceptsSharedData(*mSharedData))
+		{
+			continue;
+		}
+
+		names.clear();
+		helper->getElementNames(names);
+
+		if(names.isEmpty())
+		{
+			// a helper that names nothing is offered every element, including ones no helper has declared
+			Route route = { helper, XmlElement::sUndeclared };
+			for(auto& routes : mRoutes)
+			{
+				routes.pushBack(route);
+			}
+		}
+		else
+		{
+			for(uint32_t i = 0; i < names.size(); ++i)
+			{
+				uint32_t id = names[i].id();
+				assert(id != Symbol::sInvalidId);
+
+				while(mDispatchTable.size() <= id)
+				{
+					mDispatchTable.pushBack(0);
+				}
+
+				// a name seen for the first time starts with the catch-all helpers that came before this one
+				if(mDispatchTable[id] == 0)
+				{
+					RouteList catchAllRoutes = mRoutes[0];
+					mDispatchTable[id] = mRoutes.size();
+					mRoutes.pushBack(std::move(catchAllRoutes));
+				}
+
+				RouteList& routes = mRoutes[mDispatchTable[id]];
+				if(routes.isEmpty() || routes.back().mHelper != helper)
+				{
+					Route route = { helper, i };
+					routes.pushBack(route);
+				}
+			}
+		}
+	}
+
+	mIsDispatchTableDirty = false;
+}
+
+//-----------------------------------------------------------------
+
+uint32_t XmlParseMaster::routesFor(const string& elementName) const
+{
+	uint32_t id = Symbol::lookup(elementName).id();
+	return (id < mDispatchTable.size()) ? mDispatchTable[id] : 0;
+}
+
 #pragma endregion
 
 //=================================================================
@@ -3,6 +3,7 @@
 
 #include "Vector.h"
 #include "SList.h"
+#include "HashMap.h"
 
 #include "IXmlParseHelper.h"
 #include "RTTI.h"
@@ -88,6 +89,12 @@ namespace DOGEngine
 		 *		   chain and was added. Returns false if the chain already
 		 *		   had a helper of that type and the given helper was not
 		 *		   added.
+		 *
+		 * @note Each element is offered only to the helpers that declared
+		 *		 its name through IXmlParseHelper::getElementNames, and to
+		 *		 helpers that declared no names, in the order they were added.
+		 *		 Helpers that don't accept this object's SharedData are
+		 *		 never offered anything.
 		 */
 		bool addHelper(IXmlParseHelper& helper);
 
@@ -137,6 +144,10 @@ namespace DOGEngine
 		 * 
 		 * @note No exception is thrown if the given filepath is not valid.
 		 *		 This method will simply return false without parsing.
+		 * @note A file whose size is known is read straight into expat's
+		 *		 buffer and parsed in a single call. Streams that can't
+		 *		 report a size, such as pipes, are parsed in chunks of
+		 *		 sBufferSize bytes instead.
 		 */
 		bool parseFromFile(const std::string& fileName);
 
@@ -243,6 +254,38 @@ namespace DOGEngine
 		 */
 		static void charDataHandler(void* userData, const XML_Char* buffer, int32_t length);
 
+		/**
+		 * A helper to offer an element to, with the position of the
+		 * element's name in the names the helper declared.
+		 */
+		struct Route
+		{
+			IXmlParseHelper* mHelper;
+			std::uint32_t mIndex;
+		};
+
+		typedef Vector<Route> RouteList;
+
+		/**
+		 * @brief Rebuilds the table that routes each element name to
+		 *		  the helpers that can handle it.
+		 */
+		void buildDispatchTable();
+
+		/**
+		 * @brief Looks up the helpers to offer an element to.
+		 *
+		 * @param elementName The name of the element.
+		 *
+		 * @return Returns the index into mRoutes of the helpers that
+		 *		   declared the name, along with every helper that
+		 *		   declared no names, in the order they were added.
+		 *
+		 * @note One Symbol lookup, which takes a shared lock on the
+		 *		 Symbol table.
+		 */
+		std::uint32_t routesFor(const std::string& elementName) const;
+
 		XML_Parser mParser;
 
 		std::string mFileName;
@@ -252,6 +295,14 @@ namespace DOGEngine
 
 		bool mIsClone;
 
+		// indexed by the Symbol id of each declared name; 0 (and any id past the end) routes to the catch-all helpers
+		Vector<std::uint32_t> mDispatchTable;
+		Vector<RouteList> mRoutes;
+		bool mIsDispatchTableDirty;
+
+		// routes of the open elements, innermost last, so end tags and character data skip the lookup
+		Vector<std::uint32_t> mOpenElements;
+
 		const static std::uint32_t sBufferSize;
 	};
 
@@ -0,0 +1,246 @@
+#include "pch.h"
+#include "XmlSubfileCache.h"
+
+#include "XmlParseMaster.h"
+#include "SharedDataTable.h"
+#include "ReactionAttributed.h"
+#include "Event.h"
+#include "EventArgs.h"
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+using namespace DOGEngine;
+using namespace std;
+
+#pragma region Prototype
+
+XmlSubfileCache::Prototype::Prototype(const void* owner, int64_t modifiedTime, int64_t fileSize) :
+	mGroup(), mScope(), mOwner(owner), mModifiedTime(modifiedTime), mFileSize(fileSize)
+{
+}
+
+//-----------------------------------------------------------------
+
+XmlSubfileCache::Prototype::~Prototype()
+{
+	// the load writes mScope, so it has to finish before the members go
+	try
+	{
+		mGroup.wait();
+	}
+	catch(...)
+	{
+	}
+}
+
+//-----------------------------------------------------------------
+
+Scope* XmlSubfileCache::Prototype::instantiate()
+{
+	mGroup.wait();
+
+	if(mScope == nullptr)
+	{
+		throw exception("Error -- could not parse the Xml subfile!");
+	}
+
+	return mScope->copy();
+}
+
+//-----------------------------------------------------------------
+
+bool XmlSubfileCache::Prototype::isLoaded() const
+{
+	return mGroup.isDone();
+}
+
+#pragma endregion
+
+//-----------------------------------------------------------------
+
+#pragma region Public Interface
+
+XmlSubfileCache::XmlSubfileCache() :
+	mPrototypes(), mMutex(), mHits(0), mMisses(0)
+{
+}
+
+//-----------------------------------------------------------------
+
+XmlSubfileCache::~XmlSubfileCache()
+{
+}
+
+//-----------------------------------------------------------------
+
+shared_ptr<XmlSubfileCache::Prototype> XmlSubfileCache::acquire(const string& path, XmlParseMaster& master)
+{
+	const void* owner = master.getSharedData();
+
+	int64_t modifiedTime = 0;
+	int64_t fileSize = 0;
+	bool isStamped = stamp(path, modifiedTime, fileSize);
+
+	// a replaced entry may have to wait for its load, so it is released after the lock
+	shared_ptr<Prototype> replaced;
+	shared_ptr<Prototype> prototype;
+
+	lock_guard<mutex> lock(mMutex);
+
+	PrototypeMap::Iterator iter = mPrototypes.find(path);
+	bool canInsert = isStamped && iter == mPrototypes.end();
+	if(isStamped && iter != mPrototypes.end())
+	{
+		Prototype& cached = *iter->second;
+		bool isCurrent = cached.mModifiedTime == modifiedTime && cached.mFileSize == fileSize;
+		bool isLoaded = cached.isLoaded();
+
+		if(!isCurrent || (isLoaded && cached.mScope == nullptr))
+		{
+			// the file changed or failed to parse last time
+			replaced = iter->second;
+			mPrototypes.remove(path);
+			canInsert = true;
+		}
+		else if(isLoaded || cached.mOwner == owner)
+		{
+			prototype = iter->second;
+		}
+	}
+
+	if(prototype != nullptr)
+	{
+		++mHits;
+	}
+	else
+	{
+		++mMisses;
+
+		prototype = shared_ptr<Prototype>(new Prototype(owner, modifiedTime, fileSize));
+		if(canInsert)
+		{
+			mPrototypes.insert(make_pair(path, prototype));
+		}
+
+		// submitted under the lock, so no other thread sees the entry before its load is pending
+		Prototype* loading = prototype.get();
+		shared_ptr<XmlParseMaster> masterClone(master.clone());
+		loading->mGroup.submit([loading, masterClone, path]()
+		{
+			// prototypes belong to the cache, not to the tree that happened to load them first
+			ScopeArena::Activation activation(nullptr);
+
+			if(masterClone->parseFromFile(path))
+			{
+				Scope* scope = masterClone->getSharedData()->As<SharedDataTable>()->extractScope();
+				deactivate(*scope);
+				loading->mScope.reset(scope);
+			}
+		});
+	}
+
+	return prototype;
+}
+
+//-----------------------------------------------------------------
+
+bool XmlSubfileCache::invalidate(const string& path)
+{
+	shared_ptr<Prototype> dropped;
+
+	lock_guard<mutex> lock(mMutex);
+
+	PrototypeMap::Iterator iter = mPrototypes.find(path);
+	if(iter != mPrototypes.end())
+	{
+		dropped = iter->second;
+		mPrototypes.remove(path);
+	}
+
+	return dropped != nullptr;
+}
+
+//-----------------------------------------------------------------
+
+void XmlSubfileCache::clear()
+{
+	PrototypeMap dropped;
+
+	lock_guard<mutex> lock(mMutex);
+	swap(dropped, mPrototypes);
+}
+
+//-----------------------------------------------------------------
+
+uint32_t XmlSubfileCache::size() const
+{
+	lock_guard<mutex> lock(mMutex);
+	return mPrototypes.size();
+}
+
+//-----------------------------------------------------------------
+
+uint32_t XmlSubfileCache::hits() const
+{
+	return mHits;
+}
+
+//-----------------------------------------------------------------
+
+uint32_t XmlSubfileCache::misses() const
+{
+	return mMisses;
+}
+
+//-----------------------------------------------------------------
+
+void XmlSubfileCache::resetCounters()
+{
+	mHits = 0;
+	mMisses = 0;
+}
+
+#pragma endregion
+
+//-----------------------------------------------------------------
+
+#pragma region Private Helpers
+
+bool XmlSubfileCache::stamp(const string& path, int64_t& modifiedTime, int64_t& fileSize)
+{
+	struct _stat64 info;
+	bool result = _stat64(path.c_str(), &info) == 0;
+
+	if(result)
+	{
+		modifiedTime = static_cast<int64_t>(info.st_mtime);
+		fileSize = static_cast<int64_t>(info.st_size);
+	}
+
+	return result;
+}
+
+//-----------------------------------------------------------------
+
+void XmlSubfileCache::deactivate(Scope& scope)
+{
+	if(ReactionAttributed* reaction = scope.As<ReactionAttributed>())
+	{
+		Event<EventArgs>::unsubscribe(*reaction);
+	}
+
+	for(uint32_t i = 0; i < scope.size(); ++i)
+	{
+		Datum& datum = scope[i];
+		if(datum.type() == Datum::DatumType::Table)
+		{
+			for(uint32_t j = 0; j < datum.size(); ++j)
+			{
+				deactivate(datum[j]);
+			}
+		}
+	}
+}
+
+#pragma endregion
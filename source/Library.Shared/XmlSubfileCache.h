@@ -0,0 +1,186 @@
+#pragma once
+
+#include "HashMap.h"
+#include "JobSystem.h"
+#include "Scope.h"
+
+namespace DOGEngine
+{
+	class XmlParseMaster;
+
+	/**
+	 * Cache of parsed Xml subfiles, so that a file included
+	 * many times is read and parsed once and every include
+	 * after that is a deep copy of the parsed root.
+	 *
+	 * Prototypes are inert: Reactions in them are unsubscribed
+	 * once the parse is done, and only their copies receive
+	 * events.
+	 *
+	 * Prototypes are built on the heap, since the cache owns
+	 * them; their copies are made in whatever ScopeArena the
+	 * including parse uses.
+	 *
+	 * Entries are keyed by the path the file was included
+	 * with, and are only reused while the file's last write
+	 * time and size match what they were when it was parsed.
+	 * Changes that keep both the same (within the file
+	 * system's time resolution) are not noticed; call
+	 * invalidate for those.
+	 *
+	 * A file that is still being parsed is shared only with
+	 * the parse that started it. Other parses load their own
+	 * copy instead of waiting, since they may be running on
+	 * the worker thread that the load is waiting under.
+	 *
+	 * All methods may be called from any thread. The cache
+	 * must outlive every parse that uses it.
+	 */
+	class XmlSubfileCache final
+	{
+	public:
+
+		/**
+		 * The parsed root of one subfile, which may still be
+		 * loading on the JobSystem.
+		 */
+		class Prototype final
+		{
+			friend class XmlSubfileCache;
+
+		public:
+
+			Prototype(const Prototype& other) = delete;
+			Prototype& operator=(const Prototype& other) = delete;
+
+			/**
+			 * @brief Destructor. Waits for the load, if it is
+			 *		  still running.
+			 */
+			~Prototype();
+
+			/**
+			 * @brief Waits for the load to finish, then makes a
+			 *		  deep copy of the parsed root. Reactions in
+			 *		  the copy subscribe to their events as usual.
+			 *
+			 * @return Returns the new Scope. The caller is
+			 *		   responsible for deleting it.
+			 *
+			 * @exception Throws exception if the file could not be
+			 *			  parsed, or rethrows what the parse threw.
+			 */
+			Scope* instantiate();
+
+		private:
+
+			Prototype(const void* owner, std::int64_t modifiedTime, std::int64_t fileSize);
+
+			bool isLoaded() const;
+
+			JobSystem::JobGroup mGroup;
+			std::unique_ptr<Scope> mScope;
+
+			const void* mOwner;
+			std::int64_t mModifiedTime;
+			std::int64_t mFileSize;
+		};
+
+		XmlSubfileCache(const XmlSubfileCache& other) = delete;
+		XmlSubfileCache& operator=(const XmlSubfileCache& other) = delete;
+
+		/**
+		 * @brief Constructor.
+		 */
+		XmlSubfileCache();
+
+		/**
+		 * @brief Destructor. Waits for any loads that are
+		 *		  still running.
+		 */
+		~XmlSubfileCache();
+
+		/**
+		 * @brief Gets the prototype for a subfile, starting a
+		 *		  load on the JobSystem if there is no usable one
+		 *		  cached. Call from the thread parsing the file
+		 *		  that includes it.
+		 *
+		 * @param path The path of the subfile.
+		 * @param master The master parsing the including file.
+		 *				 On a miss it is cloned to parse the
+		 *				 subfile.
+		 *
+		 * @return Returns the prototype, which is shared with the
+		 *		   cache when the file could be stamped.
+		 */
+		std::shared_ptr<Prototype> acquire(const std::string& path, XmlParseMaster& master);
+
+		/**
+		 * @brief Drops the cached prototype for a subfile, so
+		 *		  its next include parses it again.
+		 *
+		 * @param path The path of the subfile.
+		 *
+		 * @return Returns true if a prototype was dropped.
+		 */
+		bool invalidate(const std::string& path);
+
+		/**
+		 * @brief Drops every cached prototype.
+		 */
+		void clear();
+
+		/**
+		 * @brief Getter for the number of cached prototypes.
+		 *
+		 * @return Returns the number of entries.
+		 */
+		std::uint32_t size() const;
+
+		/**
+		 * @brief Getter for the number of includes that were
+		 *		  served by an existing prototype.
+		 *
+		 * @return Returns the hit count.
+		 */
+		std::uint32_t hits() const;
+
+		/**
+		 * @brief Getter for the number of includes that had to
+		 *		  parse their file.
+		 *
+		 * @return Returns the miss count.
+		 */
+		std::uint32_t misses() const;
+
+		/**
+		 * @brief Sets the hit and miss counts back to 0.
+		 */
+		void resetCounters();
+
+	private:
+
+		typedef HashMap<std::string, std::shared_ptr<Prototype>> PrototypeMap;
+
+		/**
+		 * @brief Reads a file's last write time and size.
+		 *
+		 * @return Returns false if the file could not be read.
+		 */
+		static bool stamp(const std::string& path, std::int64_t& modifiedTime, std::int64_t& fileSize);
+
+		/**
+		 * @brief Unsubscribes every Reaction in a parsed root
+		 *		  from its events, so a cached prototype is
+		 *		  never notified.
+		 */
+		static void deactivate(Scope& scope);
+
+		PrototypeMap mPrototypes;
+		mutable std::mutex mMutex;
+
+		std::atomic<std::uint32_t> mHits;
+		std::atomic<std::uint32_t> mMisses;
+	};
+}
@@ -16,15 +16,21 @@
 
 // Standard libraries
 #include <mutex>
+#include <atomic>
 #include <chrono>
+#include <thread>
 #include <future>
 #include <memory>
 #include <string>
 #include <vector>
+#include <cmath>
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <sstream>
 #include <utility>
 #include <algorithm>
 #include <exception>
 #include <functional>
+#include <condition_variable>